@@ -41,6 +41,15 @@ void TestCheckSumFromEnv(const char* env, unsigned int def, unsigned int calcula
 BOOST_AUTO_TEST_CASE(compare_checksum) {
     auto checksums = CheckSumContent();
 
+    // The expected values below predate the condition restructuring that
+    // flattens nested And/Or operands, simplifies empty/always/never operand
+    // lists to All/None, fuses WithinDistance of VisibleToEmpire pairs and
+    // merges Building/Species name lists. Those changes intentionally alter
+    // the checksums of content whose definitions use the affected condition
+    // forms, so any such manager now sums differently. Regenerate these pins
+    // from a build with a working content parser before enforcing them again
+    // through the FO_CHECKSUM_* environment variables; without those set the
+    // mismatches below only warn.
     TestCheckSumFromEnv("FO_CHECKSUM_BUILDING", 7870370, checksums["BuildingTypeManager"]);
     TestCheckSumFromEnv("FO_CHECKSUM_ENCYCLOPEDIA", 1090024, checksums["Encyclopedia"]);
     TestCheckSumFromEnv("FO_CHECKSUM_FIELD", 3780088, checksums["FieldTypeManager"]);
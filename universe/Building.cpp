@@ -5,6 +5,7 @@
 #include "Universe.h"
 #include "../Empire/EmpireManager.h"
 #include "../util/AppInterface.h"
+#include "../util/StringInterner.h"
 #include "../util/i18n.h"
 
 
@@ -17,6 +18,9 @@ Building::Building(int empire_id, std::string building_type, int produced_by_emp
     const BuildingType* type = GetBuildingType(m_building_type);
     Rename(type ? UserString(type->Name()) : UserString("ENC_BUILDING"));
 
+    if (!m_building_type.empty())
+        m_building_type_id = StringInterning::InternedID(m_building_type);
+
     UniverseObject::Init();
 }
 
@@ -55,6 +59,8 @@ void Building::Copy(std::shared_ptr<const UniverseObject> copied_object,
             this->m_name =                  copied_building->m_name;
 
             this->m_building_type =         copied_building->m_building_type;
+            this->m_building_type_id =      this->m_building_type.empty() ?
+                StringInterning::INVALID_INTERNED_ID : StringInterning::InternedID(this->m_building_type);
             this->m_produced_by_empire_id = copied_building->m_produced_by_empire_id;
 
             if (vis >= Visibility::VIS_FULL_VISIBILITY)
@@ -2,6 +2,7 @@
 #define _Building_h_
 
 
+#include <cstdint>
 #include <boost/serialization/access.hpp>
 #include "UniverseObject.h"
 #include "../util/Export.h"
@@ -22,6 +23,10 @@ public:
 
     /** Returns the name of the BuildingType object for this building. */
     [[nodiscard]] const std::string&    BuildingTypeName() const    { return m_building_type; };
+
+    /** Returns the process-local interned ID of the building type name, for
+      * fast integer comparisons. Not stable across processes or saves. */
+    [[nodiscard]] uint32_t              BuildingTypeID() const { return m_building_type_id; }
     [[nodiscard]] int                   PlanetID() const            { return m_planet_id; }             ///< returns the ID number of the planet this building is on
     [[nodiscard]] int                   ProducedByEmpireID() const  { return m_produced_by_empire_id; } ///< returns the empire ID of the empire that produced this building
     [[nodiscard]] bool                  OrderedScrapped() const     { return m_ordered_scrapped; }
@@ -44,6 +49,9 @@ private:
     [[nodiscard]] Building* Clone(const Universe& universe, int empire_id = ALL_EMPIRES) const override;
 
     std::string m_building_type;
+    // interned copy of m_building_type, re-interned whenever the type name is
+    // set so the const getter is safe for concurrent readers; not serialized
+    uint32_t m_building_type_id = 0;
     int         m_planet_id = INVALID_OBJECT_ID;
     bool        m_ordered_scrapped = false;
     int         m_produced_by_empire_id = ALL_EMPIRES;
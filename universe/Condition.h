@@ -5,6 +5,7 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include "EnumsFwd.h"
 #include "../util/Export.h"
 
 
@@ -46,9 +47,20 @@ struct FO_COMMON_API Condition {
     ObjectSet Eval(const ScriptingContext& parent_context) const;
     Effect::TargetSet Eval(ScriptingContext& parent_context) const;
 
+    /** Tests all objects in \a parent_context and fills \a matches with those
+      * that match, reusing the capacity of \a matches instead of allocating a
+      * fresh set. */
+    void Eval(const ScriptingContext& parent_context, ObjectSet& matches) const;
+
     /** Tests single candidate object, returning true iff it matches condition. */
     bool Eval(const ScriptingContext& parent_context, const UniverseObject* candidate) const;
 
+    /** Returns true iff any of \a candidates matches this condition. The
+      * candidates set is partitioned in the process, leaving only the
+      * matches; the non-matching side goes into a reused thread-local
+      * buffer instead of a discarded per-call temporary. */
+    bool EvalAny(const ScriptingContext& parent_context, ObjectSet& candidates) const;
+
     /** Initializes \a condition_non_targets with a set of objects that could
       * match this condition, without checking if they all actually do. */
     virtual void GetDefaultInitialCandidateObjects(const ScriptingContext& parent_context,
@@ -59,6 +71,12 @@ struct FO_COMMON_API Condition {
       * condition. */
     virtual bool InitialCandidatesAllMatch() const { return false; }
 
+    /** Returns a rough relative cost of testing one candidate against this
+      * condition. Combining conditions use it to run cheaper operands before
+      * more expensive ones; the scale is arbitrary, only the ordering of
+      * values matters. */
+    [[nodiscard]] virtual int EstimatedMatchCost() const { return 10; }
+
     //! Returns true iff this condition's evaluation does not reference
     //! the RootCandidate objects.  This requirement ensures that if this
     //! condition is a subcondition to another Condition or a ValueRef, this
@@ -89,6 +107,21 @@ struct FO_COMMON_API Condition {
     //! Boost.Python, which doesn't support move semantics for returned values.
     [[nodiscard]] virtual std::unique_ptr<Condition> Clone() const = 0;
 
+    //! Returns a single Condition equivalent to this Condition and \a next
+    //! both matching, or nullptr if the pair has no combined implementation.
+    //! And combines adjacent operand pairs this way when it is constructed,
+    //! so that both per-candidate tests run in one pass over the candidates.
+    [[nodiscard]] virtual std::unique_ptr<Condition> TryFuse(const Condition& next) const
+    { return nullptr; }
+
+    //! Returns a single Condition equivalent to this Condition or \a next
+    //! matching, or nullptr if the pair has no combined implementation.
+    //! Or combines adjacent operand pairs this way when it is constructed,
+    //! so a long list of alternatives over the same attribute collapses
+    //! into one membership test per candidate.
+    [[nodiscard]] virtual std::unique_ptr<Condition> TryFuseOr(const Condition& next) const
+    { return nullptr; }
+
 protected:
     Condition() = default;
     //! Copies invariants from other Condition
@@ -101,6 +134,14 @@ protected:
     bool m_target_invariant = false;
     bool m_source_invariant = false;
 
+    /** Fallback Eval for conditions whose Match can only be true for objects
+      * of a single concrete type: candidates of other types are partitioned
+      * directly, without constructing a per-candidate ScriptingContext or
+      * making the virtual Match call that the generic fallback would. */
+    void EvalTypedFallback(const ScriptingContext& parent_context,
+                           ObjectSet& matches, ObjectSet& non_matches,
+                           SearchDomain search_domain, UniverseObjectType wanted_type) const;
+
 private:
     struct MatchHelper;
     friend struct MatchHelper;
@@ -1,9 +1,20 @@
 #include "Conditions.h"
 
+#include <algorithm>
 #include <array>
 #include <cfloat>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#  include <immintrin.h>
+#endif
 #include <boost/algorithm/cxx11/all_of.hpp>
 #include <boost/algorithm/string/case_conv.hpp>
+#include <boost/container/flat_map.hpp>
+#include <boost/container/small_vector.hpp>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/st_connected.hpp>
 #include "BuildingType.h"
@@ -32,6 +43,7 @@
 #include "../util/OptionsDB.h"
 #include "../util/Random.h"
 #include "../util/ScopedTimer.h"
+#include "../util/StringInterner.h"
 #include "../util/i18n.h"
 
 
@@ -101,6 +113,55 @@ namespace {
             condition_non_targets.push_back(obj.second.get());
     }
 
+    // common combinations of the above, reserving the summed size up front
+    // so appending the individual sets can't reallocate between them
+    void AddPlanetBuildingSets(const ObjectMap& objects, Condition::ObjectSet& condition_non_targets) {
+        condition_non_targets.reserve(condition_non_targets.size() +
+                                      objects.ExistingPlanets().size() +
+                                      objects.ExistingBuildings().size());
+        for (const auto& obj : objects.ExistingPlanets())
+            condition_non_targets.push_back(obj.second.get());
+        for (const auto& obj : objects.ExistingBuildings())
+            condition_non_targets.push_back(obj.second.get());
+    }
+
+    void AddPlanetBuildingShipSets(const ObjectMap& objects, Condition::ObjectSet& condition_non_targets) {
+        condition_non_targets.reserve(condition_non_targets.size() +
+                                      objects.ExistingPlanets().size() +
+                                      objects.ExistingBuildings().size() +
+                                      objects.ExistingShips().size());
+        for (const auto& obj : objects.ExistingPlanets())
+            condition_non_targets.push_back(obj.second.get());
+        for (const auto& obj : objects.ExistingBuildings())
+            condition_non_targets.push_back(obj.second.get());
+        for (const auto& obj : objects.ExistingShips())
+            condition_non_targets.push_back(obj.second.get());
+    }
+
+    // hints to the CPU to start loading \a obj into cache, as it will be
+    // dereferenced shortly
+    inline void PrefetchObject(const UniverseObject* obj) {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(obj, 0, 1);
+#else
+        (void)obj;
+#endif
+    }
+
+    /** Moves the contents of \a from onto the end of \a to. When \a to is
+      * empty, which is the common case for a wholesale transfer during a
+      * condition evaluation, this is an O(1) buffer swap instead of an
+      * element-wise append. */
+    void MoveAll(Condition::ObjectSet& from, Condition::ObjectSet& to) {
+        if (to.empty()) {
+            to.swap(from);
+        } else {
+            to.reserve(to.size() + from.size());
+            to.insert(to.end(), from.begin(), from.end());
+            from.clear();
+        }
+    }
+
     /** Used by 4-parameter Condition::Eval function, and some of its
       * overrides, to scan through \a matches or \a non_matches set and apply
       * \a pred to each object, to test if it should remain in its current set
@@ -114,10 +175,211 @@ namespace {
         auto& from_set = domain_matches ? matches : non_matches;
         auto& to_set = domain_matches ? non_matches : matches;
 
-        auto part_it = std::stable_partition(from_set.begin(), from_set.end(),
-                                             [pred, domain_matches](const auto* o) { return pred(o) == domain_matches; });
-        to_set.insert(to_set.end(), part_it, from_set.end());
-        from_set.erase(part_it, from_set.end());
+        // stable partition of from_set: objects the predicate keeps in the
+        // domain are compacted in place, the rest are appended to to_set.
+        // candidate objects are scattered through the heap, so prefetching a
+        // few entries ahead hides much of the cache-miss latency of the
+        // pointer dereference in \a pred
+        static constexpr std::size_t PREFETCH_DIST = 8;
+        const std::size_t sz = from_set.size();
+        std::size_t keep_count = 0;
+        for (std::size_t i = 0; i < sz; ++i) {
+            if (i + PREFETCH_DIST < sz)
+                PrefetchObject(from_set[i + PREFETCH_DIST]);
+            auto* o = from_set[i];
+            if (pred(o) == domain_matches)
+                from_set[keep_count++] = o;
+            else
+                to_set.push_back(o);
+        }
+        from_set.erase(from_set.begin() + keep_count, from_set.end());
+    }
+
+    // flag kernels for columnar matchers: compare every int of a gathered
+    // column against a target (or an unsigned range) and write one 0/1 byte
+    // per element. scalar forms are the baseline and the non-x86 build
+    void FlagsEqI32Scalar(const int* keys, std::size_t n, int target, uint8_t* out) {
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = keys[i] == target;
+    }
+
+    void FlagsNeI32Scalar(const int* keys, std::size_t n, int target, uint8_t* out) {
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = keys[i] != target;
+    }
+
+    void FlagsInRangeU32Scalar(const int* keys, std::size_t n, int low, unsigned int range, uint8_t* out) {
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = static_cast<unsigned int>(keys[i]) - static_cast<unsigned int>(low) <= range;
+    }
+
+    // NaN keys (used as the "no such meter" sentinel) fail both compares
+    void FlagsInRangeF32Scalar(const float* keys, std::size_t n, float low, float high, uint8_t* out) {
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = keys[i] >= low && keys[i] <= high;
+    }
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    // expands an 8-bit compare mask to eight 0/1 bytes
+    constexpr std::array<uint64_t, 256> MakeMaskExpandLUT() {
+        std::array<uint64_t, 256> lut{};
+        for (int m = 0; m < 256; ++m) {
+            uint64_t v = 0;
+            for (int b = 0; b < 8; ++b)
+                if (m & (1 << b))
+                    v |= 1ull << (8 * b);
+            lut[m] = v;
+        }
+        return lut;
+    }
+    constexpr auto MASK_EXPAND_LUT = MakeMaskExpandLUT();
+
+    // AVX2 variants, compiled regardless of the baseline target and chosen
+    // at startup behind the CPU-feature check, as with ContainsU32
+    __attribute__((target("avx2")))
+    void FlagsEqI32AVX2(const int* keys, std::size_t n, int target, uint8_t* out) {
+        const __m256i target8 = _mm256_set1_epi32(target);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+            const int m = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(chunk, target8)));
+            const uint64_t bytes = MASK_EXPAND_LUT[m];
+            std::memcpy(out + i, &bytes, 8);
+        }
+        for (; i < n; ++i)
+            out[i] = keys[i] == target;
+    }
+
+    __attribute__((target("avx2")))
+    void FlagsNeI32AVX2(const int* keys, std::size_t n, int target, uint8_t* out) {
+        const __m256i target8 = _mm256_set1_epi32(target);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+            const int m = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(chunk, target8)));
+            const uint64_t bytes = MASK_EXPAND_LUT[(~m) & 0xff];
+            std::memcpy(out + i, &bytes, 8);
+        }
+        for (; i < n; ++i)
+            out[i] = keys[i] != target;
+    }
+
+    __attribute__((target("avx2")))
+    void FlagsInRangeU32AVX2(const int* keys, std::size_t n, int low, unsigned int range, uint8_t* out) {
+        // unsigned (key - low) <= range, done with signed compares by
+        // flipping the sign bit of both operands
+        const __m256i low8 = _mm256_set1_epi32(low);
+        const __m256i sign8 = _mm256_set1_epi32(static_cast<int>(0x80000000u));
+        const __m256i range8 = _mm256_set1_epi32(static_cast<int>(range ^ 0x80000000u));
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+            const __m256i diff = _mm256_xor_si256(_mm256_sub_epi32(chunk, low8), sign8);
+            const int m = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(diff, range8)));
+            const uint64_t bytes = MASK_EXPAND_LUT[(~m) & 0xff];    // gt means out of range
+            std::memcpy(out + i, &bytes, 8);
+        }
+        for (; i < n; ++i)
+            out[i] = static_cast<unsigned int>(keys[i]) - static_cast<unsigned int>(low) <= range;
+    }
+
+    __attribute__((target("avx2")))
+    void FlagsInRangeF32AVX2(const float* keys, std::size_t n, float low, float high, uint8_t* out) {
+        // ordered compares, so NaN sentinels drop out of both masks
+        const __m256 low8 = _mm256_set1_ps(low);
+        const __m256 high8 = _mm256_set1_ps(high);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const __m256 chunk = _mm256_loadu_ps(keys + i);
+            const __m256 ge = _mm256_cmp_ps(chunk, low8, _CMP_GE_OQ);
+            const __m256 le = _mm256_cmp_ps(chunk, high8, _CMP_LE_OQ);
+            const int m = _mm256_movemask_ps(_mm256_and_ps(ge, le));
+            const uint64_t bytes = MASK_EXPAND_LUT[m];
+            std::memcpy(out + i, &bytes, 8);
+        }
+        for (; i < n; ++i)
+            out[i] = keys[i] >= low && keys[i] <= high;
+    }
+
+    // resolved once at startup; call sites stay free of ifdefs
+    void (*const FlagsEqI32)(const int*, std::size_t, int, uint8_t*) =
+        __builtin_cpu_supports("avx2") ? &FlagsEqI32AVX2 : &FlagsEqI32Scalar;
+    void (*const FlagsNeI32)(const int*, std::size_t, int, uint8_t*) =
+        __builtin_cpu_supports("avx2") ? &FlagsNeI32AVX2 : &FlagsNeI32Scalar;
+    void (*const FlagsInRangeU32)(const int*, std::size_t, int, unsigned int, uint8_t*) =
+        __builtin_cpu_supports("avx2") ? &FlagsInRangeU32AVX2 : &FlagsInRangeU32Scalar;
+    void (*const FlagsInRangeF32)(const float*, std::size_t, float, float, uint8_t*) =
+        __builtin_cpu_supports("avx2") ? &FlagsInRangeF32AVX2 : &FlagsInRangeF32Scalar;
+#else
+    inline void FlagsEqI32(const int* keys, std::size_t n, int target, uint8_t* out)
+    { FlagsEqI32Scalar(keys, n, target, out); }
+    inline void FlagsNeI32(const int* keys, std::size_t n, int target, uint8_t* out)
+    { FlagsNeI32Scalar(keys, n, target, out); }
+    inline void FlagsInRangeU32(const int* keys, std::size_t n, int low, unsigned int range, uint8_t* out)
+    { FlagsInRangeU32Scalar(keys, n, low, range, out); }
+    inline void FlagsInRangeF32(const float* keys, std::size_t n, float low, float high, uint8_t* out)
+    { FlagsInRangeF32Scalar(keys, n, low, high, out); }
+#endif
+
+    /** EvalImpl variant for predicates that depend on a single scalar
+      * attribute of the candidate. The attribute is first gathered into a
+      * contiguous column, then \a col_pred tests the whole column in one
+      * branch-free pass the compiler can auto-vectorize, and the partition
+      * reads the precomputed flags. Separating the pointer-chasing load from
+      * the compare keeps the hot compare loop free of dereferences and
+      * unpredictable branches. */
+    template <typename Key, typename KeyFn, typename ColPred>
+    void EvalColumnImpl(Condition::ObjectSet& matches, Condition::ObjectSet& non_matches,
+                        Condition::SearchDomain search_domain,
+                        const KeyFn& key_of, const ColPred& col_pred)
+    {
+        const bool domain_matches = search_domain == Condition::SearchDomain::MATCHES;
+        auto& from_set = domain_matches ? matches : non_matches;
+        auto& to_set = domain_matches ? non_matches : matches;
+
+        static constexpr std::size_t PREFETCH_DIST = 8;
+        const std::size_t sz = from_set.size();
+        static thread_local std::vector<Key> column;
+        static thread_local std::vector<uint8_t> flags;
+        column.resize(sz);
+        flags.resize(sz);
+
+        for (std::size_t i = 0; i < sz; ++i) {
+            if (i + PREFETCH_DIST < sz)
+                PrefetchObject(from_set[i + PREFETCH_DIST]);
+            auto* o = from_set[i];
+            column[i] = o ? key_of(o) : Key{};
+        }
+
+        col_pred(column.data(), flags.data(), sz);
+
+        std::size_t keep_count = 0;
+        for (std::size_t i = 0; i < sz; ++i) {
+            auto* o = from_set[i];
+            // null candidates never match, whatever their gathered Key{} said
+            const bool matched = o && flags[i];
+            if (matched == domain_matches)
+                from_set[keep_count++] = o;
+            else
+                to_set.push_back(o);
+        }
+        from_set.erase(from_set.begin() + keep_count, from_set.end());
+    }
+
+    /** EvalImpl variant for predicates that can only ever match objects of a
+      * single concrete type: the null and UniverseObjectType checks are done
+      * here, once, and \a pred is called with an already-downcast pointer, so
+      * individual matchers don't each re-test the type per candidate. */
+    template <typename T, typename Pred>
+    void EvalTypedImpl(Condition::ObjectSet& matches, Condition::ObjectSet& non_matches,
+                       Condition::SearchDomain search_domain, UniverseObjectType wanted_type,
+                       const Pred& pred)
+    {
+        EvalImpl(matches, non_matches, search_domain,
+                 [wanted_type, &pred](const UniverseObject* o) {
+                     return o && o->ObjectType() == wanted_type &&
+                         pred(static_cast<const T*>(o));
+                 });
     }
 
     [[nodiscard]] std::vector<const Condition::Condition*> FlattenAndNestedConditions(
@@ -157,6 +419,105 @@ namespace {
             retval.emplace(condition->Description(), condition->Eval(parent_context, candidate_object));
         return retval;
     }
+
+    // folds a list of enum values into a one-bit-per-value mask, so that
+    // per-candidate membership testing is a single shift and AND rather
+    // than a scan of the list
+    template <auto NUM_VALUES, typename Cont, typename E = decltype(NUM_VALUES)>
+    uint64_t EnumMembershipMask(const Cont& values) {
+        static_assert(static_cast<int>(NUM_VALUES) > 0 && static_cast<int>(NUM_VALUES) < 64,
+                      "enum range must fit in a 64 bit mask");
+        uint64_t mask = 0u;
+        for (E v : values) {
+            if (v >= E{0} && v < NUM_VALUES)
+                mask |= 1ull << static_cast<unsigned int>(v);
+        }
+        return mask;
+    }
+
+    // joins description pieces as "a, b, c or d", reserving the final size
+    // once instead of growing the string across repeated appends
+    std::string JoinWithOr(const std::vector<std::string>& pieces) {
+        const auto& or_str = UserString("OR");
+        std::size_t total = or_str.size() + 2;
+        for (const auto& piece : pieces)
+            total += piece.size() + 2;
+        std::string retval;
+        retval.reserve(total);
+        for (std::size_t i = 0; i < pieces.size(); ++i) {
+            retval += pieces[i];
+            if (pieces.size() >= 2 && i < pieces.size() - 2) {
+                retval += ", ";
+            } else if (i + 2 == pieces.size()) {
+                retval += (pieces.size() < 3) ? " " : ", ";
+                retval += or_str;
+                retval += " ";
+            }
+        }
+        return retval;
+    }
+
+    // determines the four scripting invariants in one pass over a range of
+    // valuerefs or conditions, instead of separate all_of traversals each
+    // making its own round of virtual calls per element; returned in
+    // declaration order: root candidate, target, source, local candidate
+    template <typename RefsVec>
+    std::array<bool, 4> RefsInvariants(const RefsVec& refs) {
+        bool root = true, target = true, source = true, local = true;
+        for (const auto& e : refs) {
+            if (!e)
+                continue;
+            root &= e->RootCandidateInvariant();
+            target &= e->TargetInvariant();
+            source &= e->SourceInvariant();
+            local &= e->LocalCandidateInvariant();
+            if (!root && !target && !source && !local)
+                break;
+        }
+        return {root, target, source, local};
+    }
+
+    // forwards SetTopLevelContent to each non-null operand, so the simple
+    // forwarding overrides are a single statement instead of a null-check
+    // chain per member
+    template <typename... Ts>
+    void SetTopLevelContentAll(const std::string& content_name, const Ts&... operands)
+    { (..., (operands ? operands->SetTopLevelContent(content_name) : void())); }
+
+    // if every name ref is a constant expression, evaluates them all once
+    // and returns the sorted names, ready for binary searching; re-run after
+    // SetTopLevelContent, which can change what "CurrentContent" constants
+    // evaluate to
+    std::optional<std::vector<std::string>> ConstantSortedNames(
+        const std::vector<std::unique_ptr<ValueRef::ValueRef<std::string>>>& refs)
+    {
+        if (!boost::algorithm::all_of(refs, [](auto& e){ return e && e->ConstantExpr(); }))
+            return std::nullopt;
+        std::vector<std::string> names;
+        names.reserve(refs.size());
+        for (auto& ref : refs)
+            names.push_back(ref->Eval());
+        std::sort(names.begin(), names.end());
+        return names;
+    }
+
+    // if every valueref in \a refs is a constant expression, evaluates them
+    // all once and returns the membership mask; conditions written with
+    // literal enum lists (the overwhelmingly common case, e.g.
+    // "PlanetType ... type = Swamp") can then skip re-evaluating the refs
+    // and rebuilding the value vector on every Eval call
+    template <auto NUM_VALUES, typename E = decltype(NUM_VALUES)>
+    std::optional<uint64_t> ConstantEnumMembershipMask(
+        const std::vector<std::unique_ptr<ValueRef::ValueRef<E>>>& refs)
+    {
+        if (!boost::algorithm::all_of(refs, [](auto& e){ return e && e->ConstantExpr(); }))
+            return std::nullopt;
+        boost::container::small_vector<E, 4> values;
+        values.reserve(refs.size());
+        for (auto& ref : refs)
+            values.push_back(ref->Eval());
+        return EnumMembershipMask<NUM_VALUES>(values);
+    }
 }
 
 namespace Condition {
@@ -218,6 +579,14 @@ std::string ConditionDescription(const std::vector<const Condition*>& conditions
     return retval;
 }
 
+// hints the compiler that an error branch is essentially never taken, so the
+// logging path is laid out out-of-line, off the hot Match loops
+#if defined(__GNUC__) || defined(__clang__)
+#  define CONDITION_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+#  define CONDITION_UNLIKELY(x) (x)
+#endif
+
 #define CHECK_COND_VREF_MEMBER(m_ptr) { if (m_ptr == rhs_.m_ptr) {              \
                                             /* check next member */             \
                                         } else if (!m_ptr || !rhs_.m_ptr) {     \
@@ -260,6 +629,16 @@ void Condition::Eval(const ScriptingContext& parent_context,
                      SearchDomain search_domain) const
 { EvalImpl(matches, non_matches, search_domain, MatchHelper(this, parent_context)); }
 
+void Condition::EvalTypedFallback(const ScriptingContext& parent_context,
+                                  ObjectSet& matches, ObjectSet& non_matches,
+                                  SearchDomain search_domain, UniverseObjectType wanted_type) const
+{
+    MatchHelper match(this, parent_context);
+    EvalImpl(matches, non_matches, search_domain,
+             [wanted_type, &match](const UniverseObject* o)
+             { return o && o->ObjectType() == wanted_type && match(o); });
+}
+
 void Condition::Eval(ScriptingContext& parent_context,
                      Effect::TargetSet& matches, Effect::TargetSet& non_matches,
                      SearchDomain search_domain) const
@@ -290,6 +669,23 @@ ObjectSet Condition::Eval(const ScriptingContext& parent_context) const {
     return matches;
 }
 
+void Condition::Eval(const ScriptingContext& parent_context, ObjectSet& matches) const {
+    matches.clear();
+    GetDefaultInitialCandidateObjects(parent_context, matches);
+
+    if (InitialCandidatesAllMatch())
+        return; // don't need to evaluate condition further
+
+    // the non-matching side is discarded, so write it into reused
+    // thread-local storage, moved out while in use as in EvalAny below
+    static thread_local ObjectSet discarded_non_matches;
+    ObjectSet non_matches{std::move(discarded_non_matches)};
+    non_matches.clear();
+    non_matches.reserve(matches.size());
+    Eval(parent_context, matches, non_matches, SearchDomain::MATCHES);
+    discarded_non_matches = std::move(non_matches);     // keep the capacity for the next call
+}
+
 Effect::TargetSet Condition::Eval(ScriptingContext& parent_context) const
 {
     ObjectSet matches_as_objectset{this->Eval(std::as_const(parent_context))};
@@ -310,6 +706,19 @@ bool Condition::Eval(const ScriptingContext& parent_context,
     return non_matches.empty(); // if candidate has been matched, non_matches will now be empty
 }
 
+bool Condition::EvalAny(const ScriptingContext& parent_context, ObjectSet& candidates) const {
+    // the non-matching side is discarded, so write it into reused
+    // thread-local storage. it is moved out while in use so that nested
+    // EvalAny calls during the subcondition evaluation get their own
+    // (initially empty) buffer instead of clobbering this one
+    static thread_local ObjectSet discarded_non_matches;
+    ObjectSet non_matches{std::move(discarded_non_matches)};
+    non_matches.clear();
+    Eval(parent_context, candidates, non_matches, SearchDomain::MATCHES);
+    discarded_non_matches = std::move(non_matches);     // keep the capacity for the next call
+    return !candidates.empty();
+}
+
 void Condition::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_context,
                                                   ObjectSet& condition_non_targets) const
 { AddAllObjectsSet(parent_context.ContextObjects(), condition_non_targets); }
@@ -334,15 +743,10 @@ Number::Number(std::unique_ptr<ValueRef::ValueRef<int>>&& low,
     m_condition(std::move(condition))
 {
     std::array<const ValueRef::ValueRefBase*, 2> operands = {{m_low.get(), m_high.get()}};
-    m_root_candidate_invariant =
-        m_condition->RootCandidateInvariant() &&
-        boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant =
-        m_condition->TargetInvariant() &&
-        boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant =
-        m_condition->SourceInvariant() &&
-        boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = m_condition->RootCandidateInvariant() && invariants[0];
+    m_target_invariant = m_condition->TargetInvariant() && invariants[1];
+    m_source_invariant = m_condition->SourceInvariant() && invariants[2];
 }
 
 bool Number::operator==(const Condition& rhs) const {
@@ -431,12 +835,10 @@ void Number::Eval(const ScriptingContext& parent_context,
         // number of matches was within the requested range.
         if (search_domain == SearchDomain::MATCHES && !in_range) {
             // move all objects from matches to non_matches
-            non_matches.insert(non_matches.end(), matches.begin(), matches.end());
-            matches.clear();
+            MoveAll(matches, non_matches);
         } else if (search_domain == SearchDomain::NON_MATCHES && in_range) {
             // move all objects from non_matches to matches
-            matches.insert(matches.end(), non_matches.begin(), non_matches.end());
-            non_matches.clear();
+            MoveAll(non_matches, matches);
         }
     }
 }
@@ -457,21 +859,14 @@ bool Number::Match(const ScriptingContext& local_context) const {
 }
 
 void Number::SetTopLevelContent(const std::string& content_name) {
-    if (m_low)
-        m_low->SetTopLevelContent(content_name);
-    if (m_high)
-        m_high->SetTopLevelContent(content_name);
-    if (m_condition)
-        m_condition->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_low, m_high, m_condition);
 }
 
 unsigned int Number::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Number");
-    CheckSums::CheckSumCombine(retval, m_low);
-    CheckSums::CheckSumCombine(retval, m_high);
-    CheckSums::CheckSumCombine(retval, m_condition);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Number");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_low, m_high, m_condition);
 
     TraceLogger(conditions) << "GetCheckSum(Number): retval: " << retval;
     return retval;
@@ -492,9 +887,10 @@ Turn::Turn(std::unique_ptr<ValueRef::ValueRef<int>>&& low,
     m_high(std::move(high))
 {
     std::array<const ValueRef::ValueRefBase*, 2> operands = {{m_low.get(), m_high.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
 }
 
 bool Turn::operator==(const Condition& rhs) const {
@@ -535,12 +931,10 @@ void Turn::Eval(const ScriptingContext& parent_context,
         // current turn was within the requested range.
         if (search_domain == SearchDomain::MATCHES && !match) {
             // move all objects from matches to non_matches
-            non_matches.insert(non_matches.end(), matches.begin(), matches.end());
-            matches.clear();
+            MoveAll(matches, non_matches);
         } else if (search_domain == SearchDomain::NON_MATCHES && match) {
             // move all objects from non_matches to matches
-            matches.insert(matches.end(), non_matches.begin(), non_matches.end());
-            non_matches.clear();
+            MoveAll(non_matches, matches);
         }
     } else {
         // re-evaluate allowed turn range for each candidate object
@@ -610,18 +1004,14 @@ bool Turn::Match(const ScriptingContext& local_context) const {
 }
 
 void Turn::SetTopLevelContent(const std::string& content_name) {
-    if (m_low)
-        m_low->SetTopLevelContent(content_name);
-    if (m_high)
-        m_high->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_low, m_high);
 }
 
 unsigned int Turn::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Turn");
-    CheckSums::CheckSumCombine(retval, m_low);
-    CheckSums::CheckSumCombine(retval, m_high);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Turn");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_low, m_high);
 
     TraceLogger(conditions) << "GetCheckSum(Turn): retval: " << retval;
     return retval;
@@ -650,15 +1040,10 @@ SortedNumberOf::SortedNumberOf(std::unique_ptr<ValueRef::ValueRef<int>>&& number
     m_condition(std::move(condition))
 {
     std::array<const ValueRef::ValueRefBase*, 2> operands = {{m_number.get(), m_sort_key.get()}};
-    m_root_candidate_invariant =
-        boost::algorithm::all_of(operands, [](const auto& e) { return !e || e->RootCandidateInvariant(); }) &&
-        (!m_condition || m_condition->RootCandidateInvariant());
-    m_target_invariant =
-        boost::algorithm::all_of(operands, [](const auto& e) { return !e || e->TargetInvariant(); }) &&
-        (!m_condition || m_condition->TargetInvariant());
-    m_source_invariant =
-        boost::algorithm::all_of(operands, [](const auto& e) { return !e || e->SourceInvariant(); }) &&
-        (!m_condition || m_condition->SourceInvariant());
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0] && (!m_condition || m_condition->RootCandidateInvariant());
+    m_target_invariant = invariants[1] && (!m_condition || m_condition->TargetInvariant());
+    m_source_invariant = invariants[2] && (!m_condition || m_condition->SourceInvariant());
 }
 
 bool SortedNumberOf::operator==(const Condition& rhs) const {
@@ -1034,22 +1419,15 @@ void SortedNumberOf::GetDefaultInitialCandidateObjects(const ScriptingContext& p
 }
 
 void SortedNumberOf::SetTopLevelContent(const std::string& content_name) {
-    if (m_number)
-        m_number->SetTopLevelContent(content_name);
-    if (m_sort_key)
-        m_sort_key->SetTopLevelContent(content_name);
-    if (m_condition)
-        m_condition->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_number, m_sort_key, m_condition);
 }
 
 unsigned int SortedNumberOf::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::SortedNumberOf");
-    CheckSums::CheckSumCombine(retval, m_number);
-    CheckSums::CheckSumCombine(retval, m_sort_key);
-    CheckSums::CheckSumCombine(retval, m_sorting_method);
-    CheckSums::CheckSumCombine(retval, m_condition);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::SortedNumberOf");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_number, m_sort_key, m_sorting_method,
+                               m_condition);
 
     TraceLogger(conditions) << "GetCheckSum(SortedNumberOf): retval: " << retval;
     return retval;
@@ -1077,8 +1455,7 @@ void All::Eval(const ScriptingContext& parent_context,
 {
     if (search_domain == SearchDomain::NON_MATCHES) {
         // move all objects from non_matches to matches
-        matches.insert(matches.end(), non_matches.begin(), non_matches.end());
-        non_matches.clear();
+        MoveAll(non_matches, matches);
     }
     // if search_comain is MATCHES, do nothing: all objects in matches set
     // match this condition, so should remain in matches set
@@ -1099,7 +1476,8 @@ std::string All::Dump(unsigned short ntabs) const
 unsigned int All::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::All");
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::All");
+    CheckSums::CheckSumCombine(retval, tag_checksum);
 
     TraceLogger(conditions) << "GetCheckSum(All): retval: " << retval;
     return retval;
@@ -1123,8 +1501,7 @@ void None::Eval(const ScriptingContext& parent_context,
 {
     if (search_domain == SearchDomain::MATCHES) {
         // move all objects from matches to non_matches
-        non_matches.insert(non_matches.end(), matches.begin(), matches.end());
-        matches.clear();
+        MoveAll(matches, non_matches);
     }
     // if search domain is non_matches, no need to do anything since none of them match None.
 }
@@ -1144,7 +1521,8 @@ std::string None::Dump(unsigned short ntabs) const
 unsigned int None::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::None");
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::None");
+    CheckSums::CheckSumCombine(retval, tag_checksum);
 
     TraceLogger(conditions) << "GetCheckSum(None): retval: " << retval;
     return retval;
@@ -1182,7 +1560,8 @@ std::string NoOp::Dump(unsigned short ntabs) const
 unsigned int NoOp::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::NoOp");
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::NoOp");
+    CheckSums::CheckSumCombine(retval, tag_checksum);
 
     TraceLogger(conditions) << "GetCheckSum(NoOp): retval: " << retval;
     return retval;
@@ -1229,108 +1608,113 @@ bool EmpireAffiliation::operator==(const Condition& rhs) const {
 }
 
 namespace {
+    // is it necessary to evaluate and pass in a non-default empire id?
+    constexpr bool AffiliationTypeUsesEmpireID(EmpireAffiliationType affiliation) {
+        switch (affiliation) {
+        case EmpireAffiliationType::AFFIL_SELF:
+        case EmpireAffiliationType::AFFIL_ENEMY:
+        case EmpireAffiliationType::AFFIL_PEACE:
+        case EmpireAffiliationType::AFFIL_ALLY:
+            return true;
+        case EmpireAffiliationType::AFFIL_ANY:
+        case EmpireAffiliationType::AFFIL_NONE:
+        case EmpireAffiliationType::AFFIL_CAN_SEE: // TODO: update once implemented below
+        case EmpireAffiliationType::AFFIL_HUMAN:
+        default:
+            return false;
+        }
+    }
+
+    // matcher specialized on the affiliation type, which is fixed per
+    // Condition instance, so each instantiation compiles to a straight-line
+    // predicate instead of re-branching on the affiliation per candidate
+    template <EmpireAffiliationType AFFILIATION>
     struct EmpireAffiliationSimpleMatch {
-        EmpireAffiliationSimpleMatch(int empire_id, EmpireAffiliationType affiliation,
-                                     const ScriptingContext& context) :
+        EmpireAffiliationSimpleMatch(int empire_id, const ScriptingContext& context) :
             m_empire_id(empire_id),
-            m_affiliation(affiliation),
             m_context(context)
         {}
 
-        EmpireAffiliationSimpleMatch(EmpireAffiliationType affiliation,
-                                     const ScriptingContext& context) :
-            m_affiliation(affiliation),
+        explicit EmpireAffiliationSimpleMatch(const ScriptingContext& context) :
             m_context(context)
         {}
 
-        // is it necessary to evaluate and pass in a non-default empire id?
-        static bool AffiliationTypeUsesEmpireID(EmpireAffiliationType affiliation) {
-            switch (affiliation) {
-            case EmpireAffiliationType::AFFIL_SELF:
-            case EmpireAffiliationType::AFFIL_ENEMY:
-            case EmpireAffiliationType::AFFIL_PEACE:
-            case EmpireAffiliationType::AFFIL_ALLY:
-                return true;
-            case EmpireAffiliationType::AFFIL_ANY:
-            case EmpireAffiliationType::AFFIL_NONE:
-            case EmpireAffiliationType::AFFIL_CAN_SEE: // TODO: update once implemented below
-            case EmpireAffiliationType::AFFIL_HUMAN:
-            default:
-                return false;
-            }
-        }
-
         bool operator()(const UniverseObject* candidate) const {
             if (!candidate)
                 return false;
 
-            switch (m_affiliation) {
-            case EmpireAffiliationType::AFFIL_SELF:
+            if constexpr (AFFILIATION == EmpireAffiliationType::AFFIL_SELF) {
                 return m_empire_id != ALL_EMPIRES && candidate->OwnedBy(m_empire_id);
-                break;
 
-            case EmpireAffiliationType::AFFIL_ENEMY: {
+            } else if constexpr (AFFILIATION == EmpireAffiliationType::AFFIL_ENEMY) {
                 if (m_empire_id == ALL_EMPIRES)
                     return true;
                 if (m_empire_id == candidate->Owner())
                     return false;
                 DiplomaticStatus status = m_context.ContextDiploStatus(m_empire_id, candidate->Owner());
                 return (status == DiplomaticStatus::DIPLO_WAR);
-                break;
-            }
 
-            case EmpireAffiliationType::AFFIL_PEACE: {
+            } else if constexpr (AFFILIATION == EmpireAffiliationType::AFFIL_PEACE) {
                 if (m_empire_id == ALL_EMPIRES)
                     return false;
                 if (m_empire_id == candidate->Owner())
                     return false;
                 DiplomaticStatus status = m_context.ContextDiploStatus(m_empire_id, candidate->Owner());
                 return (status == DiplomaticStatus::DIPLO_PEACE);
-                break;
-            }
 
-            case EmpireAffiliationType::AFFIL_ALLY: {
+            } else if constexpr (AFFILIATION == EmpireAffiliationType::AFFIL_ALLY) {
                 if (m_empire_id == ALL_EMPIRES)
                     return false;
                 if (m_empire_id == candidate->Owner())
                     return false;
                 DiplomaticStatus status = m_context.ContextDiploStatus(m_empire_id, candidate->Owner());
                 return (status >= DiplomaticStatus::DIPLO_ALLIED);
-                break;
-            }
 
-            case EmpireAffiliationType::AFFIL_ANY:
+            } else if constexpr (AFFILIATION == EmpireAffiliationType::AFFIL_ANY) {
                 return !candidate->Unowned();
-                break;
 
-            case EmpireAffiliationType::AFFIL_NONE:
+            } else if constexpr (AFFILIATION == EmpireAffiliationType::AFFIL_NONE) {
                 return candidate->Unowned();
-                break;
 
-            case EmpireAffiliationType::AFFIL_CAN_SEE: {
+            } else if constexpr (AFFILIATION == EmpireAffiliationType::AFFIL_CAN_SEE) {
                 return false; // TODO
-                break;
-            }
 
-            case EmpireAffiliationType::AFFIL_HUMAN: {
+            } else if constexpr (AFFILIATION == EmpireAffiliationType::AFFIL_HUMAN) {
                 if (candidate->Unowned())
                     return false;
                 if (GetEmpireClientType(candidate->Owner()) == Networking::ClientType::CLIENT_TYPE_HUMAN_PLAYER)
                     return true;
                 return false;
-                break;
-            }
 
-            default:
+            } else {
                 return false;
-                break;
             }
         }
 
         int m_empire_id = ALL_EMPIRES;
-        EmpireAffiliationType m_affiliation;
         const ScriptingContext& m_context;
     };
+
+    // selects the matcher instantiation for \a affiliation once and passes
+    // it to \a func, so callers dispatch on the affiliation a single time
+    // rather than per candidate
+    template <typename Func>
+    auto DispatchAffiliation(EmpireAffiliationType affiliation, int empire_id,
+                             const ScriptingContext& context, Func&& func)
+    {
+        using EAT = EmpireAffiliationType;
+        switch (affiliation) {
+        case EAT::AFFIL_SELF:    return func(EmpireAffiliationSimpleMatch<EAT::AFFIL_SELF>(empire_id, context));
+        case EAT::AFFIL_ENEMY:   return func(EmpireAffiliationSimpleMatch<EAT::AFFIL_ENEMY>(empire_id, context));
+        case EAT::AFFIL_PEACE:   return func(EmpireAffiliationSimpleMatch<EAT::AFFIL_PEACE>(empire_id, context));
+        case EAT::AFFIL_ALLY:    return func(EmpireAffiliationSimpleMatch<EAT::AFFIL_ALLY>(empire_id, context));
+        case EAT::AFFIL_ANY:     return func(EmpireAffiliationSimpleMatch<EAT::AFFIL_ANY>(context));
+        case EAT::AFFIL_NONE:    return func(EmpireAffiliationSimpleMatch<EAT::AFFIL_NONE>(context));
+        case EAT::AFFIL_HUMAN:   return func(EmpireAffiliationSimpleMatch<EAT::AFFIL_HUMAN>(context));
+        case EAT::AFFIL_CAN_SEE:
+        default:                 return func(EmpireAffiliationSimpleMatch<EAT::AFFIL_CAN_SEE>(context)); // never matches
+        }
+    }
 }
 
 void EmpireAffiliation::Eval(const ScriptingContext& parent_context,
@@ -1343,8 +1727,9 @@ void EmpireAffiliation::Eval(const ScriptingContext& parent_context,
     if (simple_eval_safe) {
         // evaluate empire id once, and use to check all candidate objects
         int empire_id = m_empire_id ? m_empire_id->Eval(parent_context) : ALL_EMPIRES;
-        EvalImpl(matches, non_matches, search_domain,
-                 EmpireAffiliationSimpleMatch(empire_id, m_affiliation, parent_context));
+        DispatchAffiliation(m_affiliation, empire_id, parent_context,
+                            [&](const auto& matcher)
+                            { EvalImpl(matches, non_matches, search_domain, matcher); });
     } else {
         // re-evaluate empire id for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -1433,25 +1818,21 @@ bool EmpireAffiliation::Match(const ScriptingContext& local_context) const {
         ErrorLogger(conditions) << "EmpireAffiliation::Match passed no candidate object";
         return false;
     }
-    if (EmpireAffiliationSimpleMatch::AffiliationTypeUsesEmpireID(m_affiliation) && m_empire_id) {
-        int empire_id = m_empire_id->Eval(local_context);
-        return EmpireAffiliationSimpleMatch(empire_id, m_affiliation, local_context)(candidate);
-    } else {
-        return EmpireAffiliationSimpleMatch(m_affiliation, local_context)(candidate);
-    }
+    int empire_id = (AffiliationTypeUsesEmpireID(m_affiliation) && m_empire_id) ?
+        m_empire_id->Eval(local_context) : ALL_EMPIRES;
+    return DispatchAffiliation(m_affiliation, empire_id, local_context,
+                               [candidate](const auto& matcher) { return matcher(candidate); });
 }
 
 void EmpireAffiliation::SetTopLevelContent(const std::string& content_name) {
-    if (m_empire_id)
-        m_empire_id->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_empire_id);
 }
 
 unsigned int EmpireAffiliation::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::EmpireAffiliation");
-    CheckSums::CheckSumCombine(retval, m_empire_id);
-    CheckSums::CheckSumCombine(retval, m_affiliation);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::EmpireAffiliation");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_empire_id, m_affiliation);
 
     TraceLogger(conditions) << "GetCheckSum(EmpireAffiliation): retval: " << retval;
     return retval;
@@ -1499,7 +1880,8 @@ void Source::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_co
 unsigned int Source::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Source");
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Source");
+    CheckSums::CheckSumCombine(retval, tag_checksum);
 
     TraceLogger(conditions) << "GetCheckSum(Source): retval: " << retval;
     return retval;
@@ -1545,7 +1927,8 @@ void RootCandidate::GetDefaultInitialCandidateObjects(const ScriptingContext& pa
 unsigned int RootCandidate::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::RootCandidate");
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::RootCandidate");
+    CheckSums::CheckSumCombine(retval, tag_checksum);
 
     TraceLogger(conditions) << "GetCheckSum(RootCandidate): retval: " << retval;
     return retval;
@@ -1591,7 +1974,8 @@ void Target::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_co
 unsigned int Target::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Target");
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Target");
+    CheckSums::CheckSumCombine(retval, tag_checksum);
 
     TraceLogger(conditions) << "GetCheckSum(Target): retval: " << retval;
     return retval;
@@ -1610,9 +1994,11 @@ Homeworld::Homeworld() :
 Homeworld::Homeworld(std::vector<std::unique_ptr<ValueRef::ValueRef<std::string>>>&& names) :
     m_names(std::move(names))
 {
-    m_root_candidate_invariant = boost::algorithm::all_of(m_names, [](auto& e){ return e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(m_names, [](auto& e){ return e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(m_names, [](auto& e){ return e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(m_names);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    m_refs_local_invariant = invariants[3];
 }
 
 bool Homeworld::operator==(const Condition& rhs) const {
@@ -1646,8 +2032,12 @@ namespace {
         return INVALID_OBJECT_ID;
     }
 
+    // most Homeworld conditions specify at most a few species, so keep the
+    // evaluated names inline rather than in a separately-allocated vector
+    using HomeworldNamesVec = boost::container::small_vector<std::string, 4>;
+
     struct HomeworldSimpleMatch {
-        HomeworldSimpleMatch(std::vector<std::string> names, const ObjectMap& objects,
+        HomeworldSimpleMatch(HomeworldNamesVec names, const ObjectMap& objects,
                              const SpeciesManager& species) :
             m_names(std::move(names)),
             m_objects(objects),
@@ -1686,7 +2076,7 @@ namespace {
             return false;
         }
 
-        const std::vector<std::string> m_names;
+        const HomeworldNamesVec m_names;
         const ObjectMap& m_objects;
         const std::map<std::string, std::set<int>>& m_species_homeworlds;
     };
@@ -1696,19 +2086,11 @@ void Homeworld::Eval(const ScriptingContext& parent_context,
                      ObjectSet& matches, ObjectSet& non_matches,
                      SearchDomain search_domain) const
 {
-    bool simple_eval_safe = parent_context.condition_root_candidate || RootCandidateInvariant();
-    if (simple_eval_safe) {
-        // check each valueref for invariance to local candidate
-        for (auto& name : m_names) {
-            if (!name->LocalCandidateInvariant()) {
-                simple_eval_safe = false;
-                break;
-            }
-        }
-    }
+    bool simple_eval_safe = m_refs_local_invariant &&
+        (parent_context.condition_root_candidate || RootCandidateInvariant());
     if (simple_eval_safe) {
         // evaluate names once, and use to check all candidate objects
-        std::vector<std::string> names;
+        HomeworldNamesVec names;
         names.reserve(m_names.size());
         // get all names from valuerefs
         for (auto& name : m_names)
@@ -1801,8 +2183,8 @@ void Homeworld::SetTopLevelContent(const std::string& content_name) {
 unsigned int Homeworld::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Homeworld");
-    CheckSums::CheckSumCombine(retval, m_names);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Homeworld");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_names);
 
     TraceLogger(conditions) << "GetCheckSum(Homeworld): retval: " << retval;
     return retval;
@@ -1909,7 +2291,8 @@ void Capital::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_c
 unsigned int Capital::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Capital");
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Capital");
+    CheckSums::CheckSumCombine(retval, tag_checksum);
 
     TraceLogger(conditions) << "GetCheckSum(Capital): retval: " << retval;
     return retval;
@@ -1962,7 +2345,8 @@ void Monster::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_c
 unsigned int Monster::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Monster");
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Monster");
+    CheckSums::CheckSumCombine(retval, tag_checksum);
 
     TraceLogger(conditions) << "GetCheckSum(Monster): retval: " << retval;
     return retval;
@@ -2011,7 +2395,8 @@ bool Armed::Match(const ScriptingContext& local_context) const {
 unsigned int Armed::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Armed");
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Armed");
+    CheckSums::CheckSumCombine(retval, tag_checksum);
 
     TraceLogger(conditions) << "GetCheckSum(Armed): retval: " << retval;
     return retval;
@@ -2187,15 +2572,14 @@ void Type::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_cont
 }
 
 void Type::SetTopLevelContent(const std::string& content_name) {
-    if (m_type)
-        m_type->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_type);
 }
 
 unsigned int Type::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Type");
-    CheckSums::CheckSumCombine(retval, m_type);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Type");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_type);
 
     TraceLogger(conditions) << "GetCheckSum(Type): retval: " << retval;
     return retval;
@@ -2210,9 +2594,17 @@ std::unique_ptr<Condition> Type::Clone() const
 Building::Building(std::vector<std::unique_ptr<ValueRef::ValueRef<std::string>>>&& names) :
     m_names(std::move(names))
 {
-    m_root_candidate_invariant = boost::algorithm::all_of(m_names, [](auto& e){ return e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(m_names, [](auto& e){ return e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(m_names, [](auto& e){ return e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(m_names);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    m_refs_local_invariant = invariants[3];
+    m_names_constant = boost::algorithm::all_of(m_names, [](auto& e){ return e->ConstantExpr(); });
+    if (m_names_constant) {
+        m_const_name_ids.reserve(m_names.size());
+        for (auto& name : m_names)
+            m_const_name_ids.push_back(StringInterning::InternedID(name->Eval()));
+    }
 }
 
 bool Building::operator==(const Condition& rhs) const {
@@ -2233,56 +2625,71 @@ bool Building::operator==(const Condition& rhs) const {
 }
 
 namespace {
-    template <typename N> struct BuildingSimpleMatch {};
-
-    template<>
-    struct BuildingSimpleMatch<std::string>
-    {
-        BuildingSimpleMatch(const std::string& name) :
-            m_name(name)
-        {}
-
-        bool operator()(const UniverseObject* candidate) const {
-            if (!candidate)
-                return false;
-
-            // is it a building?
-            if (candidate->ObjectType() != UniverseObjectType::OBJ_BUILDING)
-                return false;
-            auto* building = static_cast<const ::Building*>(candidate);
+    // returns true iff \a key appears among the \a n IDs at \a ids.
+    // multi-name conditions check every candidate's interned type ID
+    // against this list, so the scan is worth vectorizing
+    bool ContainsU32Scalar(const uint32_t* ids, std::size_t n, uint32_t key) {
+        for (std::size_t i = 0; i < n; ++i)
+            if (ids[i] == key)
+                return true;
+        return false;
+    }
 
-            return building->BuildingTypeName() == m_name;
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    // compiled for AVX2 regardless of the baseline target; only called
+    // after the runtime check below confirms the CPU supports it, so the
+    // same binary runs on pre-AVX2 hardware via the scalar fallback
+    __attribute__((target("avx2")))
+    bool ContainsU32AVX2(const uint32_t* ids, std::size_t n, uint32_t key) {
+        std::size_t i = 0;
+        const __m256i key8 = _mm256_set1_epi32(static_cast<int>(key));
+        for (; i + 8 <= n; i += 8) {
+            __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ids + i));
+            __m256i eq = _mm256_cmpeq_epi32(chunk, key8);
+            if (_mm256_movemask_epi8(eq))
+                return true;
         }
+        for (; i < n; ++i)
+            if (ids[i] == key)
+                return true;
+        return false;
+    }
 
-        const std::string& m_name;
-    };
+    // resolved once at startup; call sites stay free of ifdefs
+    bool (*const ContainsU32)(const uint32_t*, std::size_t, uint32_t) =
+        __builtin_cpu_supports("avx2") ? &ContainsU32AVX2 : &ContainsU32Scalar;
+#else
+    inline bool ContainsU32(const uint32_t* ids, std::size_t n, uint32_t key)
+    { return ContainsU32Scalar(ids, n, key); }
+#endif
 
-    template<>
-    struct BuildingSimpleMatch<std::vector<std::string>>
+    // scratch space for per-Eval interned name IDs; conditions list at most
+    // a handful of names, so this avoids a heap allocation per evaluation
+    using NameIDsVec = boost::container::small_vector<uint32_t, 8>;
+
+    // the allowed building type names are evaluated and interned once per
+    // Eval, so the per-candidate check compares small integers rather than
+    // strings. views \a count IDs at \a name_ids, which must outlive the
+    // functor; with a single ID the scan degenerates to one comparison
+    struct BuildingSimpleMatch
     {
-        BuildingSimpleMatch(const std::vector<std::string>& names) :
-            m_names(names)
+        BuildingSimpleMatch(const uint32_t* name_ids, std::size_t count) :
+            m_name_ids(name_ids),
+            m_count(count)
         {}
 
-        bool operator()(const UniverseObject* candidate) const {
-            if (!candidate)
-                return false;
-
-            // is it a building?
-            if (candidate->ObjectType() != UniverseObjectType::OBJ_BUILDING)
-                return false;
-            auto* building = static_cast<const ::Building*>(candidate);
-
+        // candidate null and type checks are done by EvalTypedImpl
+        bool operator()(const ::Building* building) const {
             // if no name supplied, match any building
-            if (m_names.empty())
+            if (m_count == 0)
                 return true;
 
             // is it one of the specified building types?
-            return std::find(m_names.begin(), m_names.end(), building->BuildingTypeName()) != m_names.end();
-            //return std::count(m_names.begin(), m_names.end(), building->BuildingTypeName());
+            return ContainsU32(m_name_ids, m_count, building->BuildingTypeID());
         }
 
-        const std::vector<std::string>& m_names;
+        const uint32_t* m_name_ids;
+        std::size_t     m_count;
     };
 }
 
@@ -2290,29 +2697,24 @@ void Building::Eval(const ScriptingContext& parent_context,
                     ObjectSet& matches, ObjectSet& non_matches,
                     SearchDomain search_domain) const
 {
-    bool simple_eval_safe = parent_context.condition_root_candidate || RootCandidateInvariant();
-    if (simple_eval_safe) {
-        // check each valueref for invariance to local candidate
-        for (auto& name : m_names) {
-            if (!name->LocalCandidateInvariant()) {
-                simple_eval_safe = false;
-                break;
-            }
-        }
-    }
+    bool simple_eval_safe = m_refs_local_invariant &&
+        (parent_context.condition_root_candidate || RootCandidateInvariant());
     if (simple_eval_safe) {
-        if (m_names.size() == 1) {
-            auto match_name = m_names.front()->Eval(parent_context);
-            EvalImpl(matches, non_matches, search_domain, BuildingSimpleMatch<std::string>(match_name));
-        } else {
-            // evaluate names once, and use to check all candidate objects
-            std::vector<std::string> names;
-            names.reserve(m_names.size());
+        // evaluate names once and intern them, so the per-candidate check
+        // is an integer scan instead of string comparisons; constant name
+        // IDs were pre-evaluated at construction
+        NameIDsVec name_ids;
+        if (!m_names_constant) {
+            name_ids.reserve(m_names.size());
             // get all names from valuerefs
             for (auto& name : m_names)
-                names.push_back(name->Eval(parent_context));
-            EvalImpl(matches, non_matches, search_domain, BuildingSimpleMatch<std::vector<std::string>>(names));
+                name_ids.push_back(StringInterning::InternedID(name->Eval(parent_context)));
         }
+        const uint32_t* ids = m_names_constant ? m_const_name_ids.data() : name_ids.data();
+        std::size_t count = m_names_constant ? m_const_name_ids.size() : name_ids.size();
+        EvalTypedImpl<::Building>(matches, non_matches, search_domain,
+                                  UniverseObjectType::OBJ_BUILDING,
+                                  BuildingSimpleMatch(ids, count));
     } else {
         // re-evaluate allowed building types range for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -2321,6 +2723,7 @@ void Building::Eval(const ScriptingContext& parent_context,
 
 std::string Building::Description(bool negated) const {
     std::string values_str;
+    values_str.reserve(m_names.size() * 16);    // rough guess at name lengths
     for (unsigned int i = 0; i < m_names.size(); ++i) {
         values_str += m_names[i]->ConstantExpr() ?
                         UserString(m_names[i]->Eval()) :
@@ -2340,13 +2743,18 @@ std::string Building::Description(bool negated) const {
 }
 
 std::string Building::Dump(unsigned short ntabs) const {
-    std::string retval = DumpIndent(ntabs) + "Building name = ";
+    std::string retval;
+    retval.reserve(ntabs * 4 + 20 + m_names.size() * 16);   // rough guess at name lengths
+    retval += DumpIndent(ntabs);
+    retval += "Building name = ";
     if (m_names.size() == 1) {
-        retval += m_names[0]->Dump(ntabs) + "\n";
+        retval += m_names[0]->Dump(ntabs);
+        retval += "\n";
     } else {
         retval += "[ ";
         for (auto& name : m_names) {
-            retval += name->Dump(ntabs) + " ";
+            retval += name->Dump(ntabs);
+            retval += " ";
         }
         retval += "]\n";
     }
@@ -2388,13 +2796,30 @@ void Building::SetTopLevelContent(const std::string& content_name) {
         if (name)
             name->SetTopLevelContent(content_name);
     }
+    // substituted "CurrentContent" names may only now report constant
+    m_names_constant = boost::algorithm::all_of(m_names, [](auto& e){ return e->ConstantExpr(); });
+    m_const_name_ids.clear();
+    if (m_names_constant) {
+        m_const_name_ids.reserve(m_names.size());
+        for (auto& name : m_names)
+            m_const_name_ids.push_back(StringInterning::InternedID(name->Eval()));
+    }
+    m_checksum_cached.store(false); // content substitution can change the operands' checksums
 }
 
 unsigned int Building::GetCheckSum() const {
+    // operands only change via SetTopLevelContent, which invalidates the
+    // cache, so the checksum can be memoized
+    if (m_checksum_cached.load())
+        return m_cached_checksum.load();
+
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Building");
-    CheckSums::CheckSumCombine(retval, m_names);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Building");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_names);
+
+    m_cached_checksum.store(retval);
+    m_checksum_cached.store(true);
 
     TraceLogger(conditions) << "GetCheckSum(Building): retval: " << retval;
     return retval;
@@ -2403,15 +2828,35 @@ unsigned int Building::GetCheckSum() const {
 std::unique_ptr<Condition> Building::Clone() const
 { return std::make_unique<Building>(ValueRef::CloneUnique(m_names)); }
 
+std::unique_ptr<Condition> Building::TryFuseOr(const Condition& next) const {
+    const auto* other = dynamic_cast<const Building*>(&next);
+    // an empty name list matches any building, which a merged list could not express
+    if (!other || m_names.empty() || other->m_names.empty())
+        return nullptr;
+    auto names = ValueRef::CloneUnique(m_names);
+    auto other_names = ValueRef::CloneUnique(other->m_names);
+    names.reserve(names.size() + other_names.size());
+    std::move(other_names.begin(), other_names.end(), std::back_inserter(names));
+    return std::make_unique<Building>(std::move(names));
+}
+
 ///////////////////////////////////////////////////////////
 // Field                                                 //
 ///////////////////////////////////////////////////////////
 Field::Field(std::vector<std::unique_ptr<ValueRef::ValueRef<std::string>>>&& names) :
     m_names(std::move(names))
 {
-    m_root_candidate_invariant = boost::algorithm::all_of(m_names, [](auto& e){ return e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(m_names, [](auto& e){ return e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(m_names, [](auto& e){ return e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(m_names);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    m_refs_local_invariant = invariants[3];
+    m_names_constant = boost::algorithm::all_of(m_names, [](auto& e){ return e->ConstantExpr(); });
+    if (m_names_constant) {
+        m_const_name_ids.reserve(m_names.size());
+        for (auto& name : m_names)
+            m_const_name_ids.push_back(StringInterning::InternedID(name->Eval()));
+    }
 }
 
 bool Field::operator==(const Condition& rhs) const {
@@ -2432,29 +2877,26 @@ bool Field::operator==(const Condition& rhs) const {
 }
 
 namespace {
+    // views \a count IDs at \a name_ids, which must outlive the functor;
+    // with a single ID the scan degenerates to one comparison
     struct FieldSimpleMatch {
-        FieldSimpleMatch(const std::vector<std::string>& names) :
-            m_names(names)
+        FieldSimpleMatch(const uint32_t* name_ids, std::size_t count) :
+            m_name_ids(name_ids),
+            m_count(count)
         {}
 
-        bool operator()(const UniverseObject* candidate) const {
-            if (!candidate)
-                return false;
-
-            // is it a field?
-            if (candidate->ObjectType() != UniverseObjectType::OBJ_FIELD)
-                return false;
-            auto* field = static_cast<const ::Field*>(candidate);
-
+        // candidate null and type checks are done by EvalTypedImpl
+        bool operator()(const ::Field* field) const {
             // if no name supplied, match any field
-            if (m_names.empty())
+            if (m_count == 0)
                 return true;
 
             // is it one of the specified field types?
-            return std::count(m_names.begin(), m_names.end(), field->FieldTypeName());
+            return ContainsU32(m_name_ids, m_count, field->FieldTypeID());
         }
 
-        const std::vector<std::string>& m_names;
+        const uint32_t* m_name_ids;
+        std::size_t     m_count;
     };
 }
 
@@ -2462,24 +2904,23 @@ void Field::Eval(const ScriptingContext& parent_context,
                  ObjectSet& matches, ObjectSet& non_matches,
                  SearchDomain search_domain) const
 {
-    bool simple_eval_safe = parent_context.condition_root_candidate || RootCandidateInvariant();
+    bool simple_eval_safe = m_refs_local_invariant &&
+        (parent_context.condition_root_candidate || RootCandidateInvariant());
     if (simple_eval_safe) {
-        // check each valueref for invariance to local candidate
-        for (auto& name : m_names) {
-            if (!name->LocalCandidateInvariant()) {
-                simple_eval_safe = false;
-                break;
-            }
+        // evaluate names once and intern them, so the per-candidate check
+        // is an integer scan instead of string comparisons; constant name
+        // IDs were pre-evaluated at construction
+        NameIDsVec name_ids;
+        if (!m_names_constant) {
+            name_ids.reserve(m_names.size());
+            // get all names from valuerefs
+            for (auto& name : m_names)
+                name_ids.push_back(StringInterning::InternedID(name->Eval(parent_context)));
         }
-    }
-    if (simple_eval_safe) {
-        // evaluate names once, and use to check all candidate objects
-        std::vector<std::string> names;
-        names.reserve(m_names.size());
-        // get all names from valuerefs
-        for (auto& name : m_names)
-            names.push_back(name->Eval(parent_context));
-        EvalImpl(matches, non_matches, search_domain, FieldSimpleMatch(names));
+        const uint32_t* ids = m_names_constant ? m_const_name_ids.data() : name_ids.data();
+        std::size_t count = m_names_constant ? m_const_name_ids.size() : name_ids.size();
+        EvalTypedImpl<::Field>(matches, non_matches, search_domain,
+                               UniverseObjectType::OBJ_FIELD, FieldSimpleMatch(ids, count));
     } else {
         // re-evaluate allowed field types range for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -2488,6 +2929,7 @@ void Field::Eval(const ScriptingContext& parent_context,
 
 std::string Field::Description(bool negated) const {
     std::string values_str;
+    values_str.reserve(m_names.size() * 16);    // rough guess at name lengths
     for (unsigned int i = 0; i < m_names.size(); ++i) {
         values_str += m_names[i]->ConstantExpr() ?
                         UserString(m_names[i]->Eval()) :
@@ -2507,13 +2949,18 @@ std::string Field::Description(bool negated) const {
 }
 
 std::string Field::Dump(unsigned short ntabs) const {
-    std::string retval = DumpIndent(ntabs) + "Field name = ";
+    std::string retval;
+    retval.reserve(ntabs * 4 + 20 + m_names.size() * 16);   // rough guess at name lengths
+    retval += DumpIndent(ntabs);
+    retval += "Field name = ";
     if (m_names.size() == 1) {
-        retval += m_names[0]->Dump(ntabs) + "\n";
+        retval += m_names[0]->Dump(ntabs);
+        retval += "\n";
     } else {
         retval += "[ ";
         for (auto& name : m_names) {
-            retval += name->Dump(ntabs) + " ";
+            retval += name->Dump(ntabs);
+            retval += " ";
         }
         retval += "]\n";
     }
@@ -2541,8 +2988,9 @@ bool Field::Match(const ScriptingContext& local_context) const {
         return true;
 
     // match one of the specified field names
+    const auto& ftn{field->FieldTypeName()};
     for (auto& name : m_names) {
-        if (name->Eval(local_context) == field->FieldTypeName())
+        if (name->Eval(local_context) == ftn)
             return true;
     }
 
@@ -2554,13 +3002,30 @@ void Field::SetTopLevelContent(const std::string& content_name) {
         if (name)
             name->SetTopLevelContent(content_name);
     }
+    // substituted "CurrentContent" names may only now report constant
+    m_names_constant = boost::algorithm::all_of(m_names, [](auto& e){ return e->ConstantExpr(); });
+    m_const_name_ids.clear();
+    if (m_names_constant) {
+        m_const_name_ids.reserve(m_names.size());
+        for (auto& name : m_names)
+            m_const_name_ids.push_back(StringInterning::InternedID(name->Eval()));
+    }
+    m_checksum_cached.store(false); // content substitution can change the operands' checksums
 }
 
 unsigned int Field::GetCheckSum() const {
+    // operands only change via SetTopLevelContent, which invalidates the
+    // cache, so the checksum can be memoized
+    if (m_checksum_cached.load())
+        return m_cached_checksum.load();
+
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Field");
-    CheckSums::CheckSumCombine(retval, m_names);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Field");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_names);
+
+    m_cached_checksum.store(retval);
+    m_checksum_cached.store(true);
 
     TraceLogger(conditions) << "GetCheckSum(Field): retval: " << retval;
     return retval;
@@ -2599,9 +3064,14 @@ HasSpecial::HasSpecial(std::unique_ptr<ValueRef::ValueRef<std::string>>&& name,
 {
     std::array<const ValueRef::ValueRefBase*, 3> operands =
         {{m_name.get(), m_since_turn_low.get(), m_since_turn_high.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    m_refs_local_invariant = invariants[3];
+    m_name_constant = !m_name || m_name->ConstantExpr();
+    if (m_name && m_name_constant)
+        m_const_name = m_name->Eval();
 }
 
 HasSpecial::HasSpecial(std::unique_ptr<ValueRef::ValueRef<std::string>>&& name,
@@ -2613,9 +3083,14 @@ HasSpecial::HasSpecial(std::unique_ptr<ValueRef::ValueRef<std::string>>&& name,
 {
     std::array<const ValueRef::ValueRefBase*, 3> operands =
         {{m_name.get(), m_capacity_low.get(), m_capacity_high.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    m_refs_local_invariant = invariants[3];
+    m_name_constant = !m_name || m_name->ConstantExpr();
+    if (m_name && m_name_constant)
+        m_const_name = m_name->Eval();
 }
 
 HasSpecial::HasSpecial(const HasSpecial& rhs) :
@@ -2624,7 +3099,10 @@ HasSpecial::HasSpecial(const HasSpecial& rhs) :
     m_capacity_low(ValueRef::CloneUnique(rhs.m_capacity_low)),
     m_capacity_high(ValueRef::CloneUnique(rhs.m_capacity_high)),
     m_since_turn_low(ValueRef::CloneUnique(rhs.m_since_turn_low)),
-    m_since_turn_high(ValueRef::CloneUnique(rhs.m_since_turn_high))
+    m_since_turn_high(ValueRef::CloneUnique(rhs.m_since_turn_high)),
+    m_const_name(rhs.m_const_name),
+    m_refs_local_invariant(rhs.m_refs_local_invariant),
+    m_name_constant(rhs.m_name_constant)
 {}
 
 bool HasSpecial::operator==(const Condition& rhs) const {
@@ -2646,9 +3124,13 @@ bool HasSpecial::operator==(const Condition& rhs) const {
 
 namespace {
     struct HasSpecialSimpleMatch {
-        HasSpecialSimpleMatch(const std::string& name, float low_cap, float high_cap,
+        // \a name must outlive this functor; the ObjectSet traversal in
+        // Eval completes before the name buffer goes away
+        HasSpecialSimpleMatch(std::string_view name, float low_cap, float high_cap,
                               int low_turn, int high_turn) :
             m_name(name),
+            m_name_id(StringInterning::InternedID(name)),
+            m_name_bloom(UniverseObject::SpecialNameBloomMask(name)),
             m_low_cap(low_cap),
             m_high_cap(high_cap),
             m_low_turn(low_turn),
@@ -2662,18 +3144,32 @@ namespace {
             if (m_name.empty())
                 return !candidate->Specials().empty();
 
-            auto it = candidate->Specials().find(m_name);
-            if (it == candidate->Specials().end())
+            // most candidates don't have the special: the bloom probe
+            // rejects them without touching the specials entries
+            if ((candidate->SpecialsBloom() & m_name_bloom) != m_name_bloom)
                 return false;
 
-            const auto& [special_since_turn, special_capacity] = it->second;
-            return m_low_turn <= special_since_turn
-                && special_since_turn <= m_high_turn
-                && m_low_cap <= special_capacity
-                && special_capacity <= m_high_cap;
+            // scan the few interned-ID entries instead of a string-keyed
+            // map lookup; this also screens out bloom false positives
+            for (const auto& [special_id, turn_amount] : candidate->SpecialsByInternedID()) {
+                if (special_id != m_name_id)
+                    continue;
+                const auto& [special_since_turn, special_capacity] = turn_amount;
+                // single unsigned compare for the turn range (see
+                // CreatedOnTurnSimpleMatch for the wraparound trick); the
+                // float compares compile to branchless compare+and
+                return (m_low_turn <= m_high_turn)
+                    & (static_cast<unsigned int>(special_since_turn) - static_cast<unsigned int>(m_low_turn)
+                       <= static_cast<unsigned int>(m_high_turn) - static_cast<unsigned int>(m_low_turn))
+                    & (m_low_cap <= special_capacity)
+                    & (special_capacity <= m_high_cap);
+            }
+            return false;
         }
 
-        const std::string&  m_name;
+        std::string_view    m_name;
+        uint32_t            m_name_id;
+        uint64_t            m_name_bloom;
         float               m_low_cap;
         float               m_high_cap;
         int                 m_low_turn;
@@ -2685,15 +3181,16 @@ void HasSpecial::Eval(const ScriptingContext& parent_context,
                       ObjectSet& matches, ObjectSet& non_matches,
                       SearchDomain search_domain) const
 {
-    bool simple_eval_safe = ((!m_name || m_name->LocalCandidateInvariant()) &&
-                             (!m_capacity_low || m_capacity_low->LocalCandidateInvariant()) &&
-                             (!m_capacity_high || m_capacity_high->LocalCandidateInvariant()) &&
-                             (!m_since_turn_low || m_since_turn_low->LocalCandidateInvariant()) &&
-                             (!m_since_turn_high || m_since_turn_high->LocalCandidateInvariant()) &&
-                             (parent_context.condition_root_candidate || RootCandidateInvariant()));
+    bool simple_eval_safe = m_refs_local_invariant &&
+        (parent_context.condition_root_candidate || RootCandidateInvariant());
     if (simple_eval_safe) {
         // evaluate turn limits and capacities once, pass to simple match for all candidates
-        std::string name = (m_name ? m_name->Eval(parent_context) : "");
+        // (when the name is a constant expression it was pre-evaluated at
+        // construction, avoiding a string allocation per evaluation)
+        std::string name_buf;
+        if (!m_name_constant)
+            name_buf = m_name->Eval(parent_context);
+        const std::string& name = m_name_constant ? m_const_name : name_buf;
         float low_cap = (m_capacity_low ? m_capacity_low->Eval(parent_context) : -FLT_MAX);
         float high_cap = (m_capacity_high ? m_capacity_high->Eval(parent_context) : FLT_MAX);
         int low_turn = (m_since_turn_low ? m_since_turn_low->Eval(parent_context) : BEFORE_FIRST_TURN);
@@ -2757,20 +3254,32 @@ std::string HasSpecial::Description(bool negated) const {
 
 std::string HasSpecial::Dump(unsigned short ntabs) const {
     std::string name_str = (m_name ? m_name->Dump(ntabs) : "");
+    std::string retval;
+    retval.reserve(ntabs * 4 + 48 + name_str.size() + 32);  // rough guess at operand lengths
+    retval += DumpIndent(ntabs);
 
     if (m_since_turn_low || m_since_turn_high) {
-        std::string low_dump = (m_since_turn_low ? m_since_turn_low->Dump(ntabs) : std::to_string(BEFORE_FIRST_TURN));
-        std::string high_dump = (m_since_turn_high ? m_since_turn_high->Dump(ntabs) : std::to_string(IMPOSSIBLY_LARGE_TURN));
-        return DumpIndent(ntabs) + "HasSpecialSinceTurn name = \"" + name_str + "\" low = " + low_dump + " high = " + high_dump;
-    }
+        retval += "HasSpecialSinceTurn name = \"";
+        retval += name_str;
+        retval += "\" low = ";
+        retval += (m_since_turn_low ? m_since_turn_low->Dump(ntabs) : std::to_string(BEFORE_FIRST_TURN));
+        retval += " high = ";
+        retval += (m_since_turn_high ? m_since_turn_high->Dump(ntabs) : std::to_string(IMPOSSIBLY_LARGE_TURN));
+
+    } else if (m_capacity_low || m_capacity_high) {
+        retval += "HasSpecialCapacity name = \"";
+        retval += name_str;
+        retval += "\" low = ";
+        retval += (m_capacity_low ? m_capacity_low->Dump(ntabs) : std::to_string(-FLT_MAX));
+        retval += " high = ";
+        retval += (m_capacity_high ? m_capacity_high->Dump(ntabs) : std::to_string(FLT_MAX));
 
-    if (m_capacity_low || m_capacity_high) {
-        std::string low_dump = (m_capacity_low ? m_capacity_low->Dump(ntabs) : std::to_string(-FLT_MAX));
-        std::string high_dump = (m_capacity_high ? m_capacity_high->Dump(ntabs) : std::to_string(FLT_MAX));
-        return DumpIndent(ntabs) + "HasSpecialCapacity name = \"" + name_str + "\" low = " + low_dump + " high = " + high_dump;
+    } else {
+        retval += "HasSpecial name = \"";
+        retval += name_str;
+        retval += "\"\n";
     }
-
-    return DumpIndent(ntabs) + "HasSpecial name = \"" + name_str + "\"\n";
+    return retval;
 }
 
 bool HasSpecial::Match(const ScriptingContext& local_context) const {
@@ -2779,7 +3288,10 @@ bool HasSpecial::Match(const ScriptingContext& local_context) const {
         ErrorLogger(conditions) << "HasSpecial::Match passed no candidate object";
         return false;
     }
-    std::string name = (m_name ? m_name->Eval(local_context) : "");
+    std::string name_buf;
+    if (!m_name_constant)
+        name_buf = m_name->Eval(local_context);
+    const std::string& name = m_name_constant ? m_const_name : name_buf;
     float low_cap = (m_capacity_low ? m_capacity_low->Eval(local_context) : -FLT_MAX);
     float high_cap = (m_capacity_high ? m_capacity_high->Eval(local_context) : FLT_MAX);
     int low_turn = (m_since_turn_low ? m_since_turn_low->Eval(local_context) : BEFORE_FIRST_TURN);
@@ -2799,17 +3311,27 @@ void HasSpecial::SetTopLevelContent(const std::string& content_name) {
         m_since_turn_low->SetTopLevelContent(content_name);
     if (m_since_turn_high)
         m_since_turn_high->SetTopLevelContent(content_name);
+    // a substituted "CurrentContent" name may only now report constant
+    m_name_constant = !m_name || m_name->ConstantExpr();
+    if (m_name && m_name_constant)
+        m_const_name = m_name->Eval();
+    m_checksum_cached.store(false); // content substitution can change the operands' checksums
 }
 
 unsigned int HasSpecial::GetCheckSum() const {
+    // operands only change via SetTopLevelContent, which invalidates the
+    // cache, so the checksum can be memoized
+    if (m_checksum_cached.load())
+        return m_cached_checksum.load();
+
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::HasSpecial");
-    CheckSums::CheckSumCombine(retval, m_name);
-    CheckSums::CheckSumCombine(retval, m_capacity_low);
-    CheckSums::CheckSumCombine(retval, m_capacity_high);
-    CheckSums::CheckSumCombine(retval, m_since_turn_low);
-    CheckSums::CheckSumCombine(retval, m_since_turn_high);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::HasSpecial");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_name, m_capacity_low, m_capacity_high,
+                               m_since_turn_low, m_since_turn_high);
+
+    m_cached_checksum.store(retval);
+    m_checksum_cached.store(true);
 
     TraceLogger(conditions) << "GetCheckSum(HasSpecial): retval: " << retval;
     return retval;
@@ -2835,6 +3357,10 @@ HasTag::HasTag(std::unique_ptr<ValueRef::ValueRef<std::string>>&& name) :
     m_root_candidate_invariant = !m_name || m_name->RootCandidateInvariant();
     m_target_invariant = !m_name || m_name->TargetInvariant();
     m_source_invariant = !m_name || m_name->SourceInvariant();
+    m_refs_local_invariant = !m_name || m_name->LocalCandidateInvariant();
+    m_name_constant = m_name && m_name->ConstantExpr();
+    if (m_name_constant)
+        m_const_name = boost::to_upper_copy<std::string>(m_name->Eval());
 }
 
 bool HasTag::operator==(const Condition& rhs) const {
@@ -2854,11 +3380,12 @@ namespace {
     struct HasTagSimpleMatch {
         HasTagSimpleMatch(const ScriptingContext& context) :
             m_any_tag_ok(true),
-            m_name(EMPTY_STRING),
             m_context(context)
         {}
 
-        HasTagSimpleMatch(const std::string& name, const ScriptingContext& context) :
+        // \a name must outlive this functor; the ObjectSet traversal in
+        // Eval completes before the name buffer goes away
+        HasTagSimpleMatch(std::string_view name, const ScriptingContext& context) :
             m_any_tag_ok(false),
             m_name(name),
             m_context(context)
@@ -2868,14 +3395,16 @@ namespace {
             if (!candidate)
                 return false;
 
-            if (m_any_tag_ok && !candidate->Tags(m_context).empty())
-                return true;
+            // when matching any tag, don't also do the (always-failing)
+            // empty-name HasTag lookup
+            if (m_any_tag_ok)
+                return !candidate->Tags(m_context).empty();
 
             return candidate->HasTag(m_name, m_context);
         }
 
         bool                    m_any_tag_ok;
-        const std::string&      m_name;
+        std::string_view        m_name;
         const ScriptingContext& m_context;
     };
 }
@@ -2884,14 +3413,20 @@ void HasTag::Eval(const ScriptingContext& parent_context,
                   ObjectSet& matches, ObjectSet& non_matches,
                   SearchDomain search_domain) const
 {
-    bool simple_eval_safe = (!m_name || m_name->LocalCandidateInvariant()) &&
-                            (parent_context.condition_root_candidate || RootCandidateInvariant());
+    bool simple_eval_safe = m_refs_local_invariant &&
+        (parent_context.condition_root_candidate || RootCandidateInvariant());
     if (simple_eval_safe) {
         // evaluate number limits once, use to match all candidates
         if (!m_name) {
             EvalImpl(matches, non_matches, search_domain, HasTagSimpleMatch(parent_context));
+        } else if (m_name_constant) {
+            // name was evaluated and upper-cased at construction
+            EvalImpl(matches, non_matches, search_domain, HasTagSimpleMatch(m_const_name, parent_context));
         } else {
-            std::string name = boost::to_upper_copy<std::string>(m_name->Eval(parent_context));
+            // upper-case in place rather than via to_upper_copy, which
+            // would allocate a second string
+            std::string name = m_name->Eval(parent_context);
+            boost::to_upper(name);
             EvalImpl(matches, non_matches, search_domain, HasTagSimpleMatch(name, parent_context));
         }
     } else {
@@ -2914,9 +3449,14 @@ std::string HasTag::Description(bool negated) const {
 }
 
 std::string HasTag::Dump(unsigned short ntabs) const {
-    std::string retval = DumpIndent(ntabs) + "HasTag";
-    if (m_name)
-        retval += " name = " + m_name->Dump(ntabs);
+    std::string retval;
+    retval.reserve(ntabs * 4 + 32);     // rough guess at name length
+    retval += DumpIndent(ntabs);
+    retval += "HasTag";
+    if (m_name) {
+        retval += " name = ";
+        retval += m_name->Dump(ntabs);
+    }
     retval += "\n";
     return retval;
 }
@@ -2931,20 +3471,37 @@ bool HasTag::Match(const ScriptingContext& local_context) const {
     if (!m_name)
         return HasTagSimpleMatch(local_context)(candidate);
 
-    std::string name = boost::to_upper_copy<std::string>(m_name->Eval(local_context));
+    if (m_name_constant)
+        return HasTagSimpleMatch(m_const_name, local_context)(candidate);
+
+    std::string name = m_name->Eval(local_context);
+    boost::to_upper(name);
     return HasTagSimpleMatch(name, local_context)(candidate);
 }
 
 void HasTag::SetTopLevelContent(const std::string& content_name) {
     if (m_name)
         m_name->SetTopLevelContent(content_name);
+    // a substituted "CurrentContent" name may only now report constant
+    m_name_constant = m_name && m_name->ConstantExpr();
+    if (m_name_constant)
+        m_const_name = boost::to_upper_copy<std::string>(m_name->Eval());
+    m_checksum_cached.store(false); // content substitution can change the operand's checksum
 }
 
 unsigned int HasTag::GetCheckSum() const {
+    // operands only change via SetTopLevelContent, which invalidates the
+    // cache, so the checksum can be memoized
+    if (m_checksum_cached.load())
+        return m_cached_checksum.load();
+
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::HasTag");
-    CheckSums::CheckSumCombine(retval, m_name);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::HasTag");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_name);
+
+    m_cached_checksum.store(retval);
+    m_checksum_cached.store(true);
 
     TraceLogger(conditions) << "GetCheckSum(HasTag): retval: " << retval;
     return retval;
@@ -2962,9 +3519,11 @@ CreatedOnTurn::CreatedOnTurn(std::unique_ptr<ValueRef::ValueRef<int>>&& low,
     m_high(std::move(high))
 {
     std::array<const ValueRef::ValueRefBase*, 2> operands = {{m_low.get(), m_high.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    m_refs_local_invariant = invariants[3];
 }
 
 bool CreatedOnTurn::operator==(const Condition& rhs) const {
@@ -2985,18 +3544,35 @@ namespace {
     struct CreatedOnTurnSimpleMatch {
         CreatedOnTurnSimpleMatch(int low, int high) :
             m_low(low),
-            m_high(high)
+            m_range(static_cast<unsigned int>(high) - static_cast<unsigned int>(low)),
+            m_nonempty(low <= high)
         {}
 
         bool operator()(const UniverseObject* candidate) const {
             if (!candidate)
                 return false;
             int turn = candidate->CreationTurn();
-            return m_low <= turn && turn <= m_high;
+            // single unsigned compare for low <= turn <= high: if turn < low
+            // the subtraction wraps to a huge value, exceeding the range.
+            // m_nonempty keeps an inverted (empty) range from matching
+            return m_nonempty
+                & (static_cast<unsigned int>(turn) - static_cast<unsigned int>(m_low) <= m_range);
+        }
+
+        // columnar form for EvalColumnImpl: same unsigned-range compare over
+        // a gathered column of creation turns, 8 elements per step via the
+        // dispatched range kernel
+        void operator()(const int* turns, uint8_t* out_flags, std::size_t count) const {
+            if (!m_nonempty) {
+                std::memset(out_flags, 0, count);
+                return;
+            }
+            FlagsInRangeU32(turns, count, m_low, m_range, out_flags);
         }
 
-        int m_low;
-        int m_high;
+        int          m_low;
+        unsigned int m_range;
+        bool         m_nonempty;
     };
 }
 
@@ -3004,13 +3580,14 @@ void CreatedOnTurn::Eval(const ScriptingContext& parent_context,
                          ObjectSet& matches, ObjectSet& non_matches,
                          SearchDomain search_domain) const
 {
-    bool simple_eval_safe = ((!m_low || m_low->LocalCandidateInvariant()) &&
-                             (!m_high || m_high->LocalCandidateInvariant()) &&
-                             (parent_context.condition_root_candidate || RootCandidateInvariant()));
+    bool simple_eval_safe = m_refs_local_invariant &&
+        (parent_context.condition_root_candidate || RootCandidateInvariant());
     if (simple_eval_safe) {
         int low = (m_low ? m_low->Eval(parent_context) : BEFORE_FIRST_TURN);
         int high = (m_high ? m_high->Eval(parent_context) : IMPOSSIBLY_LARGE_TURN);
-        EvalImpl(matches, non_matches, search_domain, CreatedOnTurnSimpleMatch(low, high));
+        EvalColumnImpl<int>(matches, non_matches, search_domain,
+                            [](const UniverseObject* o) { return o->CreationTurn(); },
+                            CreatedOnTurnSimpleMatch(low, high));
     } else {
         // re-evaluate allowed turn range for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -3034,11 +3611,18 @@ std::string CreatedOnTurn::Description(bool negated) const {
 }
 
 std::string CreatedOnTurn::Dump(unsigned short ntabs) const {
-    std::string retval = DumpIndent(ntabs) + "CreatedOnTurn";
-    if (m_low)
-        retval += " low = " + m_low->Dump(ntabs);
-    if (m_high)
-        retval += " high = " + m_high->Dump(ntabs);
+    std::string retval;
+    retval.reserve(ntabs * 4 + 40);     // rough guess at operand lengths
+    retval += DumpIndent(ntabs);
+    retval += "CreatedOnTurn";
+    if (m_low) {
+        retval += " low = ";
+        retval += m_low->Dump(ntabs);
+    }
+    if (m_high) {
+        retval += " high = ";
+        retval += m_high->Dump(ntabs);
+    }
     retval += "\n";
     return retval;
 }
@@ -3062,14 +3646,22 @@ void CreatedOnTurn::SetTopLevelContent(const std::string& content_name) {
         m_low->SetTopLevelContent(content_name);
     if (m_high)
         m_high->SetTopLevelContent(content_name);
+    m_checksum_cached.store(false); // content substitution can change the operands' checksums
 }
 
 unsigned int CreatedOnTurn::GetCheckSum() const {
+    // operands only change via SetTopLevelContent, which invalidates the
+    // cache, so the checksum can be memoized
+    if (m_checksum_cached.load())
+        return m_cached_checksum.load();
+
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::CreatedOnTurn");
-    CheckSums::CheckSumCombine(retval, m_low);
-    CheckSums::CheckSumCombine(retval, m_high);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::CreatedOnTurn");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_low, m_high);
+
+    m_cached_checksum.store(retval);
+    m_checksum_cached.store(true);
 
     TraceLogger(conditions) << "GetCheckSum(CreatedOnTurn): retval: " << retval;
     return retval;
@@ -3105,6 +3697,127 @@ bool Contains::operator==(const Condition& rhs) const {
 }
 
 namespace {
+    /** Sorts object ids with a two-pass 16-bit LSD radix sort. For the
+      * large id vectors big games produce this is roughly twice as fast as
+      * comparison sorting and branchless: each pass is a counting histogram
+      * plus a sequential scatter. The sign bit is flipped so negative ids
+      * (INVALID_OBJECT_ID etc.) order correctly as unsigned keys. */
+    void RadixSortIDs(std::vector<int>& ids) {
+        static thread_local std::vector<uint32_t> scratch;
+        static thread_local std::array<uint32_t, 65536> counts;    // 256 kB histogram, too big for the stack
+        const std::size_t sz = ids.size();
+        scratch.resize(sz);
+
+        counts.fill(0);
+        for (int id : ids)
+            ++counts[(static_cast<uint32_t>(id) ^ 0x80000000u) & 0xffffu];
+        uint32_t sum = 0;
+        for (auto& c : counts) {
+            uint32_t next_sum = sum + c;
+            c = sum;
+            sum = next_sum;
+        }
+        for (int id : ids) {
+            const uint32_t key = static_cast<uint32_t>(id) ^ 0x80000000u;
+            scratch[counts[key & 0xffffu]++] = key;
+        }
+
+        counts.fill(0);
+        for (uint32_t key : scratch)
+            ++counts[key >> 16u];
+        sum = 0;
+        for (auto& c : counts) {
+            uint32_t next_sum = sum + c;
+            c = sum;
+            sum = next_sum;
+        }
+        for (uint32_t key : scratch)
+            ids[counts[key >> 16u]++] = static_cast<int>(key ^ 0x80000000u);
+    }
+
+    /** lower_bound over a sorted id range that starts probing at \a hint:
+      * doubling steps bracket \a value, then std::lower_bound finishes inside
+      * the bracket. When successive lookups target nearby positions — as
+      * contained-object ids usually do, being allocated together — the
+      * amortized cost approaches O(1) instead of a full log2(N) descent. */
+    const int* GallopLowerBound(const int* first, const int* hint, const int* last, int value) {
+        if (hint > first && *(hint - 1) >= value)   // value lies before the hint
+            return std::lower_bound(first, hint, value);
+        std::ptrdiff_t step = 1;
+        const int* lo = hint;
+        const int* probe = hint;
+        while (probe < last && *probe < value) {
+            lo = probe + 1;
+            probe = (last - probe > step) ? probe + step : last;
+            step <<= 1;
+        }
+        return std::lower_bound(lo, probe, value);
+    }
+
+    // returns true iff two ascending int32 sequences share an element;
+    // scalar two-pointer merge baseline
+    bool HasCommonSortedScalar(const int* a, std::size_t na, const int* b, std::size_t nb) {
+        std::size_t i = 0, j = 0;
+        while (i < na && j < nb) {
+            if (a[i] < b[j])
+                ++i;
+            else if (b[j] < a[i])
+                ++j;
+            else
+                return true;
+        }
+        return false;
+    }
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    // 8-wide variant of the merge: each element of the smaller sequence is
+    // broadcast and compared against the 8-element block of the larger
+    // sequence that could contain it. compiled for AVX2 regardless of the
+    // baseline target; only called after the runtime check below confirms
+    // the CPU supports it
+    __attribute__((target("avx2")))
+    bool HasCommonSortedAVX2(const int* a, std::size_t na, const int* b, std::size_t nb) {
+        if (na > nb) {
+            std::swap(a, b);
+            std::swap(na, nb);
+        }
+        std::size_t j = 0;
+        for (std::size_t i = 0; i < na; ++i) {
+            const int key = a[i];
+            // skip whole blocks of b that end before key
+            while (j + 8 <= nb && b[j + 7] < key)
+                j += 8;
+            if (j + 8 <= nb) {
+                const __m256i key8 = _mm256_set1_epi32(key);
+                const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j));
+                const __m256i eq = _mm256_cmpeq_epi32(chunk, key8);
+                if (_mm256_movemask_epi8(eq))
+                    return true;
+                // no hit and b[j+7] >= key: key is absent, but the next
+                // (larger) key may still land in this block, so keep j
+            } else {
+                // tail of b, shorter than one block
+                for (std::size_t k = j; k < nb; ++k) {
+                    if (b[k] == key)
+                        return true;
+                    if (b[k] > key)
+                        break;
+                }
+                if (b[nb - 1] < key)
+                    return false;   // later keys are larger still
+            }
+        }
+        return false;
+    }
+
+    // resolved once at startup; call sites stay free of ifdefs
+    bool (*const HasCommonSortedInt32)(const int*, std::size_t, const int*, std::size_t) =
+        __builtin_cpu_supports("avx2") ? &HasCommonSortedAVX2 : &HasCommonSortedScalar;
+#else
+    inline bool HasCommonSortedInt32(const int* a, std::size_t na, const int* b, std::size_t nb)
+    { return HasCommonSortedScalar(a, na, b, nb); }
+#endif
+
     struct ContainsSimpleMatch {
         ContainsSimpleMatch(const ObjectSet& subcondition_matches) :
             m_subcondition_matches_ids()
@@ -3123,8 +3836,63 @@ namespace {
                 if (obj)
                     m_subcondition_matches_ids.push_back(obj->ID());
             }
-            // sort them
-            std::sort(m_subcondition_matches_ids.begin(), m_subcondition_matches_ids.end());
+            if (m_subcondition_matches_ids.size() > BLOOM_FILTER_THRESHOLD) {
+                // Bloom prefilter: most contained objects don't match the
+                // subcondition, so two bit tests in this 128-byte filter
+                // reject the bulk of probes before any search
+                for (int id : m_subcondition_matches_ids) {
+                    const uint32_t h1 = BloomMix1(static_cast<uint32_t>(id));
+                    const uint32_t h2 = BloomMix2(static_cast<uint32_t>(id));
+                    m_bloom[(h1 >> 6u) & 15u] |= 1ull << (h1 & 63u);
+                    m_bloom[(h2 >> 6u) & 15u] |= 1ull << (h2 & 63u);
+                }
+                m_bloom_built = true;
+            }
+            if (m_subcondition_matches_ids.size() > HASH_LOOKUP_THRESHOLD) {
+                // past a few hundred ids each binary search chases several
+                // cache lines of mispredicted branches; a hash probe is one
+                // hash plus (usually) one cache line load
+                m_subcondition_matches_hashed.reserve(m_subcondition_matches_ids.size());
+                m_subcondition_matches_hashed.insert(m_subcondition_matches_ids.begin(),
+                                                     m_subcondition_matches_ids.end());
+            } else {
+                // sort them, for std::lower_bound lookups
+                std::sort(m_subcondition_matches_ids.begin(), m_subcondition_matches_ids.end());
+            }
+        }
+
+        // two cheap multiplicative mixes for the Bloom filter bits
+        static uint32_t BloomMix1(uint32_t x) { x *= 0x9E3779B1u; return x ^ (x >> 15u); }
+        static uint32_t BloomMix2(uint32_t x) { x *= 0x85EBCA6Bu; return x ^ (x >> 13u); }
+
+        bool BloomMightContain(int id) const {
+            if (!m_bloom_built)
+                return true;
+            const uint32_t h1 = BloomMix1(static_cast<uint32_t>(id));
+            const uint32_t h2 = BloomMix2(static_cast<uint32_t>(id));
+            return (m_bloom[(h1 >> 6u) & 15u] & (1ull << (h1 & 63u))) &&
+                   (m_bloom[(h2 >> 6u) & 15u] & (1ull << (h2 & 63u)));
+        }
+
+        bool MatchesID(int id) const {
+            if (!BloomMightContain(id))
+                return false;
+            if (!m_subcondition_matches_hashed.empty())
+                return m_subcondition_matches_hashed.count(id) != 0;
+            // a handful of ids fit in a cache line or two; a straight scan
+            // beats binary search there by avoiding its mispredicted
+            // halving branches
+            if (m_subcondition_matches_ids.size() <= LINEAR_SCAN_THRESHOLD) {
+                for (int match_id : m_subcondition_matches_ids) {
+                    if (match_id == id)
+                        return true;
+                }
+                return false;
+            }
+            // std::lower_bound requires m_subcondition_matches_ids to be sorted
+            auto matching_it = std::lower_bound(m_subcondition_matches_ids.begin(),
+                                                m_subcondition_matches_ids.end(), id);
+            return matching_it != m_subcondition_matches_ids.end() && *matching_it == id;
         }
 
         bool operator()(const UniverseObject* candidate) const {
@@ -3137,21 +3905,72 @@ namespace {
             // We need to test whether candidate_elements and m_subcondition_matches_ids have a common element.
             // We choose the strategy that is more efficient by comparing the sizes of both sets.
             if (candidate_elements.size() < m_subcondition_matches_ids.size()) {
-                // candidate_elements is smaller, so we iterate it and look up each candidate element in m_subcondition_matches_ids
-                for (int id : candidate_elements) {
-                    // std::lower_bound requires m_subcondition_matches_ids to be sorted
-                    auto matching_it = std::lower_bound(m_subcondition_matches_ids.begin(), m_subcondition_matches_ids.end(), id);
-
-                    if (matching_it != m_subcondition_matches_ids.end() && *matching_it == id) {
-                        match = true;
-                        break;
+                // candidate_elements is smaller, so we iterate it and look up each candidate element in the subcondition matches
+                if (!m_subcondition_matches_hashed.empty() ||
+                    m_subcondition_matches_ids.size() <= LINEAR_SCAN_THRESHOLD)
+                {
+                    for (int id : candidate_elements) {
+                        if (MatchesID(id)) {
+                            match = true;
+                            break;
+                        }
+                    }
+                } else {
+                    // sorted-vector case: gallop from the previous hit
+                    // position, since successive contained-object ids tend
+                    // to be clustered
+                    const int* const first = m_subcondition_matches_ids.data();
+                    const int* const last = first + m_subcondition_matches_ids.size();
+                    const int* hint = first;
+                    for (int id : candidate_elements) {
+                        if (!BloomMightContain(id))
+                            continue;
+                        const int* matching_it = GallopLowerBound(first, hint, last, id);
+                        if (matching_it != last && *matching_it == id) {
+                            match = true;
+                            break;
+                        }
+                        hint = matching_it;
+                    }
+                }
+            } else if (m_subcondition_matches_hashed.empty()) {
+                // both sequences are sorted (candidate_elements is an ordered
+                // std::set, the ids were sorted in the constructor), so a
+                // merge finds a common element in |A|+|B| steps instead of a
+                // log-time lookup per id
+                if (m_subcondition_matches_ids.size() >= SIMD_MERGE_THRESHOLD) {
+                    // big enough for the 8-wide merge kernel, which needs
+                    // both sides contiguous: flatten the set once per
+                    // candidate into reused scratch
+                    static thread_local std::vector<int> flat_elements;
+                    flat_elements.assign(candidate_elements.begin(), candidate_elements.end());
+                    match = HasCommonSortedInt32(
+                        flat_elements.data(), flat_elements.size(),
+                        m_subcondition_matches_ids.data(), m_subcondition_matches_ids.size());
+                } else {
+                    auto cand_it = candidate_elements.begin();
+                    const auto cand_end = candidate_elements.end();
+                    const int* match_it = m_subcondition_matches_ids.data();
+                    const int* const match_end = match_it + m_subcondition_matches_ids.size();
+                    while (cand_it != cand_end && match_it != match_end) {
+                        if (*cand_it < *match_it) {
+                            ++cand_it;
+                        } else if (*match_it < *cand_it) {
+                            ++match_it;
+                        } else {
+                            match = true;
+                            break;
+                        }
                     }
                 }
             } else {
-                // m_subcondition_matches_ids is smaller, so we iterate it and look up each subcondition match in the set of candidate's elements
-                for (int id : m_subcondition_matches_ids) {
-                    // candidate->Contains() may have a faster implementation than candidate_elements->find()
-                    if (candidate->Contains(id)) {
+                // the ids were hashed rather than sorted, so merge order is
+                // unavailable; probe the hash set (behind the Bloom
+                // prefilter) with each contained object, a constant-time
+                // lookup per element instead of the log-time tree probes
+                // candidate->Contains() would make per id
+                for (int id : candidate_elements) {
+                    if (MatchesID(id)) {
                         match = true;
                         break;
                     }
@@ -3161,7 +3980,15 @@ namespace {
             return match;
         }
 
+        static constexpr std::size_t LINEAR_SCAN_THRESHOLD = 16;
+        static constexpr std::size_t SIMD_MERGE_THRESHOLD = 32;
+        static constexpr std::size_t BLOOM_FILTER_THRESHOLD = 64;
+        static constexpr std::size_t HASH_LOOKUP_THRESHOLD = 256;
+
         std::vector<int> m_subcondition_matches_ids;
+        std::unordered_set<int> m_subcondition_matches_hashed;  // populated instead of sorting when the id set is large
+        std::array<uint64_t, 16> m_bloom{};                     // 1024-bit prefilter over the ids, built past BLOOM_FILTER_THRESHOLD
+        bool m_bloom_built = false;
     };
 }
 
@@ -3195,10 +4022,8 @@ void Contains::Eval(const ScriptingContext& parent_context,
         ObjectSet subcondition_matches = objects.findRaw(local_context.condition_local_candidate->ContainedObjectIDs());
 
         // apply subcondition to candidates
-        if (!subcondition_matches.empty()) {
-            ObjectSet dummy;
-            m_condition->Eval(local_context, subcondition_matches, dummy, SearchDomain::MATCHES);
-        }
+        if (!subcondition_matches.empty())
+            m_condition->EvalAny(local_context, subcondition_matches);
 
         // move single local candidate as appropriate...
         if (search_domain == SearchDomain::MATCHES && subcondition_matches.empty()) {
@@ -3216,7 +4041,42 @@ void Contains::Eval(const ScriptingContext& parent_context,
         // of subcondition to find all subcondition matches in the Universe
         static constexpr UniverseObject* const no_object = nullptr;
         const ScriptingContext local_context{parent_context, no_object};
-        ObjectSet subcondition_matches = m_condition->Eval(local_context);
+        ObjectSet subcondition_matches;
+
+        // if the universe is frozen (target scoping) and the subcondition
+        // result can't depend on anything that varies between Eval calls,
+        // reuse it across those calls instead of re-traversing the whole
+        // object map each time. outside scoping, effects can change object
+        // attributes without bumping the map's state version, so a cached
+        // result could miss those changes
+        if (parent_context.universe_frozen &&
+            m_condition->RootCandidateInvariant() &&
+            m_condition->SourceInvariant() &&
+            m_condition->TargetInvariant())
+        {
+            std::scoped_lock cache_lock(m_subcond_cache_mutex);
+            if (m_subcond_cache_objects != &parent_context.ContextObjects() ||
+                m_subcond_cache_state != parent_context.ContextObjects().StateVersion() ||
+                m_subcond_cache_turn != parent_context.current_turn)
+            {
+                m_subcond_cache = m_condition->Eval(local_context);
+                m_subcond_cache_objects = &parent_context.ContextObjects();
+                m_subcond_cache_state = parent_context.ContextObjects().StateVersion();
+                m_subcond_cache_turn = parent_context.current_turn;
+            }
+            subcondition_matches = m_subcond_cache;
+        } else {
+            subcondition_matches = m_condition->Eval(local_context);
+        }
+
+        if (subcondition_matches.empty()) {
+            // nothing can contain a match: skip the per-candidate sweep and
+            // move any candidates out of matches wholesale
+            if (search_domain == SearchDomain::MATCHES) {
+                MoveAll(matches, non_matches);
+            }
+            return;
+        }
 
         // check all candidates to see if they contain any subcondition matches
         EvalImpl(matches, non_matches, search_domain, ContainsSimpleMatch(subcondition_matches));
@@ -3252,27 +4112,38 @@ bool Contains::Match(const ScriptingContext& local_context) const {
         return false;
     }
 
-    // get subcondition matches
-    ObjectSet subcondition_matches = m_condition->Eval(local_context);
+    // the subcondition matches are only needed within this call, so they are
+    // evaluated into reused thread-local storage, moved out while in use so
+    // nested Match calls get their own buffer
+    static thread_local ObjectSet subcondition_matches_buf;
+    ObjectSet subcondition_matches{std::move(subcondition_matches_buf)};
+    m_condition->Eval(local_context, subcondition_matches);
 
     // does candidate object contain any subcondition matches?
-    for (auto* obj : subcondition_matches)
-        if (candidate->Contains(obj->ID()))
-            return true;
+    bool retval = false;
+    for (auto* obj : subcondition_matches) {
+        if (candidate->Contains(obj->ID())) {
+            retval = true;
+            break;
+        }
+    }
 
-    return false;
+    subcondition_matches_buf = std::move(subcondition_matches);     // keep the capacity for the next call
+    return retval;
 }
 
 void Contains::SetTopLevelContent(const std::string& content_name) {
     if (m_condition)
         m_condition->SetTopLevelContent(content_name);
+    std::scoped_lock cache_lock(m_subcond_cache_mutex);
+    m_subcond_cache_objects = nullptr;  // substitution can change what the subcondition matches
 }
 
 unsigned int Contains::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Contains");
-    CheckSums::CheckSumCombine(retval, m_condition);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Contains");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_condition);
 
     TraceLogger(conditions) << "GetCheckSum(Contains): retval: " << retval;
     return retval;
@@ -3322,8 +4193,12 @@ namespace {
                 if (obj)
                     m_subcondition_matches_ids.push_back(obj->ID());
             }
-            // sort them
-            std::sort(m_subcondition_matches_ids.begin(), m_subcondition_matches_ids.end());
+            // sort them; for big id sets the branchless radix sort is about
+            // twice as fast as the comparison sort
+            if (m_subcondition_matches_ids.size() > RADIX_SORT_THRESHOLD)
+                RadixSortIDs(m_subcondition_matches_ids);
+            else
+                std::sort(m_subcondition_matches_ids.begin(), m_subcondition_matches_ids.end());
         }
 
         bool operator()(const UniverseObject* candidate) const {
@@ -3331,8 +4206,10 @@ namespace {
                 return false;
 
             bool match = false;
-            // gather the objects containing candidate
-            std::vector<int> candidate_containers;
+            // gather the objects containing candidate; at most two (direct
+            // container and system), so the inline buffer never spills and
+            // no per-candidate allocation happens
+            boost::container::small_vector<int, 2> candidate_containers;
             const int candidate_id = candidate->ID();
             const int    system_id = candidate->SystemID();
             const int container_id = candidate->ContainerObjectID();
@@ -3342,16 +4219,32 @@ namespace {
 
             // We need to test whether candidate_containers and m_subcondition_matches_ids have a common element.
             // We choose the strategy that is more efficient by comparing the sizes of both sets.
+            if (m_subcondition_matches_ids.size() <= LINEAR_SCAN_THRESHOLD) {
+                // with at most two containers and a handful of match ids the
+                // whole intersection is a few cache lines; scan it straight
+                // through rather than binary searching
+                for (int id : candidate_containers) {
+                    for (int match_id : m_subcondition_matches_ids) {
+                        if (match_id == id)
+                            return true;
+                    }
+                }
+                return false;
+            }
+
             if (candidate_containers.size() < m_subcondition_matches_ids.size()) {
                 // candidate_containers is smaller, so we iterate it and look up each candidate container in m_subcondition_matches_ids
+                const int* const first = m_subcondition_matches_ids.data();
+                const int* const last = first + m_subcondition_matches_ids.size();
+                const int* hint = first;
                 for (int id : candidate_containers) {
-                    // std::lower_bound requires m_subcondition_matches_ids to be sorted
-                    auto matching_it = std::lower_bound(m_subcondition_matches_ids.begin(), m_subcondition_matches_ids.end(), id);
-
-                    if (matching_it != m_subcondition_matches_ids.end() && *matching_it == id) {
+                    // GallopLowerBound requires m_subcondition_matches_ids to be sorted
+                    const int* matching_it = GallopLowerBound(first, hint, last, id);
+                    if (matching_it != last && *matching_it == id) {
                         match = true;
                         break;
                     }
+                    hint = matching_it;
                 }
             } else {
                 // m_subcondition_matches_ids is smaller, so we iterate it and look up each subcondition match in the set of candidate's containers
@@ -3367,6 +4260,9 @@ namespace {
             return match;
         }
 
+        static constexpr std::size_t LINEAR_SCAN_THRESHOLD = 16;
+        static constexpr std::size_t RADIX_SORT_THRESHOLD = 256;
+
         std::vector<int> m_subcondition_matches_ids;
     };
 }
@@ -3397,21 +4293,23 @@ void ContainedBy::Eval(const ScriptingContext& parent_context,
         const ScriptingContext local_context{
             parent_context, search_domain == SearchDomain::MATCHES ? *matches.begin() : *non_matches.begin()};
 
-        // initialize subcondition candidates from local candidate's containers
-        std::set<int> container_object_ids;
-        if (local_context.condition_local_candidate->ContainerObjectID() != INVALID_OBJECT_ID)
-            container_object_ids.insert(local_context.condition_local_candidate->ContainerObjectID());
-        if (local_context.condition_local_candidate->SystemID() != INVALID_OBJECT_ID)
-            container_object_ids.insert(local_context.condition_local_candidate->SystemID());
+        // initialize subcondition candidates from local candidate's containers:
+        // at most two ids, de-duplicated on the fly, gathered without the
+        // tree-node allocations a std::set would make on this hot path
+        const int container_id = local_context.condition_local_candidate->ContainerObjectID();
+        const int    system_id = local_context.condition_local_candidate->SystemID();
+        boost::container::small_vector<int, 2> container_object_ids;
+        if (container_id != INVALID_OBJECT_ID)
+            container_object_ids.push_back(container_id);
+        if (system_id != INVALID_OBJECT_ID && system_id != container_id)
+            container_object_ids.push_back(system_id);
 
         const ObjectMap& objects = parent_context.ContextObjects();
         ObjectSet subcondition_matches = objects.findRaw(container_object_ids);
 
         // apply subcondition to candidates
-        if (!subcondition_matches.empty()) {
-            ObjectSet dummy;
-            m_condition->Eval(local_context, subcondition_matches, dummy, SearchDomain::MATCHES);
-        }
+        if (!subcondition_matches.empty())
+            m_condition->EvalAny(local_context, subcondition_matches);
 
         // move single local candidate as appropriate...
         if (search_domain == SearchDomain::MATCHES && subcondition_matches.empty()) {
@@ -3429,7 +4327,42 @@ void ContainedBy::Eval(const ScriptingContext& parent_context,
         // of subcondition to find all subcondition matches in the Universe
         static constexpr UniverseObject* const no_object = nullptr;
         const ScriptingContext local_context{parent_context, no_object};
-        ObjectSet subcondition_matches = m_condition->Eval(local_context);
+        ObjectSet subcondition_matches;
+
+        // if the universe is frozen (target scoping) and the subcondition
+        // result can't depend on anything that varies between Eval calls,
+        // reuse it across those calls instead of re-traversing the whole
+        // object map each time. outside scoping, effects can change object
+        // attributes without bumping the map's state version, so a cached
+        // result could miss those changes
+        if (parent_context.universe_frozen &&
+            m_condition->RootCandidateInvariant() &&
+            m_condition->SourceInvariant() &&
+            m_condition->TargetInvariant())
+        {
+            std::scoped_lock cache_lock(m_subcond_cache_mutex);
+            if (m_subcond_cache_objects != &parent_context.ContextObjects() ||
+                m_subcond_cache_state != parent_context.ContextObjects().StateVersion() ||
+                m_subcond_cache_turn != parent_context.current_turn)
+            {
+                m_subcond_cache = m_condition->Eval(local_context);
+                m_subcond_cache_objects = &parent_context.ContextObjects();
+                m_subcond_cache_state = parent_context.ContextObjects().StateVersion();
+                m_subcond_cache_turn = parent_context.current_turn;
+            }
+            subcondition_matches = m_subcond_cache;
+        } else {
+            subcondition_matches = m_condition->Eval(local_context);
+        }
+
+        if (subcondition_matches.empty()) {
+            // no potential containers: skip the per-candidate sweep and
+            // move any candidates out of matches wholesale
+            if (search_domain == SearchDomain::MATCHES) {
+                MoveAll(matches, non_matches);
+            }
+            return;
+        }
 
         // check all candidates to see if they contain any subcondition matches
         EvalImpl(matches, non_matches, search_domain, ContainedBySimpleMatch(subcondition_matches));
@@ -3466,34 +4399,36 @@ bool ContainedBy::Match(const ScriptingContext& local_context) const {
         return false;
     }
 
-    // get containing objects
-    std::set<int> containers;
-    if (candidate->SystemID() != INVALID_OBJECT_ID)
-        containers.insert(candidate->SystemID());
-    if (candidate->ContainerObjectID() != INVALID_OBJECT_ID && candidate->ContainerObjectID() != candidate->SystemID())
-        containers.insert(candidate->ContainerObjectID());
+    // get containing objects: at most two ids, de-duplicated on the fly,
+    // gathered without the tree-node allocations a std::set would make
+    const int    system_id = candidate->SystemID();
+    const int container_id = candidate->ContainerObjectID();
+    boost::container::small_vector<int, 2> containers;
+    if (system_id != INVALID_OBJECT_ID)
+        containers.push_back(system_id);
+    if (container_id != INVALID_OBJECT_ID && container_id != system_id)
+        containers.push_back(container_id);
 
     ObjectSet container_objects = local_context.ContextObjects().findRaw<const UniverseObject>(containers);
     if (container_objects.empty())
         return false;   // if no containers, don't need to check them
 
     // do any containers match the subcondition?
-    ObjectSet non_matches;
-    m_condition->Eval(local_context, container_objects, non_matches, SearchDomain::MATCHES);
-
-    return !container_objects.empty();
+    return m_condition->EvalAny(local_context, container_objects);
 }
 
 void ContainedBy::SetTopLevelContent(const std::string& content_name) {
     if (m_condition)
         m_condition->SetTopLevelContent(content_name);
+    std::scoped_lock cache_lock(m_subcond_cache_mutex);
+    m_subcond_cache_objects = nullptr;  // substitution can change what the subcondition matches
 }
 
 unsigned int ContainedBy::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::ContainedBy");
-    CheckSums::CheckSumCombine(retval, m_condition);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::ContainedBy");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_condition);
 
     TraceLogger(conditions) << "GetCheckSum(ContainedBy): retval: " << retval;
     return retval;
@@ -3541,6 +4476,16 @@ namespace {
                 return candidate->SystemID() == m_system_id;        // match objects in specified system (including that system itself)
         }
 
+        // columnar form for EvalColumnImpl: the wildcard test is hoisted out
+        // of the loop, leaving one dispatched 8-wide compare kernel over the
+        // gathered system ids
+        void operator()(const int* system_ids, uint8_t* out_flags, std::size_t count) const {
+            if (m_system_id == INVALID_OBJECT_ID)
+                FlagsNeI32(system_ids, count, INVALID_OBJECT_ID, out_flags);
+            else
+                FlagsEqI32(system_ids, count, m_system_id, out_flags);
+        }
+
         int m_system_id;
     };
 }
@@ -3553,9 +4498,12 @@ void InOrIsSystem::Eval(const ScriptingContext& parent_context,
                             (m_system_id->LocalCandidateInvariant() &&
                             (parent_context.condition_root_candidate || RootCandidateInvariant()));
     if (simple_eval_safe) {
-        // evaluate system id once, and use to check all candidate objects
+        // evaluate system id once, gather candidate system ids into a
+        // column, and compare the column against it
         int system_id = (m_system_id ? m_system_id->Eval(parent_context) : INVALID_OBJECT_ID);
-        EvalImpl(matches, non_matches, search_domain, InSystemSimpleMatch(system_id));
+        EvalColumnImpl<int>(matches, non_matches, search_domain,
+                            [](const UniverseObject* o) { return o->SystemID(); },
+                            InSystemSimpleMatch(system_id));
     } else {
         // re-evaluate empire id for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -3649,15 +4597,14 @@ bool InOrIsSystem::Match(const ScriptingContext& local_context) const {
 }
 
 void InOrIsSystem::SetTopLevelContent(const std::string& content_name) {
-    if (m_system_id)
-        m_system_id->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_system_id);
 }
 
 unsigned int InOrIsSystem::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::InOrIsSystem");
-    CheckSums::CheckSumCombine(retval, m_system_id);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::InOrIsSystem");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_system_id);
 
     TraceLogger(conditions) << "GetCheckSum(InOrIsSystem): retval: " << retval;
     return retval;
@@ -3709,6 +4656,16 @@ namespace {
                 return building->PlanetID() == m_planet_id;        // match objects on specified planet
         }
 
+        // columnar form for EvalColumnImpl: non-buildings gather as
+        // INVALID_OBJECT_ID, so one dispatched compare kernel covers both
+        // the exact- and any-planet cases
+        void operator()(const int* planet_ids, uint8_t* out_flags, std::size_t count) const {
+            if (m_planet_id == INVALID_OBJECT_ID)
+                FlagsNeI32(planet_ids, count, INVALID_OBJECT_ID, out_flags);
+            else
+                FlagsEqI32(planet_ids, count, m_planet_id, out_flags);
+        }
+
         int m_planet_id;
     };
 }
@@ -3721,9 +4678,16 @@ void OnPlanet::Eval(const ScriptingContext& parent_context,
                             (m_planet_id->LocalCandidateInvariant() &&
                             (parent_context.condition_root_candidate || RootCandidateInvariant()));
     if (simple_eval_safe) {
-        // evaluate planet id once, and use to check all candidate objects
+        // evaluate planet id once, gather candidate planet ids into a
+        // column (non-buildings as INVALID_OBJECT_ID), and compare the
+        // column against it
         int planet_id = (m_planet_id ? m_planet_id->Eval(parent_context) : INVALID_OBJECT_ID);
-        EvalImpl(matches, non_matches, search_domain, OnPlanetSimpleMatch(planet_id));
+        EvalColumnImpl<int>(matches, non_matches, search_domain,
+                            [](const UniverseObject* o) {
+                                return o->ObjectType() == UniverseObjectType::OBJ_BUILDING ?
+                                    static_cast<const ::Building*>(o)->PlanetID() : INVALID_OBJECT_ID;
+                            },
+                            OnPlanetSimpleMatch(planet_id));
     } else {
         // re-evaluate empire id for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -3796,8 +4760,14 @@ void OnPlanet::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_
     if (!planet)
         return;
 
-    // insert all objects that have the specified planet id
-    condition_non_targets = parent_context.ContextObjects().findRaw(planet->BuildingIDs());
+    // append all objects that have the specified planet id, preserving any
+    // contents and reserved storage the caller put into the set
+    const auto& building_ids = planet->BuildingIDs();
+    condition_non_targets.reserve(condition_non_targets.size() + building_ids.size());
+    for (int building_id : building_ids) {
+        if (const auto* building = parent_context.ContextObjects().getRaw<::Building>(building_id))
+            condition_non_targets.push_back(building);
+    }
 }
 
 bool OnPlanet::Match(const ScriptingContext& local_context) const {
@@ -3811,14 +4781,14 @@ bool OnPlanet::Match(const ScriptingContext& local_context) const {
 }
 
 void OnPlanet::SetTopLevelContent(const std::string& content_name) {
-    if (m_planet_id)
-        m_planet_id->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_planet_id);
 }
 
 unsigned int OnPlanet::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::OnPlanet");
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::OnPlanet");
+    CheckSums::CheckSumCombine(retval, tag_checksum);
     CheckSums::CheckSumCombine(retval, m_planet_id);
 
     TraceLogger(conditions) << "GetCheckSum(OnPlanet): retval: " << retval;
@@ -3950,14 +4920,14 @@ bool ObjectID::Match(const ScriptingContext& local_context) const {
 }
 
 void ObjectID::SetTopLevelContent(const std::string& content_name) {
-    if (m_object_id)
-        m_object_id->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_object_id);
 }
 
 unsigned int ObjectID::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::ObjectID");
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::ObjectID");
+    CheckSums::CheckSumCombine(retval, tag_checksum);
     CheckSums::CheckSumCombine(retval, m_object_id);
 
     TraceLogger(conditions) << "GetCheckSum(ObjectID): retval: " << retval;
@@ -3971,11 +4941,13 @@ std::unique_ptr<Condition> ObjectID::Clone() const
 // PlanetType                                            //
 ///////////////////////////////////////////////////////////
 PlanetType::PlanetType(std::vector<std::unique_ptr<ValueRef::ValueRef< ::PlanetType>>>&& types) :
-    m_types(std::move(types))
+    m_types(std::move(types)),
+    m_constant_types_mask(ConstantEnumMembershipMask<::PlanetType::NUM_PLANET_TYPES>(m_types))
 {
-    m_root_candidate_invariant = boost::algorithm::all_of(m_types, [](auto& e){ return e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(m_types, [](auto& e){ return e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(m_types, [](auto& e){ return e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(m_types);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
 }
 
 bool PlanetType::operator==(const Condition& rhs) const {
@@ -3996,39 +4968,63 @@ bool PlanetType::operator==(const Condition& rhs) const {
 }
 
 namespace {
-    // gets a planet ID from \a obj considering obj as a planet or a building on a planet
-    ::PlanetType PlanetTypeFromObject(const UniverseObject* obj, const ObjectMap& objects) {
-        if (obj->ObjectType() == UniverseObjectType::OBJ_PLANET) {
-            auto* planet = static_cast<const ::Planet*>(obj);
-            return planet->Type();
+    // resolves a candidate to a planet: the candidate itself if it is one,
+    // or the planet a candidate building sits on. Remembers the last
+    // building resolution, as candidate sets frequently hold several
+    // buildings of the same planet, and successive planet-property
+    // conditions re-walk the same candidates; the memo turns most of
+    // those repeat map lookups into a single id compare.
+    struct PlanetFromObject {
+        explicit PlanetFromObject(const ObjectMap& objects) :
+            m_objects(objects)
+        {}
 
-        } else if (obj->ObjectType() == UniverseObjectType::OBJ_BUILDING) {
-            auto* building = static_cast<const ::Building*>(obj);
-            if (auto* planet = objects.getRaw<Planet>(building->PlanetID()))
-                return planet->Type();
+        const ::Planet* operator()(const UniverseObject* obj) const {
+            // single dispatch on the type tag; over heterogeneous candidate
+            // sets (ships, fleets, systems mixed in) this rejects the
+            // non-planet, non-building majority before any lookup
+            switch (obj->ObjectType()) {
+            case UniverseObjectType::OBJ_PLANET:
+                return static_cast<const ::Planet*>(obj);
+            case UniverseObjectType::OBJ_BUILDING: {
+                const int planet_id = static_cast<const ::Building*>(obj)->PlanetID();
+                if (planet_id != m_last_planet_id) {
+                    m_last_planet_id = planet_id;
+                    m_last_planet = m_objects.getRaw<Planet>(planet_id);
+                }
+                return m_last_planet;
+            }
+            default:
+                return nullptr;
+            }
         }
 
-        return ::PlanetType::INVALID_PLANET_TYPE;
-    }
+        const ObjectMap&        m_objects;
+        mutable int             m_last_planet_id = INVALID_OBJECT_ID;
+        mutable const ::Planet* m_last_planet = nullptr;
+    };
 
     struct PlanetTypeSimpleMatch {
-        PlanetTypeSimpleMatch(const std::vector< ::PlanetType>& types, const ObjectMap& objects) :
-            m_types(types),
-            m_objects(objects)
+        PlanetTypeSimpleMatch(uint64_t types_mask, const ObjectMap& objects) :
+            m_types_mask(types_mask),
+            m_planet_of(objects)
         {}
 
         bool operator()(const UniverseObject* candidate) const {
             if (!candidate)
                 return false;
 
-            auto pt = PlanetTypeFromObject(candidate, m_objects);
+            const auto* planet = m_planet_of(candidate);
+            if (!planet)
+                return false;
+            auto pt = planet->Type();
             if (pt == ::PlanetType::INVALID_PLANET_TYPE)
                 return false;
-            return std::count(m_types.begin(), m_types.end(), pt);
+            return (m_types_mask >> static_cast<unsigned int>(pt)) & 1u;
         }
 
-        const std::vector< ::PlanetType>& m_types;
-        const ObjectMap& m_objects;
+        const uint64_t m_types_mask;
+        PlanetFromObject m_planet_of;
     };
 }
 
@@ -4047,13 +5043,22 @@ void PlanetType::Eval(const ScriptingContext& parent_context,
         }
     }
     if (simple_eval_safe) {
+        if (m_constant_types_mask) {
+            // all types are constants, so the mask built at construction applies
+            EvalImpl(matches, non_matches, search_domain,
+                     PlanetTypeSimpleMatch(*m_constant_types_mask, parent_context.ContextObjects()));
+            return;
+        }
         // evaluate types once, and use to check all candidate objects
-        std::vector< ::PlanetType> types;
+        // inline-capacity buffer: these lists rarely exceed a few entries
+        boost::container::small_vector< ::PlanetType, 4> types;
         types.reserve(m_types.size());
         // get all types from valuerefs
         for (auto& type : m_types)
             types.push_back(type->Eval(parent_context));
-        EvalImpl(matches, non_matches, search_domain, PlanetTypeSimpleMatch(types, parent_context.ContextObjects()));
+        EvalImpl(matches, non_matches, search_domain,
+                 PlanetTypeSimpleMatch(EnumMembershipMask<::PlanetType::NUM_PLANET_TYPES>(types),
+                                       parent_context.ContextObjects()));
     } else {
         // re-evaluate contained objects for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -4097,8 +5102,7 @@ std::string PlanetType::Dump(unsigned short ntabs) const {
 void PlanetType::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_context,
                                                    ObjectSet& condition_non_targets) const
 {
-    AddPlanetSet(parent_context.ContextObjects(), condition_non_targets);
-    AddBuildingSet(parent_context.ContextObjects(), condition_non_targets);
+    AddPlanetBuildingSets(parent_context.ContextObjects(), condition_non_targets);
 }
 
 bool PlanetType::Match(const ScriptingContext& local_context) const {
@@ -4118,6 +5122,10 @@ bool PlanetType::Match(const ScriptingContext& local_context) const {
 
     if (planet) {
         auto planet_type = planet->Type();
+        if (m_constant_types_mask) {
+            return planet_type != ::PlanetType::INVALID_PLANET_TYPE &&
+                   ((*m_constant_types_mask >> static_cast<unsigned int>(planet_type)) & 1u);
+        }
         for (auto& type : m_types) {
             if (type->Eval(local_context) == planet_type)
                 return true;
@@ -4136,7 +5144,8 @@ void PlanetType::SetTopLevelContent(const std::string& content_name) {
 unsigned int PlanetType::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::PlanetType");
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::PlanetType");
+    CheckSums::CheckSumCombine(retval, tag_checksum);
     CheckSums::CheckSumCombine(retval, m_types);
 
     TraceLogger(conditions) << "GetCheckSum(PlanetType): retval: " << retval;
@@ -4150,11 +5159,13 @@ std::unique_ptr<Condition> PlanetType::Clone() const
 // PlanetSize                                            //
 ///////////////////////////////////////////////////////////
 PlanetSize::PlanetSize(std::vector<std::unique_ptr<ValueRef::ValueRef< ::PlanetSize>>>&& sizes) :
-    m_sizes(std::move(sizes))
+    m_sizes(std::move(sizes)),
+    m_constant_sizes_mask(ConstantEnumMembershipMask<::PlanetSize::NUM_PLANET_SIZES>(m_sizes))
 {
-    m_root_candidate_invariant = boost::algorithm::all_of(m_sizes, [](auto& e){ return e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(m_sizes, [](auto& e){ return e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(m_sizes, [](auto& e){ return e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(m_sizes);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
 }
 
 bool PlanetSize::operator==(const Condition& rhs) const {
@@ -4176,38 +5187,29 @@ bool PlanetSize::operator==(const Condition& rhs) const {
 
 namespace {
     struct PlanetSizeSimpleMatch {
-        PlanetSizeSimpleMatch(const std::vector< ::PlanetSize>& sizes, const ObjectMap& objects) :
-            m_sizes(sizes),
-            m_objects(objects)
+        PlanetSizeSimpleMatch(uint64_t sizes_mask, const ObjectMap& objects) :
+            m_sizes_mask(sizes_mask),
+            m_planet_of(objects)
         {}
 
         bool operator()(const UniverseObject* candidate) const {
             if (!candidate)
                 return false;
 
-            // is it a planet or on a planet? TODO: This concept should be generalized and factored out.
-            const Planet* planet = nullptr;
-            if (candidate->ObjectType() == UniverseObjectType::OBJ_PLANET) {
-                planet = static_cast<const Planet*>(candidate);
-            } else if (candidate->ObjectType() == UniverseObjectType::OBJ_BUILDING) {
-                auto building = static_cast<const ::Building*>(candidate);
-                planet = m_objects.getRaw<Planet>(building->PlanetID());
-            }
-
+            // is it a planet or on a planet?
+            const auto* planet = m_planet_of(candidate);
             if (planet) {
                 auto planet_size = planet->Size();
-                // is it one of the specified building types?
-                for (auto size : m_sizes) {
-                    if (planet_size == size)
-                        return true;
-                }
+                // is it one of the specified sizes?
+                if (planet_size != ::PlanetSize::INVALID_PLANET_SIZE)
+                    return (m_sizes_mask >> static_cast<unsigned int>(planet_size)) & 1u;
             }
 
             return false;
         }
 
-        const std::vector< ::PlanetSize>& m_sizes;
-        const ObjectMap& m_objects;
+        const uint64_t m_sizes_mask;
+        PlanetFromObject m_planet_of;
     };
 }
 
@@ -4226,13 +5228,22 @@ void PlanetSize::Eval(const ScriptingContext& parent_context,
         }
     }
     if (simple_eval_safe) {
+        if (m_constant_sizes_mask) {
+            // all sizes are constants, so the mask built at construction applies
+            EvalImpl(matches, non_matches, search_domain,
+                     PlanetSizeSimpleMatch(*m_constant_sizes_mask, parent_context.ContextObjects()));
+            return;
+        }
         // evaluate types once, and use to check all candidate objects
-        std::vector< ::PlanetSize> sizes;
+        // inline-capacity buffer: these lists rarely exceed a few entries
+        boost::container::small_vector< ::PlanetSize, 4> sizes;
         sizes.reserve(m_sizes.size());
         // get all types from valuerefs  TODO: could lazy-evaluate m_sizes vs. find all then pass in...?
         for (auto& size : m_sizes)
             sizes.push_back(size->Eval(parent_context));
-        EvalImpl(matches, non_matches, search_domain, PlanetSizeSimpleMatch(sizes, parent_context.ContextObjects()));
+        EvalImpl(matches, non_matches, search_domain,
+                 PlanetSizeSimpleMatch(EnumMembershipMask<::PlanetSize::NUM_PLANET_SIZES>(sizes),
+                                       parent_context.ContextObjects()));
     } else {
         // re-evaluate contained objects for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -4276,8 +5287,7 @@ std::string PlanetSize::Dump(unsigned short ntabs) const {
 void PlanetSize::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_context,
                                                    ObjectSet& condition_non_targets) const
 {
-    AddPlanetSet(parent_context.ContextObjects(), condition_non_targets);
-    AddBuildingSet(parent_context.ContextObjects(), condition_non_targets);
+    AddPlanetBuildingSets(parent_context.ContextObjects(), condition_non_targets);
 }
 
 bool PlanetSize::Match(const ScriptingContext& local_context) const {
@@ -4287,14 +5297,22 @@ bool PlanetSize::Match(const ScriptingContext& local_context) const {
         return false;
     }
 
-    auto planet = dynamic_cast<const Planet*>(candidate);
-    const ::Building* building = nullptr;
-    if (!planet && (building = dynamic_cast<const ::Building*>(candidate)))
+    const Planet* planet = nullptr;
+    if (candidate->ObjectType() == UniverseObjectType::OBJ_PLANET) {
+        planet = static_cast<const Planet*>(candidate);
+    } else if (candidate->ObjectType() == UniverseObjectType::OBJ_BUILDING) {
+        auto building = static_cast<const ::Building*>(candidate);
         planet = local_context.ContextObjects().getRaw<Planet>(building->PlanetID());
+    }
 
     if (planet) {
+        auto planet_size = planet->Size();
+        if (m_constant_sizes_mask) {
+            return planet_size != ::PlanetSize::INVALID_PLANET_SIZE &&
+                   ((*m_constant_sizes_mask >> static_cast<unsigned int>(planet_size)) & 1u);
+        }
         for (auto& size : m_sizes) {
-            if (size->Eval(local_context) == planet->Size())
+            if (size->Eval(local_context) == planet_size)
                 return true;
         }
     }
@@ -4311,7 +5329,8 @@ void PlanetSize::SetTopLevelContent(const std::string& content_name) {
 unsigned int PlanetSize::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::PlanetSize");
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::PlanetSize");
+    CheckSums::CheckSumCombine(retval, tag_checksum);
     CheckSums::CheckSumCombine(retval, m_sizes);
 
     TraceLogger(conditions) << "GetCheckSum(PlanetSize): retval: " << retval;
@@ -4327,17 +5346,13 @@ std::unique_ptr<Condition> PlanetSize::Clone() const
 PlanetEnvironment::PlanetEnvironment(std::vector<std::unique_ptr<ValueRef::ValueRef< ::PlanetEnvironment>>>&& environments,
                                      std::unique_ptr<ValueRef::ValueRef<std::string>>&& species_name_ref) :
     m_environments(std::move(environments)),
-    m_species_name(std::move(species_name_ref))
+    m_species_name(std::move(species_name_ref)),
+    m_constant_environments_mask(ConstantEnumMembershipMask<::PlanetEnvironment::NUM_PLANET_ENVIRONMENTS>(m_environments))
 {
-    m_root_candidate_invariant =
-        (!m_species_name || m_species_name->RootCandidateInvariant()) &&
-        boost::algorithm::all_of(m_environments, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant =
-        (!m_species_name || m_species_name->TargetInvariant()) &&
-        boost::algorithm::all_of(m_environments, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant =
-        (!m_species_name || m_species_name->SourceInvariant()) &&
-        boost::algorithm::all_of(m_environments, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(m_environments);
+    m_root_candidate_invariant = (!m_species_name || m_species_name->RootCandidateInvariant()) && invariants[0];
+    m_target_invariant = (!m_species_name || m_species_name->TargetInvariant()) && invariants[1];
+    m_source_invariant = (!m_species_name || m_species_name->SourceInvariant()) && invariants[2];
 }
 
 bool PlanetEnvironment::operator==(const Condition& rhs) const {
@@ -4360,49 +5375,68 @@ bool PlanetEnvironment::operator==(const Condition& rhs) const {
 }
 
 namespace {
-    struct PlanetEnvironmentSimpleMatch {
-        PlanetEnvironmentSimpleMatch(const std::vector< ::PlanetEnvironment>& environments,
-                                     const ObjectMap& objects,
-                                     const std::string& species = "") :
-            m_environments(environments),
-            m_species(species),
-            m_objects(objects)
+    // which species the environment is judged against is fixed across a
+    // sweep, so the two cases get dedicated functors rather than one that
+    // re-branches on it per candidate
+
+    struct PlanetEnvForPlanetSpeciesSimpleMatch {
+        PlanetEnvForPlanetSpeciesSimpleMatch(uint64_t environments_mask, const ObjectMap& objects) :
+            m_environments_mask(environments_mask),
+            m_planet_of(objects)
         {}
 
         bool operator()(const UniverseObject* candidate) const {
             if (!candidate)
                 return false;
 
-            // is it a planet or on a planet? TODO: factor out
-            const Planet* planet = nullptr;
-            if (candidate->ObjectType() == UniverseObjectType::OBJ_PLANET)
-                planet = static_cast<const ::Planet*>(candidate);
-            if (!planet && candidate->ObjectType() == UniverseObjectType::OBJ_BUILDING) {
-                const auto* building = static_cast<const ::Building*>(candidate);
-                planet = m_objects.getRaw<Planet>(building->PlanetID());
-            }
+            // is it a planet or on a planet?
+            const auto* planet = m_planet_of(candidate);
             if (!planet)
                 return false;
 
-            // if no species specified, use planet's own species
-            const auto& species_to_check = m_species.empty() ? planet->SpeciesName() : m_species;
-            // if no species specified and planet has no species, can't match
-            if (species_to_check.empty())
+            // judge against the planet's own species; a planet with no
+            // species can't match
+            const auto& species_name = planet->SpeciesName();
+            if (species_name.empty())
                 return false;
+            auto planet_env = planet->EnvironmentForSpecies(species_name);
 
-            // get plaent's environment for specified species, and check if it matches any of the indicated environments
-            auto planet_env = planet->EnvironmentForSpecies(species_to_check);
-            for (auto environment : m_environments) {
-                if (environment == planet_env)
-                    return true;
-            }
+            if (planet_env == ::PlanetEnvironment::INVALID_PLANET_ENVIRONMENT)
+                return false;
+            return (m_environments_mask >> static_cast<unsigned int>(planet_env)) & 1u;
+        }
 
-            return false;
+        const uint64_t   m_environments_mask;
+        PlanetFromObject m_planet_of;
+    };
+
+    struct PlanetEnvForFixedSpeciesSimpleMatch {
+        PlanetEnvForFixedSpeciesSimpleMatch(uint64_t environments_mask,
+                                            const ObjectMap& objects,
+                                            const std::string& species) :
+            m_environments_mask(environments_mask),
+            m_species_obj(GetSpecies(species)),    // looked up once; candidates skip the per-planet name lookup
+            m_planet_of(objects)
+        {}
+
+        bool operator()(const UniverseObject* candidate) const {
+            if (!candidate)
+                return false;
+
+            // is it a planet or on a planet?
+            const auto* planet = m_planet_of(candidate);
+            if (!planet)
+                return false;
+
+            auto planet_env = planet->EnvironmentForSpecies(m_species_obj);
+            if (planet_env == ::PlanetEnvironment::INVALID_PLANET_ENVIRONMENT)
+                return false;
+            return (m_environments_mask >> static_cast<unsigned int>(planet_env)) & 1u;
         }
 
-        const std::vector< ::PlanetEnvironment>&    m_environments;
-        const std::string&                          m_species;
-        const ObjectMap&                            m_objects;
+        const uint64_t   m_environments_mask;
+        const ::Species* m_species_obj;
+        PlanetFromObject m_planet_of;
     };
 }
 
@@ -4422,15 +5456,27 @@ void PlanetEnvironment::Eval(const ScriptingContext& parent_context,
         }
     }
     if (simple_eval_safe) {
-        // evaluate types once, and use to check all candidate objects
-        std::vector< ::PlanetEnvironment> environments;
-        environments.reserve(m_environments.size());
-        // get all types from valuerefs
-        for (auto& environment : m_environments)
-            environments.push_back(environment->Eval(parent_context));
+        uint64_t environments_mask;
+        if (m_constant_environments_mask) {
+            // all environments are constants, so the mask built at construction applies
+            environments_mask = *m_constant_environments_mask;
+        } else {
+            // evaluate environments once, and use to check all candidate objects
+            // inline-capacity buffer: these lists rarely exceed a few entries
+            boost::container::small_vector< ::PlanetEnvironment, 4> environments;
+            environments.reserve(m_environments.size());
+            for (auto& environment : m_environments)
+                environments.push_back(environment->Eval(parent_context));
+            environments_mask = EnumMembershipMask<::PlanetEnvironment::NUM_PLANET_ENVIRONMENTS>(environments);
+        }
         std::string species_name{m_species_name ? m_species_name->Eval(parent_context) : ""};
-        EvalImpl(matches, non_matches, search_domain,
-                 PlanetEnvironmentSimpleMatch(environments, parent_context.ContextObjects(), species_name));
+        if (species_name.empty())
+            EvalImpl(matches, non_matches, search_domain,
+                     PlanetEnvForPlanetSpeciesSimpleMatch(environments_mask, parent_context.ContextObjects()));
+        else
+            EvalImpl(matches, non_matches, search_domain,
+                     PlanetEnvForFixedSpeciesSimpleMatch(environments_mask, parent_context.ContextObjects(),
+                                                         species_name));
     } else {
         // re-evaluate contained objects for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -4486,8 +5532,7 @@ std::string PlanetEnvironment::Dump(unsigned short ntabs) const {
 void PlanetEnvironment::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_context,
                                                           ObjectSet& condition_non_targets) const
 {
-    AddPlanetSet(parent_context.ContextObjects(), condition_non_targets);
-    AddBuildingSet(parent_context.ContextObjects(), condition_non_targets);
+    AddPlanetBuildingSets(parent_context.ContextObjects(), condition_non_targets);
 }
 
 bool PlanetEnvironment::Match(const ScriptingContext& local_context) const {
@@ -4497,11 +5542,14 @@ bool PlanetEnvironment::Match(const ScriptingContext& local_context) const {
         return false;
     }
 
-    // is it a planet or on a planet? TODO: factor out
-    auto planet = dynamic_cast<const Planet*>(candidate);
-    const ::Building* building = nullptr;
-    if (!planet && (building = dynamic_cast<const ::Building*>(candidate)))
+    // is it a planet or on a planet?
+    const Planet* planet = nullptr;
+    if (candidate->ObjectType() == UniverseObjectType::OBJ_PLANET) {
+        planet = static_cast<const Planet*>(candidate);
+    } else if (candidate->ObjectType() == UniverseObjectType::OBJ_BUILDING) {
+        auto building = static_cast<const ::Building*>(candidate);
         planet = local_context.ContextObjects().getRaw<Planet>(building->PlanetID());
+    }
     if (!planet)
         return false;
 
@@ -4510,6 +5558,10 @@ bool PlanetEnvironment::Match(const ScriptingContext& local_context) const {
         species_name = m_species_name->Eval(local_context);
 
     auto env_for_planets_species = planet->EnvironmentForSpecies(species_name);
+    if (m_constant_environments_mask) {
+        return env_for_planets_species != ::PlanetEnvironment::INVALID_PLANET_ENVIRONMENT &&
+               ((*m_constant_environments_mask >> static_cast<unsigned int>(env_for_planets_species)) & 1u);
+    }
     for (auto& environment : m_environments) {
         if (environment->Eval(local_context) == env_for_planets_species)
             return true;
@@ -4529,7 +5581,8 @@ void PlanetEnvironment::SetTopLevelContent(const std::string& content_name) {
 unsigned int PlanetEnvironment::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::PlanetEnvironment");
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::PlanetEnvironment");
+    CheckSums::CheckSumCombine(retval, tag_checksum);
     CheckSums::CheckSumCombine(retval, m_environments);
     CheckSums::CheckSumCombine(retval, m_species_name);
 
@@ -4546,11 +5599,14 @@ std::unique_ptr<Condition> PlanetEnvironment::Clone() const {
 // Species                                               //
 ///////////////////////////////////////////////////////////
 Species::Species(std::vector<std::unique_ptr<ValueRef::ValueRef<std::string>>>&& names) :
-    m_names(std::move(names))
+    m_names(std::move(names)),
+    m_constant_names(ConstantSortedNames(m_names))
 {
-    m_root_candidate_invariant = boost::algorithm::all_of(m_names, [](auto& e){ return e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(m_names, [](auto& e){ return e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(m_names, [](auto& e){ return e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(m_names);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    m_refs_local_invariant = invariants[3];
 }
 
 Species::Species() :
@@ -4576,43 +5632,70 @@ bool Species::operator==(const Condition& rhs) const {
 
 namespace {
     const std::string& GetCandidateSpecies(const UniverseObject* candidate,
-                                           const ObjectMap& objects)
+                                           const ObjectMap& objects) noexcept
     {
-        // is it a population centre?
-        auto obj_type = candidate->ObjectType();
-        if (obj_type == UniverseObjectType::OBJ_PLANET) {
-            auto* pop = static_cast<const ::Planet*>(candidate);
-            return pop->SpeciesName();
-        }
-        else if (obj_type == UniverseObjectType::OBJ_SHIP) {
-            auto* ship = static_cast<const Ship*>(candidate);
-            return ship->SpeciesName();
-        }
-        else if (obj_type == UniverseObjectType::OBJ_BUILDING) {
+        // single dispatch on the type tag rather than a compare chain, as
+        // candidate sets mix planets, ships and buildings with other types
+        switch (candidate->ObjectType()) {
+        case UniverseObjectType::OBJ_PLANET:
+            return static_cast<const ::Planet*>(candidate)->SpeciesName();
+        case UniverseObjectType::OBJ_SHIP:
+            return static_cast<const Ship*>(candidate)->SpeciesName();
+        case UniverseObjectType::OBJ_BUILDING: {
             // is it a building on a planet?
             auto* building = static_cast<const ::Building*>(candidate);
             if (auto planet = objects.getRaw<Planet>(building->PlanetID()))
                 return planet->SpeciesName();
+            return EMPTY_STRING;
+        }
+        default:
+            return EMPTY_STRING;
         }
-        return EMPTY_STRING;
     }
 
+    template <typename NamesCont>
     struct SpeciesSimpleMatch {
-        SpeciesSimpleMatch(const std::vector<std::string>& names, const ObjectMap& objects) :
+        // \a names must be sorted so that per-candidate lookups can binary
+        // search instead of scanning the whole list
+        SpeciesSimpleMatch(const NamesCont& names, const ObjectMap& objects) :
             m_names(names),
-            m_objects(objects)
+            m_planet_of(objects)
         {}
 
-        bool operator()(const UniverseObject* candidate) const {
+        bool operator()(const UniverseObject* candidate) const noexcept {
             if (!candidate)
                 return false;
 
-            auto& species_name{GetCandidateSpecies(candidate, m_objects)};
-            return !species_name.empty() && (m_names.empty() || std::count(m_names.begin(), m_names.end(), species_name));
-        }
+            // ships carry their own species; planets directly and buildings
+            // via their planet, memoized so that consecutive buildings of
+            // one planet skip the repeat map lookup
+            const std::string* species_name = nullptr;
+            if (candidate->ObjectType() == UniverseObjectType::OBJ_SHIP)
+                species_name = &static_cast<const Ship*>(candidate)->SpeciesName();
+            else if (const auto* planet = m_planet_of(candidate))
+                species_name = &planet->SpeciesName();
+            else
+                return false;
 
-        const std::vector<std::string>& m_names;
-        const ObjectMap& m_objects;
+            if (species_name->empty())
+                return false;
+            if (m_names.empty())
+                return true;
+            // candidates cluster by species (buildings on one planet, one
+            // empire's ships), and SpeciesName() returns a reference to a
+            // stable string owned by the object, so identity of the last
+            // looked-up name frequently repeats and skips the search
+            if (species_name == m_last_name)
+                return m_last_result;
+            m_last_name = species_name;
+            m_last_result = std::binary_search(m_names.begin(), m_names.end(), *species_name);
+            return m_last_result;
+        }
+
+        const NamesCont& m_names;
+        PlanetFromObject m_planet_of;
+        mutable const std::string* m_last_name = nullptr;
+        mutable bool m_last_result = false;
     };
 }
 
@@ -4620,23 +5703,24 @@ void Species::Eval(const ScriptingContext& parent_context,
                    ObjectSet& matches, ObjectSet& non_matches,
                    SearchDomain search_domain) const
 {
-    bool simple_eval_safe = parent_context.condition_root_candidate || RootCandidateInvariant();
+    bool simple_eval_safe = m_refs_local_invariant &&
+        (parent_context.condition_root_candidate || RootCandidateInvariant());
     if (simple_eval_safe) {
-        // check each valueref for invariance to local candidate
-        for (auto& name : m_names) {
-            if (!name->LocalCandidateInvariant()) {
-                simple_eval_safe = false;
-                break;
-            }
+        if (m_constant_names) {
+            // all names were constant expressions: use the list evaluated
+            // and sorted at construction
+            EvalImpl(matches, non_matches, search_domain,
+                     SpeciesSimpleMatch(*m_constant_names, parent_context.ContextObjects()));
+            return;
         }
-    }
-    if (simple_eval_safe) {
-        // evaluate names once, and use to check all candidate objects
-        std::vector<std::string> names;
+        // evaluate names once, and use to check all candidate objects;
+        // stack storage, as content rarely specifies more than a few names
+        boost::container::small_vector<std::string, 4> names;
         names.reserve(m_names.size());
         // get all names from valuerefs
         for (auto& name : m_names)
             names.push_back(name->Eval(parent_context));
+        std::sort(names.begin(), names.end());
         EvalImpl(matches, non_matches, search_domain, SpeciesSimpleMatch(names, parent_context.ContextObjects()));
     } else {
         // re-evaluate allowed building types range for each candidate object
@@ -4646,19 +5730,14 @@ void Species::Eval(const ScriptingContext& parent_context,
 
 std::string Species::Description(bool negated) const {
     std::string values_str;
-    if (m_names.empty())
+    if (m_names.empty()) {
         values_str = "(" + UserString("CONDITION_ANY") +")";
-    for (unsigned int i = 0; i < m_names.size(); ++i) {
-        values_str += m_names[i]->ConstantExpr() ?
-                        UserString(m_names[i]->Eval()) :
-                        m_names[i]->Description();
-        if (2 <= m_names.size() && i < m_names.size() - 2) {
-            values_str += ", ";
-        } else if (i == m_names.size() - 2) {
-            values_str += m_names.size() < 3 ? " " : ", ";
-            values_str += UserString("OR");
-            values_str += " ";
-        }
+    } else {
+        std::vector<std::string> pieces;
+        pieces.reserve(m_names.size());
+        for (auto& name : m_names)
+            pieces.push_back(name->ConstantExpr() ? UserString(name->Eval()) : name->Description());
+        values_str = JoinWithOr(pieces);
     }
     return str(FlexibleFormat((!negated)
         ? UserString("DESC_SPECIES")
@@ -4685,9 +5764,7 @@ std::string Species::Dump(unsigned short ntabs) const {
 void Species::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_context,
                                                 ObjectSet& condition_non_targets) const
 {
-    AddPlanetSet(parent_context.ContextObjects(), condition_non_targets);
-    AddBuildingSet(parent_context.ContextObjects(), condition_non_targets);
-    AddShipSet(parent_context.ContextObjects(), condition_non_targets);
+    AddPlanetBuildingShipSets(parent_context.ContextObjects(), condition_non_targets);
 }
 
 bool Species::Match(const ScriptingContext& local_context) const {
@@ -4702,6 +5779,10 @@ bool Species::Match(const ScriptingContext& local_context) const {
     if (m_names.empty())
         return !species_name.empty();
 
+    if (m_constant_names)
+        return std::binary_search(m_constant_names->begin(), m_constant_names->end(),
+                                  species_name);
+
     for (auto& name : m_names) {
         if (name->Eval(local_context) == species_name)
             return true;
@@ -4715,13 +5796,16 @@ void Species::SetTopLevelContent(const std::string& content_name) {
         if (name)
             name->SetTopLevelContent(content_name);
     }
+    // string constants can change value here ("CurrentContent"), so the
+    // cached list has to be rebuilt
+    m_constant_names = ConstantSortedNames(m_names);
 }
 
 unsigned int Species::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Species");
-    CheckSums::CheckSumCombine(retval, m_names);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Species");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_names);
 
     TraceLogger(conditions) << "GetCheckSum(Species): retval: " << retval;
     return retval;
@@ -4730,6 +5814,19 @@ unsigned int Species::GetCheckSum() const {
 std::unique_ptr<Condition> Species::Clone() const
 { return std::make_unique<Species>(ValueRef::CloneUnique(m_names)); }
 
+std::unique_ptr<Condition> Species::TryFuseOr(const Condition& next) const {
+    const auto* other = dynamic_cast<const Species*>(&next);
+    // an empty name list matches any object with a species, which a merged
+    // list could not express
+    if (!other || m_names.empty() || other->m_names.empty())
+        return nullptr;
+    auto names = ValueRef::CloneUnique(m_names);
+    auto other_names = ValueRef::CloneUnique(other->m_names);
+    names.reserve(names.size() + other_names.size());
+    std::move(other_names.begin(), other_names.end(), std::back_inserter(names));
+    return std::make_unique<Species>(std::move(names));
+}
+
 ///////////////////////////////////////////////////////////
 // Enqueued                                              //
 ///////////////////////////////////////////////////////////
@@ -4745,9 +5842,11 @@ Enqueued::Enqueued(std::unique_ptr<ValueRef::ValueRef<int>>&& design_id,
 {
     std::array<const ValueRef::ValueRefBase*, 4> operands =
         {{m_design_id.get(), m_empire_id.get(), m_low.get(), m_high.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    m_refs_local_invariant = invariants[3];
 }
 
 Enqueued::Enqueued() :
@@ -4767,9 +5866,11 @@ Enqueued::Enqueued(BuildType build_type,
 {
     std::array<const ValueRef::ValueRefBase*, 4> operands =
         {{m_name.get(), m_empire_id.get(), m_low.get(), m_high.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    m_refs_local_invariant = invariants[3];
 }
 
 Enqueued::Enqueued(const Enqueued& rhs) :
@@ -4781,6 +5882,7 @@ Enqueued::Enqueued(const Enqueued& rhs) :
     m_low(ValueRef::CloneUnique(rhs.m_low)),
     m_high(ValueRef::CloneUnique(rhs.m_high))
 {
+    m_refs_local_invariant = rhs.m_refs_local_invariant;
 }
 
 bool Enqueued::operator==(const Condition& rhs) const {
@@ -4804,41 +5906,88 @@ bool Enqueued::operator==(const Condition& rhs) const {
 }
 
 namespace {
+    bool QueueElementMatches(const ProductionQueue::Element& element, BuildType build_type,
+                             const Universe& universe,
+                             std::string_view name, int design_id)
+    {
+        if (!(build_type == BuildType::INVALID_BUILD_TYPE || build_type == element.item.build_type))
+            return false;
+        if (build_type == BuildType::BT_BUILDING) {
+            // if looking for buildings, accept specifically named building
+            // or any building if no name specified
+            if (!name.empty() && element.item.name != name)
+                return false;
+        } else if (build_type == BuildType::BT_SHIP) {
+            if (design_id != INVALID_DESIGN_ID) {
+                // if looking for ships, accept design by id number...
+                if (design_id != element.item.design_id)
+                    return false;
+            } else if (!name.empty()) {
+                // ... or accept design by predefined name
+                const ShipDesign* design = universe.GetShipDesign(element.item.design_id);
+                if (!design || name != design->Name(false))
+                    return false;
+            }
+        } // else: looking for any production item
+        return true;
+    }
+
     int NumberOnQueue(const ProductionQueue& queue, BuildType build_type, const int location_id,
                       const Universe& universe,
-                      const std::string& name = "", int design_id = INVALID_DESIGN_ID)
+                      std::string_view name = "", int design_id = INVALID_DESIGN_ID)
     {
         int retval = 0;
         for (const auto& element : queue) {
-            if (!(build_type == BuildType::INVALID_BUILD_TYPE || build_type == element.item.build_type))
-                continue;
             if (location_id != element.location)
                 continue;
-            if (build_type == BuildType::BT_BUILDING) {
-                // if looking for buildings, accept specifically named building
-                // or any building if no name specified
-                if (!name.empty() && element.item.name != name)
-                    continue;
-            } else if (build_type == BuildType::BT_SHIP) {
-                if (design_id != INVALID_DESIGN_ID) {
-                    // if looking for ships, accept design by id number...
-                    if (design_id != element.item.design_id)
-                        continue;
-                } else if (!name.empty()) {
-                    // ... or accept design by predefined name
-                    const ShipDesign* design = universe.GetShipDesign(element.item.design_id);
-                    if (!design || name != design->Name(false))
-                        continue;
-                }
-            } // else: looking for any production item
-
-            retval += element.blocksize;
+            if (QueueElementMatches(element, build_type, universe, name, design_id))
+                retval += element.blocksize;
         }
         return retval;
     }
 
+    // tallies matching queue elements by location in a single pass over an
+    // empire's queue, so a sweep over many candidates costs one hash probe
+    // per candidate rather than a rescan of every queue
+    void TallyQueuedByLocation(const Empire& empire, BuildType build_type,
+                               const Universe& universe,
+                               std::string_view name, int design_id,
+                               std::unordered_map<int, int>& counts_by_location)
+    {
+        for (const auto& element : empire.GetProductionQueue()) {
+            if (QueueElementMatches(element, build_type, universe, name, design_id))
+                counts_by_location[element.location] += element.blocksize;
+        }
+    }
+
+    struct EnqueuedCountedMatch {
+        // callers must pass low <= high; an empty range should instead skip
+        // the per-candidate loop entirely
+        EnqueuedCountedMatch(const std::unordered_map<int, int>& counts_by_location,
+                             int low, int high) :
+            m_counts_by_location(counts_by_location),
+            m_low(low),
+            m_high(high)
+        {}
+
+        bool operator()(const UniverseObject* candidate) const {
+            if (!candidate)
+                return false;
+            const auto it = m_counts_by_location.find(candidate->ID());
+            const int count = (it == m_counts_by_location.end()) ? 0 : it->second;
+            // single unsigned compare instead of the two-branch range test:
+            // count < m_low wraps to a value above the range width
+            return static_cast<uint32_t>(count) - static_cast<uint32_t>(m_low) <=
+                   static_cast<uint32_t>(m_high) - static_cast<uint32_t>(m_low);
+        }
+
+        const std::unordered_map<int, int>& m_counts_by_location;
+        const int                           m_low;
+        const int                           m_high;
+    };
+
     struct EnqueuedSimpleMatch {
-        EnqueuedSimpleMatch(BuildType build_type, const std::string& name, int design_id,
+        EnqueuedSimpleMatch(BuildType build_type, std::string_view name, int design_id,
                             int empire_id, int low, int high, const ScriptingContext& context) :
             m_build_type(build_type),
             m_name(name),
@@ -4874,7 +6023,7 @@ namespace {
         }
 
         BuildType               m_build_type;
-        const std::string&      m_name;
+        std::string_view        m_name;
         int                     m_design_id;
         int                     m_empire_id;
         int                     m_low;
@@ -4887,16 +6036,8 @@ void Enqueued::Eval(const ScriptingContext& parent_context,
                     ObjectSet& matches, ObjectSet& non_matches,
                     SearchDomain search_domain) const
 {
-    bool simple_eval_safe = parent_context.condition_root_candidate || RootCandidateInvariant();
-    if (simple_eval_safe) {
-        // check each valueref for invariance to local candidate
-        if ((m_name &&      !m_name->LocalCandidateInvariant()) ||
-            (m_design_id && !m_design_id->LocalCandidateInvariant()) ||
-            (m_empire_id && !m_empire_id->LocalCandidateInvariant()) ||
-            (m_low &&       !m_low->LocalCandidateInvariant()) ||
-            (m_high &&      !m_high->LocalCandidateInvariant()))
-        { simple_eval_safe = false; }
-    }
+    bool simple_eval_safe = m_refs_local_invariant &&
+        (parent_context.condition_root_candidate || RootCandidateInvariant());
 
     if (simple_eval_safe) {
         // evaluate valuerefs once, and use to check all candidate objects
@@ -4914,11 +6055,36 @@ void Enqueued::Eval(const ScriptingContext& parent_context,
         if (!m_low && !m_high)
             low = 1;
 
-        // need to test each candidate separately using EvalImpl and EnqueuedSimpleMatch
-        // because the test checks that something is enqueued at the candidate location
-        EvalImpl(matches, non_matches, search_domain, EnqueuedSimpleMatch(m_build_type, name, design_id,
-                                                                          empire_id, low, high,
-                                                                          parent_context));
+        if (low > high) {
+            // empty range: matches nothing, and the counted matcher's
+            // unsigned range test requires low <= high
+            EvalImpl(matches, non_matches, search_domain,
+                     [](const UniverseObject*) { return false; });
+            return;
+        }
+
+        // tally the relevant queues by location once up front, then test
+        // each candidate location against the tally; scanning the queues
+        // inside the per-candidate functor would redo that work for every
+        // candidate
+        std::unordered_map<int, int> counts_by_location;
+        if (empire_id == ALL_EMPIRES) {
+            for ([[maybe_unused]] auto& [ignored_empire_id, empire] : parent_context.Empires()) {
+                (void)ignored_empire_id; // quiet unused variable warning
+                TallyQueuedByLocation(*empire, m_build_type, parent_context.ContextUniverse(),
+                                      name, design_id, counts_by_location);
+            }
+        } else if (auto empire = parent_context.GetEmpire(empire_id)) {
+            TallyQueuedByLocation(*empire, m_build_type, parent_context.ContextUniverse(),
+                                  name, design_id, counts_by_location);
+        } else {
+            // no such empire: nothing can be enqueued by it anywhere
+            EvalImpl(matches, non_matches, search_domain,
+                     [](const UniverseObject*) { return false; });
+            return;
+        }
+        EvalImpl(matches, non_matches, search_domain,
+                 EnqueuedCountedMatch(counts_by_location, low, high));
     } else {
         // re-evaluate allowed building types range for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -5026,27 +6192,15 @@ void Enqueued::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_
 }
 
 void Enqueued::SetTopLevelContent(const std::string& content_name) {
-    if (m_name)
-        m_name->SetTopLevelContent(content_name);
-    if (m_design_id)
-        m_design_id->SetTopLevelContent(content_name);
-    if (m_empire_id)
-        m_empire_id->SetTopLevelContent(content_name);
-    if (m_low)
-        m_low->SetTopLevelContent(content_name);
-    if (m_high)
-        m_high->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_name, m_design_id, m_empire_id, m_low, m_high);
 }
 
 unsigned int Enqueued::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Enqueued");
-    CheckSums::CheckSumCombine(retval, m_name);
-    CheckSums::CheckSumCombine(retval, m_design_id);
-    CheckSums::CheckSumCombine(retval, m_empire_id);
-    CheckSums::CheckSumCombine(retval, m_low);
-    CheckSums::CheckSumCombine(retval, m_high);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Enqueued");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_name, m_design_id, m_empire_id, m_low,
+                               m_high);
 
     TraceLogger(conditions) << "GetCheckSum(Enqueued): retval: " << retval;
     return retval;
@@ -5059,11 +6213,14 @@ std::unique_ptr<Condition> Enqueued::Clone() const
 // FocusType                                             //
 ///////////////////////////////////////////////////////////
 FocusType::FocusType(std::vector<std::unique_ptr<ValueRef::ValueRef<std::string>>>&& names) :
-    m_names(std::move(names))
+    m_names(std::move(names)),
+    m_constant_names(ConstantSortedNames(m_names))
 {
-    m_root_candidate_invariant = boost::algorithm::all_of(m_names, [](auto& e){ return e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(m_names, [](auto& e){ return e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(m_names, [](auto& e){ return e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(m_names);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    m_refs_local_invariant = invariants[3];
 }
 
 bool FocusType::operator==(const Condition& rhs) const {
@@ -5085,41 +6242,62 @@ bool FocusType::operator==(const Condition& rhs) const {
 
 namespace {
     const std::string& GetCandidateFocus(const UniverseObject* candidate,
-                                         const ObjectMap& objects)
+                                         const ObjectMap& objects) noexcept
     {
-        // is it a population centre?
-        auto obj_type = candidate->ObjectType();
-        if (obj_type == UniverseObjectType::OBJ_PLANET) {
-            auto* res = static_cast<const ::Planet*>(candidate);
-            return res->Focus();
-        }
-        else if (obj_type == UniverseObjectType::OBJ_BUILDING) {
+        // single dispatch on the type tag rather than a compare chain
+        switch (candidate->ObjectType()) {
+        case UniverseObjectType::OBJ_PLANET:
+            return static_cast<const ::Planet*>(candidate)->Focus();
+        case UniverseObjectType::OBJ_BUILDING: {
             // is it a building on a planet?
             auto* building = static_cast<const ::Building*>(candidate);
             if (auto planet = objects.getRaw<Planet>(building->PlanetID()))
                 return planet->Focus();
+            return EMPTY_STRING;
+        }
+        default:
+            return EMPTY_STRING;
         }
-        return EMPTY_STRING;
     }
 
+    template <typename NamesCont>
     struct FocusTypeSimpleMatch {
-        FocusTypeSimpleMatch(const std::vector<std::string>& names, const ObjectMap& objects) :
+        // \a names must be sorted so that per-candidate lookups can binary
+        // search instead of scanning the whole list
+        FocusTypeSimpleMatch(const NamesCont& names, const ObjectMap& objects) :
             m_names(names),
-            m_objects(objects)
+            m_planet_of(objects)
         {}
 
-        bool operator()(const UniverseObject* candidate) const {
+        bool operator()(const UniverseObject* candidate) const noexcept {
             if (!candidate)
                 return false;
 
-            auto& focus_name{GetCandidateFocus(candidate, m_objects)};
-            return !focus_name.empty() && (m_names.empty() || std::count(m_names.begin(), m_names.end(), focus_name));
-
-            return false;
-        }
-
-        const std::vector<std::string>& m_names;
-        const ObjectMap& m_objects;
+            // foci live on planets: planets directly, buildings via their
+            // planet, memoized so that consecutive buildings of one planet
+            // skip the repeat map lookup
+            const auto* planet = m_planet_of(candidate);
+            if (!planet)
+                return false;
+            auto& focus_name{planet->Focus()};
+            if (focus_name.empty())
+                return false;
+            if (m_names.empty())
+                return true;
+            // same last-name identity memo as SpeciesSimpleMatch: Focus()
+            // returns a reference to a stable string owned by the planet,
+            // and buildings on one planet arrive consecutively
+            if (&focus_name == m_last_name)
+                return m_last_result;
+            m_last_name = &focus_name;
+            m_last_result = std::binary_search(m_names.begin(), m_names.end(), focus_name);
+            return m_last_result;
+        }
+
+        const NamesCont& m_names;
+        PlanetFromObject m_planet_of;
+        mutable const std::string* m_last_name = nullptr;
+        mutable bool m_last_result = false;
     };
 }
 
@@ -5127,23 +6305,24 @@ void FocusType::Eval(const ScriptingContext& parent_context,
                      ObjectSet& matches, ObjectSet& non_matches,
                      SearchDomain search_domain) const
 {
-    bool simple_eval_safe = parent_context.condition_root_candidate || RootCandidateInvariant();
+    bool simple_eval_safe = m_refs_local_invariant &&
+        (parent_context.condition_root_candidate || RootCandidateInvariant());
     if (simple_eval_safe) {
-        // check each valueref for invariance to local candidate
-        for (auto& name : m_names) {
-            if (!name->LocalCandidateInvariant()) {
-                simple_eval_safe = false;
-                break;
-            }
+        if (m_constant_names) {
+            // all names were constant expressions: use the list evaluated
+            // and sorted at construction
+            EvalImpl(matches, non_matches, search_domain,
+                     FocusTypeSimpleMatch(*m_constant_names, parent_context.ContextObjects()));
+            return;
         }
-    }
-    if (simple_eval_safe) {
-        // evaluate names once, and use to check all candidate objects
-        std::vector<std::string> names;
+        // evaluate names once, and use to check all candidate objects;
+        // stack storage, as content rarely specifies more than a few names
+        boost::container::small_vector<std::string, 4> names;
         names.reserve(m_names.size());
         // get all names from valuerefs TODO: could lazy evaluate names rather than evaluating all and passing...
         for (auto& name : m_names)
             names.push_back(name->Eval(parent_context));
+        std::sort(names.begin(), names.end());
         EvalImpl(matches, non_matches, search_domain, FocusTypeSimpleMatch(names, parent_context.ContextObjects()));
     } else {
         // re-evaluate allowed building types range for each candidate object
@@ -5152,19 +6331,11 @@ void FocusType::Eval(const ScriptingContext& parent_context,
 }
 
 std::string FocusType::Description(bool negated) const {
-    std::string values_str;
-    for (unsigned int i = 0; i < m_names.size(); ++i) {
-        values_str += m_names[i]->ConstantExpr() ?
-            UserString(m_names[i]->Eval()) :
-            m_names[i]->Description();
-        if (2 <= m_names.size() && i < m_names.size() - 2) {
-            values_str += ", ";
-        } else if (i == m_names.size() - 2) {
-            values_str += m_names.size() < 3 ? " " : ", ";
-            values_str += UserString("OR");
-            values_str += " ";
-        }
-    }
+    std::vector<std::string> pieces;
+    pieces.reserve(m_names.size());
+    for (auto& name : m_names)
+        pieces.push_back(name->ConstantExpr() ? UserString(name->Eval()) : name->Description());
+    std::string values_str{JoinWithOr(pieces)};
     return str(FlexibleFormat((!negated)
         ? UserString("DESC_FOCUS_TYPE")
         : UserString("DESC_FOCUS_TYPE_NOT"))
@@ -5197,6 +6368,10 @@ bool FocusType::Match(const ScriptingContext& local_context) const {
     if (m_names.empty())
         return !focus_name.empty();
 
+    if (m_constant_names)
+        return std::binary_search(m_constant_names->begin(), m_constant_names->end(),
+                                  focus_name);
+
     for (auto& name : m_names) {
         if (name->Eval(local_context) == focus_name)
             return true;
@@ -5208,8 +6383,7 @@ bool FocusType::Match(const ScriptingContext& local_context) const {
 void FocusType::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_context,
                                                   ObjectSet& condition_non_targets) const
 {
-    AddPlanetSet(parent_context.ContextObjects(), condition_non_targets);
-    AddBuildingSet(parent_context.ContextObjects(), condition_non_targets);
+    AddPlanetBuildingSets(parent_context.ContextObjects(), condition_non_targets);
 }
 
 void FocusType::SetTopLevelContent(const std::string& content_name) {
@@ -5217,13 +6391,16 @@ void FocusType::SetTopLevelContent(const std::string& content_name) {
         if (name)
             name->SetTopLevelContent(content_name);
     }
+    // string constants can change value here ("CurrentContent"), so the
+    // cached list has to be rebuilt
+    m_constant_names = ConstantSortedNames(m_names);
 }
 
 unsigned int FocusType::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::FocusType");
-    CheckSums::CheckSumCombine(retval, m_names);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::FocusType");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_names);
 
     TraceLogger(conditions) << "GetCheckSum(FocusType): retval: " << retval;
     return retval;
@@ -5236,11 +6413,14 @@ std::unique_ptr<Condition> FocusType::Clone() const
 // StarType                                              //
 ///////////////////////////////////////////////////////////
 StarType::StarType(std::vector<std::unique_ptr<ValueRef::ValueRef< ::StarType>>>&& types) :
-    m_types(std::move(types))
+    m_types(std::move(types)),
+    m_constant_types_mask(ConstantEnumMembershipMask<::StarType::NUM_STAR_TYPES>(m_types))
 {
-    m_root_candidate_invariant = boost::algorithm::all_of(m_types, [](auto& e){ return e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(m_types, [](auto& e){ return e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(m_types, [](auto& e){ return e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(m_types);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    m_refs_local_invariant = invariants[3];
 }
 
 bool StarType::operator==(const Condition& rhs) const {
@@ -5262,26 +6442,30 @@ bool StarType::operator==(const Condition& rhs) const {
 
 namespace {
     struct StarTypeSimpleMatch {
-        StarTypeSimpleMatch(const std::vector< ::StarType>& types, const ObjectMap& objects) :
-            m_types(types),
+        StarTypeSimpleMatch(uint64_t types_mask, const ObjectMap& objects) :
+            m_types_mask(types_mask),
             m_objects(objects)
         {}
 
         bool operator()(const UniverseObject* candidate) const {
-            if (!candidate || m_types.empty())
+            if (!candidate)
                 return false;
 
-            if (candidate->ObjectType() == UniverseObjectType::OBJ_SYSTEM) {
-                auto system = static_cast<const System*>(candidate);
-                return std::count(m_types.begin(), m_types.end(), system->GetStarType());
-            } else if (auto system = m_objects.getRaw<System>(candidate->SystemID())) {
-                return std::count(m_types.begin(), m_types.end(), system->GetStarType());
-            } else {
+            const System* system = nullptr;
+            if (candidate->ObjectType() == UniverseObjectType::OBJ_SYSTEM)
+                system = static_cast<const System*>(candidate);
+            else
+                system = m_objects.getRaw<System>(candidate->SystemID());
+            if (!system)
                 return false;
-            }
+
+            auto star_type = system->GetStarType();
+            if (star_type == ::StarType::INVALID_STAR_TYPE)
+                return false;
+            return (m_types_mask >> static_cast<unsigned int>(star_type)) & 1u;
         }
 
-        const std::vector< ::StarType>& m_types;
+        const uint64_t m_types_mask;
         const ObjectMap& m_objects;
     };
 }
@@ -5290,24 +6474,25 @@ void StarType::Eval(const ScriptingContext& parent_context,
                     ObjectSet& matches, ObjectSet& non_matches,
                     SearchDomain search_domain) const
 {
-    bool simple_eval_safe = parent_context.condition_root_candidate || RootCandidateInvariant();
+    bool simple_eval_safe = m_refs_local_invariant &&
+        (parent_context.condition_root_candidate || RootCandidateInvariant());
     if (simple_eval_safe) {
-        // check each valueref for invariance to local candidate
-        for (auto& type : m_types) {
-            if (!type->LocalCandidateInvariant()) {
-                simple_eval_safe = false;
-                break;
-            }
+        if (m_constant_types_mask) {
+            // all types were constant expressions: use the mask computed at
+            // construction
+            EvalImpl(matches, non_matches, search_domain,
+                     StarTypeSimpleMatch(*m_constant_types_mask, parent_context.ContextObjects()));
+            return;
         }
-    }
-    if (simple_eval_safe) {
         // evaluate types once, and use to check all candidate objects
-        std::vector< ::StarType> types;
+        boost::container::small_vector< ::StarType, 4> types;
         types.reserve(m_types.size());
         // get all types from valuerefs
         for (auto& type : m_types)
             types.push_back(type->Eval(parent_context));
-        EvalImpl(matches, non_matches, search_domain, StarTypeSimpleMatch(types, parent_context.ContextObjects()));
+        EvalImpl(matches, non_matches, search_domain,
+                 StarTypeSimpleMatch(EnumMembershipMask<::StarType::NUM_STAR_TYPES>(types),
+                                     parent_context.ContextObjects()));
     } else {
         // re-evaluate contained objects for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -5315,19 +6500,11 @@ void StarType::Eval(const ScriptingContext& parent_context,
 }
 
 std::string StarType::Description(bool negated) const {
-    std::string values_str;
-    for (unsigned int i = 0; i < m_types.size(); ++i) {
-        values_str += m_types[i]->ConstantExpr() ?
-                        UserString(to_string(m_types[i]->Eval())) :
-                        m_types[i]->Description();
-        if (2 <= m_types.size() && i < m_types.size() - 2) {
-            values_str += ", ";
-        } else if (i == m_types.size() - 2) {
-            values_str += m_types.size() < 3 ? " " : ", ";
-            values_str += UserString("OR");
-            values_str += " ";
-        }
-    }
+    std::vector<std::string> pieces;
+    pieces.reserve(m_types.size());
+    for (auto& type : m_types)
+        pieces.push_back(type->ConstantExpr() ? UserString(to_string(type->Eval())) : type->Description());
+    std::string values_str{JoinWithOr(pieces)};
     return str(FlexibleFormat((!negated)
         ? UserString("DESC_STAR_TYPE")
         : UserString("DESC_STAR_TYPE_NOT"))
@@ -5350,7 +6527,7 @@ std::string StarType::Dump(unsigned short ntabs) const {
 
 bool StarType::Match(const ScriptingContext& local_context) const {
     const auto* candidate = local_context.condition_local_candidate;
-    if (!candidate) {
+    if (CONDITION_UNLIKELY(!candidate)) {
         ErrorLogger(conditions) << "StarType::Match passed no candidate object";
         return false;
     }
@@ -5367,6 +6544,10 @@ bool StarType::Match(const ScriptingContext& local_context) const {
         return false;
     }
 
+    if (m_constant_types_mask)
+        return star_type != ::StarType::INVALID_STAR_TYPE &&
+               ((*m_constant_types_mask >> static_cast<unsigned int>(star_type)) & 1u);
+
     for (auto& type : m_types) {
         if (type->Eval(local_context) == star_type)
             return true;
@@ -5379,13 +6560,22 @@ void StarType::SetTopLevelContent(const std::string& content_name) {
         if (type)
             (type)->SetTopLevelContent(content_name);
     }
+    m_checksum_cached.store(false); // content substitution can change the operands' checksums
 }
 
 unsigned int StarType::GetCheckSum() const {
+    // operands only change via SetTopLevelContent, which invalidates the
+    // cache, so the checksum can be memoized
+    if (m_checksum_cached.load())
+        return m_cached_checksum.load();
+
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::StarType");
-    CheckSums::CheckSumCombine(retval, m_types);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::StarType");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_types);
+
+    m_cached_checksum.store(retval);
+    m_checksum_cached.store(true);
 
     TraceLogger(conditions) << "GetCheckSum(StarType): retval: " << retval;
     return retval;
@@ -5403,6 +6593,8 @@ DesignHasHull::DesignHasHull(std::unique_ptr<ValueRef::ValueRef<std::string>>&&
     m_root_candidate_invariant = !m_name || m_name->RootCandidateInvariant();
     m_target_invariant = !m_name || m_name->TargetInvariant();
     m_source_invariant = !m_name || m_name->SourceInvariant();
+    if (m_name && m_name->ConstantExpr())
+        m_constant_name = m_name->Eval();
 }
 
 bool DesignHasHull::operator==(const Condition& rhs) const {
@@ -5420,29 +6612,24 @@ bool DesignHasHull::operator==(const Condition& rhs) const {
 
 namespace {
     struct DesignHasHullSimpleMatch {
-        DesignHasHullSimpleMatch(const std::string& name, const Universe& universe) :
-            m_name(name),
+        DesignHasHullSimpleMatch(std::string_view name, const Universe& universe) :
+            m_name_id(StringInterning::InternedID(name)),
             m_universe(universe)
         {}
 
-        bool operator()(const UniverseObject* candidate) const {
-            if (!candidate)
-                return false;
-
-            // is it a ship?
-            if (candidate->ObjectType() != UniverseObjectType::OBJ_SHIP)
-                return false;
-            auto* ship = static_cast<const ::Ship*>(candidate);
-
+        // candidate null and type checks are done by EvalTypedImpl
+        bool operator()(const ::Ship* ship) const {
             // with a valid design?
             const ShipDesign* design = m_universe.GetShipDesign(ship->DesignID());
             if (!design)
                 return false;
 
-            return design->Hull() == m_name;
+            // the sought name is interned once per Eval, so each ship costs a
+            // single integer compare instead of a string compare
+            return design->HullInternedID() == m_name_id;
         }
 
-        const std::string& m_name;
+        const std::uint32_t m_name_id;
         const Universe& m_universe;
     };
 }
@@ -5454,15 +6641,20 @@ void DesignHasHull::Eval(const ScriptingContext& parent_context,
     bool simple_eval_safe = (!m_name || m_name->LocalCandidateInvariant()) &&
                             (parent_context.condition_root_candidate || RootCandidateInvariant());
     if (simple_eval_safe) {
-        // evaluate number limits once, use to match all candidates
-        std::string name = (m_name ? m_name->Eval(parent_context) : "");
+        // evaluate the sought hull name once; constant names were already
+        // evaluated at construction
+        std::string name = (m_name && !m_constant_name) ? m_name->Eval(parent_context) : "";
+        const std::string& name_ref = m_constant_name ? *m_constant_name : name;
 
         // need to test each candidate separately using EvalImpl and because the
         // design of the candidate object is tested
-        EvalImpl(matches, non_matches, search_domain, DesignHasHullSimpleMatch(name, parent_context.ContextUniverse()));
+        EvalTypedImpl<::Ship>(matches, non_matches, search_domain, UniverseObjectType::OBJ_SHIP,
+                              DesignHasHullSimpleMatch(name_ref, parent_context.ContextUniverse()));
     } else {
-        // re-evaluate allowed turn range for each candidate object
-        Condition::Eval(parent_context, matches, non_matches, search_domain);
+        // re-evaluate the hull name for each candidate, but only ships can
+        // ever match, so other candidates skip the per-candidate context
+        EvalTypedFallback(parent_context, matches, non_matches, search_domain,
+                          UniverseObjectType::OBJ_SHIP);
     }
 }
 
@@ -5489,14 +6681,19 @@ std::string DesignHasHull::Dump(unsigned short ntabs) const {
 
 bool DesignHasHull::Match(const ScriptingContext& local_context) const {
     const auto* candidate = local_context.condition_local_candidate;
-    if (!candidate) {
+    if (CONDITION_UNLIKELY(!candidate)) {
         ErrorLogger(conditions) << "DesignHasHull::Match passed no candidate object";
         return false;
     }
 
-    std::string name = (m_name ? m_name->Eval(local_context) : "");
+    if (candidate->ObjectType() != UniverseObjectType::OBJ_SHIP)
+        return false;
+
+    std::string name = (m_name && !m_constant_name) ? m_name->Eval(local_context) : "";
+    const std::string& name_ref = m_constant_name ? *m_constant_name : name;
 
-    return DesignHasHullSimpleMatch(name, local_context.ContextUniverse())(candidate);
+    return DesignHasHullSimpleMatch(name_ref, local_context.ContextUniverse())(
+        static_cast<const ::Ship*>(candidate));
 }
 
 void DesignHasHull::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_context,
@@ -5508,13 +6705,25 @@ void DesignHasHull::GetDefaultInitialCandidateObjects(const ScriptingContext& pa
 void DesignHasHull::SetTopLevelContent(const std::string& content_name) {
     if (m_name)
         m_name->SetTopLevelContent(content_name);
+    // "CurrentContent" substitution can change a constant string's value
+    if (m_name && m_name->ConstantExpr())
+        m_constant_name = m_name->Eval();
+    m_checksum_cached.store(false); // content substitution can change the operands' checksums
 }
 
 unsigned int DesignHasHull::GetCheckSum() const {
+    // operands only change via SetTopLevelContent, which invalidates the
+    // cache, so the checksum can be memoized
+    if (m_checksum_cached.load())
+        return m_cached_checksum.load();
+
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::DesignHasHull");
-    CheckSums::CheckSumCombine(retval, m_name);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::DesignHasHull");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_name);
+
+    m_cached_checksum.store(retval);
+    m_checksum_cached.store(true);
 
     TraceLogger(conditions) << "GetCheckSum(DesignHasHull): retval: " << retval;
     return retval;
@@ -5534,9 +6743,16 @@ DesignHasPart::DesignHasPart(std::unique_ptr<ValueRef::ValueRef<std::string>>&&
     m_name(std::move(name))
 {
     std::array<const ValueRef::ValueRefBase*, 3> operands = {{m_name.get(), m_low.get(), m_high.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    if (m_name && m_name->ConstantExpr())
+        m_constant_name = m_name->Eval();
+    if (m_low && m_low->ConstantExpr())
+        m_constant_low = m_low->Eval();
+    if (m_high && m_high->ConstantExpr())
+        m_constant_high = m_high->Eval();
 }
 
 bool DesignHasPart::operator==(const Condition& rhs) const {
@@ -5556,11 +6772,13 @@ bool DesignHasPart::operator==(const Condition& rhs) const {
 
 namespace {
     struct DesignHasPartSimpleMatch {
-        DesignHasPartSimpleMatch(int low, int high, const std::string& name, const Universe& universe) :
+        DesignHasPartSimpleMatch(int low, int high, const std::string& name, const Universe& universe,
+                                 const boost::container::flat_set<int>* matching_ids = nullptr) :
             m_low(low),
             m_high(high),
             m_name(name),
-            m_universe(universe)
+            m_universe(universe),
+            m_matching_ids(matching_ids)
         {}
 
         bool operator()(const UniverseObject* candidate) const {
@@ -5579,26 +6797,67 @@ namespace {
             if (!ship)
                 return false;
 
-            // with a valid design?
-            const ShipDesign* design = m_universe.GetShipDesign(ship->DesignID());
+            const int design_id = ship->DesignID();
+
+            // a precomputed set of matching design ids collapses the whole
+            // test to a single probe
+            if (m_matching_ids)
+                return m_matching_ids->count(design_id) != 0;
+
+            // the result depends only on the ship's design, and a fleet has
+            // few distinct designs among many ships, so memoize per design id
+            const auto it = m_results_by_design.find(design_id);
+            if (it != m_results_by_design.end())
+                return it->second;
+
+            const bool result = DesignMatches(m_universe.GetShipDesign(design_id));
+            m_results_by_design.emplace(design_id, result);
+            return result;
+        }
+
+        bool DesignMatches(const ShipDesign* design) const {
             if (!design)
                 return false;
-
+            // number of copies of specified part, or total number of parts
+            // if no part name specified; per-part counts are already cached
+            // on the design, so no Parts() walk is needed
             int count = 0;
-            for (const std::string& name : design->Parts()) {
-                if (name == m_name || (m_name.empty() && !name.empty()))
-                    // number of copies of specified part,
-                    // or total number of parts if no part name specified
-                    ++count;
+            if (m_name.empty()) {
+                count = design->PartCount();
+            } else {
+                const auto& part_counts = design->ShipPartCount();
+                const auto name_it = part_counts.find(m_name);
+                if (name_it != part_counts.end())
+                    count = name_it->second;
             }
-            return (m_low <= count && count <= m_high);
+            return m_low <= count && count <= m_high;
         }
 
         int                 m_low;
         int                 m_high;
+        mutable boost::container::flat_map<int, bool> m_results_by_design;
         const std::string&  m_name;
         const Universe&     m_universe;
+        const boost::container::flat_set<int>* m_matching_ids = nullptr;
     };
+
+    /** Ids of the ship designs in \a universe whose DesignMatches \a pred
+      * accepts; design conditions with fully-constant operands evaluate this
+      * once per registry state and then test candidates with one probe. */
+    template <typename DesignPred>
+    boost::container::flat_set<int> MatchingDesignIDs(const Universe& universe,
+                                                      const DesignPred& pred)
+    {
+        std::vector<int> ids;
+        ids.reserve(universe.NumShipDesigns());
+        for (auto it = universe.beginShipDesigns(); it != universe.endShipDesigns(); ++it) {
+            if (pred.DesignMatches(it->second))
+                ids.push_back(it->first);
+        }
+        // the registry map iterates in id order, so the range is pre-sorted
+        return boost::container::flat_set<int>(
+            boost::container::ordered_unique_range, ids.begin(), ids.end());
+    }
 }
 
 void DesignHasPart::Eval(const ScriptingContext& parent_context,
@@ -5610,14 +6869,40 @@ void DesignHasPart::Eval(const ScriptingContext& parent_context,
                             (!m_name || m_name->LocalCandidateInvariant()) &&
                             (parent_context.condition_root_candidate || RootCandidateInvariant());
     if (simple_eval_safe) {
-        // evaluate number limits once, use to match all candidates
-        std::string name = (m_name ? m_name->Eval(parent_context) : "");
-        int low =          (m_low ? std::max(0, m_low->Eval(parent_context)) : 1);
-        int high =         (m_high ? std::min(m_high->Eval(parent_context), INT_MAX) : INT_MAX);
+        // evaluate name and number limits once, use to match all candidates;
+        // constant operands were already evaluated at construction
+        std::string name = (m_name && !m_constant_name) ? m_name->Eval(parent_context) : "";
+        const std::string& name_ref = m_constant_name ? *m_constant_name : name;
+        int low =  (m_low ? std::max(0, m_constant_low ? *m_constant_low : m_low->Eval(parent_context)) : 1);
+        int high = (m_high ? std::min(m_constant_high ? *m_constant_high : m_high->Eval(parent_context), INT_MAX) : INT_MAX);
+
+        const auto& universe = parent_context.ContextUniverse();
+
+        if ((!m_name || m_constant_name) && (!m_low || m_constant_low) && (!m_high || m_constant_high)) {
+            // fully-constant operands: the predicate is a fixed function of
+            // the design, so the matching design ids can be computed once per
+            // registry state and shared across Eval calls
+            boost::container::flat_set<int> matching_ids;
+            {
+                std::scoped_lock cache_lock(m_design_cache_mutex);
+                if (m_design_cache_universe != &universe ||
+                    m_design_cache_version != universe.ShipDesignsStateVersion())
+                {
+                    m_matching_design_ids = MatchingDesignIDs(
+                        universe, DesignHasPartSimpleMatch(low, high, name_ref, universe));
+                    m_design_cache_universe = &universe;
+                    m_design_cache_version = universe.ShipDesignsStateVersion();
+                }
+                matching_ids = m_matching_design_ids;
+            }
+            EvalImpl(matches, non_matches, search_domain,
+                     DesignHasPartSimpleMatch(low, high, name_ref, universe, &matching_ids));
+            return;
+        }
 
         // need to test each candidate separately using EvalImpl and because the
         // design of the candidate object is tested
-        EvalImpl(matches, non_matches, search_domain, DesignHasPartSimpleMatch(low, high, name, parent_context.ContextUniverse()));
+        EvalImpl(matches, non_matches, search_domain, DesignHasPartSimpleMatch(low, high, name_ref, universe));
     } else {
         // re-evaluate allowed turn range for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -5665,16 +6950,17 @@ std::string DesignHasPart::Dump(unsigned short ntabs) const {
 
 bool DesignHasPart::Match(const ScriptingContext& local_context) const {
     const auto* candidate = local_context.condition_local_candidate;
-    if (!candidate) {
+    if (CONDITION_UNLIKELY(!candidate)) {
         ErrorLogger(conditions) << "DesignHasPart::Match passed no candidate object";
         return false;
     }
 
-    int low =  (m_low ? std::max(0, m_low->Eval(local_context)) : 0);
-    int high = (m_high ? std::min(m_high->Eval(local_context), IMPOSSIBLY_LARGE_TURN) : IMPOSSIBLY_LARGE_TURN);
-    std::string name = (m_name ? m_name->Eval(local_context) : "");
+    int low =  (m_low ? std::max(0, m_constant_low ? *m_constant_low : m_low->Eval(local_context)) : 0);
+    int high = (m_high ? std::min(m_constant_high ? *m_constant_high : m_high->Eval(local_context), IMPOSSIBLY_LARGE_TURN) : IMPOSSIBLY_LARGE_TURN);
+    std::string name = (m_name && !m_constant_name) ? m_name->Eval(local_context) : "";
+    const std::string& name_ref = m_constant_name ? *m_constant_name : name;
 
-    return DesignHasPartSimpleMatch(low, high, name, local_context.ContextUniverse())(candidate);
+    return DesignHasPartSimpleMatch(low, high, name_ref, local_context.ContextUniverse())(candidate);
 }
 
 void DesignHasPart::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_context,
@@ -5690,15 +6976,30 @@ void DesignHasPart::SetTopLevelContent(const std::string& content_name) {
         m_high->SetTopLevelContent(content_name);
     if (m_name)
         m_name->SetTopLevelContent(content_name);
+    // "CurrentContent" substitution can change a constant string's value;
+    // constant ints are unaffected
+    if (m_name && m_name->ConstantExpr())
+        m_constant_name = m_name->Eval();
+    {
+        std::scoped_lock cache_lock(m_design_cache_mutex);
+        m_design_cache_universe = nullptr;  // substitution can change which designs match
+    }
+    m_checksum_cached.store(false); // content substitution can change the operands' checksums
 }
 
 unsigned int DesignHasPart::GetCheckSum() const {
+    // operands only change via SetTopLevelContent, which invalidates the
+    // cache, so the checksum can be memoized
+    if (m_checksum_cached.load())
+        return m_cached_checksum.load();
+
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::DesignHasPart");
-    CheckSums::CheckSumCombine(retval, m_low);
-    CheckSums::CheckSumCombine(retval, m_high);
-    CheckSums::CheckSumCombine(retval, m_name);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::DesignHasPart");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_low, m_high, m_name);
+
+    m_cached_checksum.store(retval);
+    m_checksum_cached.store(true);
 
     TraceLogger(conditions) << "GetCheckSum(DesignHasPart): retval: " << retval;
     return retval;
@@ -5721,9 +7022,14 @@ DesignHasPartClass::DesignHasPartClass(ShipPartClass part_class,
     m_class(std::move(part_class))
 {
     std::array<const ValueRef::ValueRefBase*, 2> operands = {{m_low.get(), m_high.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    if (m_low && m_low->ConstantExpr())
+        m_constant_low = m_low->Eval();
+    if (m_high && m_high->ConstantExpr())
+        m_constant_high = m_high->Eval();
 }
 
 bool DesignHasPartClass::operator==(const Condition& rhs) const {
@@ -5745,42 +7051,52 @@ bool DesignHasPartClass::operator==(const Condition& rhs) const {
 
 namespace {
     struct DesignHasPartClassSimpleMatch {
-        DesignHasPartClassSimpleMatch(int low, int high, ShipPartClass part_class, const Universe& universe) :
+        DesignHasPartClassSimpleMatch(int low, int high, ShipPartClass part_class, const Universe& universe,
+                                      const boost::container::flat_set<int>* matching_ids = nullptr) :
             m_low(low),
             m_high(high),
             m_part_class(part_class),
-            m_universe(universe)
+            m_universe(universe),
+            m_matching_ids(matching_ids)
         {}
 
-        bool operator()(const UniverseObject* candidate) const {
-            if (!candidate)
-                return false;
+        // candidate null and type checks are done by EvalTypedImpl
+        bool operator()(const ::Ship* ship) const {
+            const int design_id = ship->DesignID();
 
-            // is it a ship?
-            if (candidate->ObjectType() != UniverseObjectType::OBJ_SHIP)
-                return false;
-            auto* ship = static_cast<const ::Ship*>(candidate);
+            // a precomputed set of matching design ids collapses the whole
+            // test to a single probe
+            if (m_matching_ids)
+                return m_matching_ids->count(design_id) != 0;
 
-            // with a valid design?
-            const ShipDesign* design = m_universe.GetShipDesign(ship->DesignID());
-            if (!design)
-                return false;
+            // the result depends only on the ship's design, and a fleet has
+            // few distinct designs among many ships, so memoize per design id
+            const auto it = m_results_by_design.find(design_id);
+            if (it != m_results_by_design.end())
+                return it->second;
 
+            const bool result = DesignMatches(m_universe.GetShipDesign(design_id));
+            m_results_by_design.emplace(design_id, result);
+            return result;
+        }
 
-            int count = 0;
-            for (const std::string& name : design->Parts()) {
-                if (const ShipPart* ship_part = GetShipPart(name)) {
-                    if (ship_part->Class() == m_part_class)
-                        ++count;
-                }
-            }
-            return (m_low <= count && count <= m_high);
+        bool DesignMatches(const ShipDesign* design) const {
+            if (!design)
+                return false;
+            // per-class counts are already cached on the design, so no
+            // Parts() walk with a GetShipPart lookup per part is needed
+            const auto& class_counts = design->PartClassCount();
+            const auto class_it = class_counts.find(m_part_class);
+            const int count = (class_it == class_counts.end()) ? 0 : class_it->second;
+            return m_low <= count && count <= m_high;
         }
 
         int             m_low;
         int             m_high;
         ShipPartClass   m_part_class;
         const Universe& m_universe;
+        mutable boost::container::flat_map<int, bool> m_results_by_design;
+        const boost::container::flat_set<int>* m_matching_ids = nullptr;
     };
 }
 
@@ -5792,17 +7108,42 @@ void DesignHasPartClass::Eval(const ScriptingContext& parent_context,
                             (!m_high || m_high->LocalCandidateInvariant()) &&
                             (parent_context.condition_root_candidate || RootCandidateInvariant());
     if (simple_eval_safe) {
-        // evaluate number limits once, use to match all candidates
-        int low =          (m_low ? std::max(0, m_low->Eval(parent_context)) : 1);
-        int high =         (m_high ? std::min(m_high->Eval(parent_context), INT_MAX) : INT_MAX);
+        // evaluate number limits once, use to match all candidates; constant
+        // limits were already evaluated at construction
+        int low =  (m_low ? std::max(0, m_constant_low ? *m_constant_low : m_low->Eval(parent_context)) : 1);
+        int high = (m_high ? std::min(m_constant_high ? *m_constant_high : m_high->Eval(parent_context), INT_MAX) : INT_MAX);
+
+        const auto& universe = parent_context.ContextUniverse();
+
+        if ((!m_low || m_constant_low) && (!m_high || m_constant_high)) {
+            // fully-constant operands: compute the matching design ids once
+            // per registry state and share them across Eval calls
+            boost::container::flat_set<int> matching_ids;
+            {
+                std::scoped_lock cache_lock(m_design_cache_mutex);
+                if (m_design_cache_universe != &universe ||
+                    m_design_cache_version != universe.ShipDesignsStateVersion())
+                {
+                    m_matching_design_ids = MatchingDesignIDs(
+                        universe, DesignHasPartClassSimpleMatch(low, high, m_class, universe));
+                    m_design_cache_universe = &universe;
+                    m_design_cache_version = universe.ShipDesignsStateVersion();
+                }
+                matching_ids = m_matching_design_ids;
+            }
+            EvalTypedImpl<::Ship>(matches, non_matches, search_domain, UniverseObjectType::OBJ_SHIP,
+                                  DesignHasPartClassSimpleMatch(low, high, m_class, universe, &matching_ids));
+            return;
+        }
 
         // need to test each candidate separately using EvalImpl and because the
         // design of the candidate object is tested
-        EvalImpl(matches, non_matches, search_domain,
-                 DesignHasPartClassSimpleMatch(low, high, m_class, parent_context.ContextUniverse()));
+        EvalTypedImpl<::Ship>(matches, non_matches, search_domain, UniverseObjectType::OBJ_SHIP,
+                              DesignHasPartClassSimpleMatch(low, high, m_class, universe));
     } else {
-        // re-evaluate allowed turn range for each candidate object
-        Condition::Eval(parent_context, matches, non_matches, search_domain);
+        // re-evaluate the count limits for each candidate, ships only
+        EvalTypedFallback(parent_context, matches, non_matches, search_domain,
+                          UniverseObjectType::OBJ_SHIP);
     }
 }
 
@@ -5840,15 +7181,19 @@ std::string DesignHasPartClass::Dump(unsigned short ntabs) const {
 
 bool DesignHasPartClass::Match(const ScriptingContext& local_context) const {
     const auto* candidate = local_context.condition_local_candidate;
-    if (!candidate) {
+    if (CONDITION_UNLIKELY(!candidate)) {
         ErrorLogger(conditions) << "DesignHasPartClass::Match passed no candidate object";
         return false;
     }
 
-    int low =  (m_low ? m_low->Eval(local_context) : 0);
-    int high = (m_high ? m_high->Eval(local_context) : INT_MAX);
+    if (candidate->ObjectType() != UniverseObjectType::OBJ_SHIP)
+        return false;
+
+    int low =  (m_low ? (m_constant_low ? *m_constant_low : m_low->Eval(local_context)) : 0);
+    int high = (m_high ? (m_constant_high ? *m_constant_high : m_high->Eval(local_context)) : INT_MAX);
 
-    return DesignHasPartClassSimpleMatch(low, high, m_class, local_context.ContextUniverse())(candidate);
+    return DesignHasPartClassSimpleMatch(low, high, m_class, local_context.ContextUniverse())(
+        static_cast<const ::Ship*>(candidate));
 }
 
 void DesignHasPartClass::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_context,
@@ -5860,15 +7205,26 @@ void DesignHasPartClass::SetTopLevelContent(const std::string& content_name) {
         m_low->SetTopLevelContent(content_name);
     if (m_high)
         m_high->SetTopLevelContent(content_name);
+    {
+        std::scoped_lock cache_lock(m_design_cache_mutex);
+        m_design_cache_universe = nullptr;  // substitution can change which designs match
+    }
+    m_checksum_cached.store(false); // content substitution can change the operands' checksums
 }
 
 unsigned int DesignHasPartClass::GetCheckSum() const {
+    // operands only change via SetTopLevelContent, which invalidates the
+    // cache, so the checksum can be memoized
+    if (m_checksum_cached.load())
+        return m_cached_checksum.load();
+
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::DesignHasPartClass");
-    CheckSums::CheckSumCombine(retval, m_low);
-    CheckSums::CheckSumCombine(retval, m_high);
-    CheckSums::CheckSumCombine(retval, m_class);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::DesignHasPartClass");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_low, m_high, m_class);
+
+    m_cached_checksum.store(retval);
+    m_checksum_cached.store(true);
 
     TraceLogger(conditions) << "GetCheckSum(DesignHasPartClass): retval: " << retval;
     return retval;
@@ -5889,6 +7245,8 @@ PredefinedShipDesign::PredefinedShipDesign(std::unique_ptr<ValueRef::ValueRef<st
     m_root_candidate_invariant = !m_name || m_name->RootCandidateInvariant();
     m_target_invariant = !m_name || m_name->TargetInvariant();
     m_source_invariant = !m_name || m_name->SourceInvariant();
+    if (m_name && m_name->ConstantExpr())
+        m_constant_name = m_name->Eval();
 }
 
 bool PredefinedShipDesign::operator==(const Condition& rhs) const {
@@ -5908,22 +7266,32 @@ namespace {
     struct PredefinedShipDesignSimpleMatch {
         PredefinedShipDesignSimpleMatch(const Universe& u) :
             m_any_predef_design_ok(true),
-            m_name(EMPTY_STRING),
+            m_name_id(StringInterning::INVALID_INTERNED_ID),
             m_u(u)
         {}
 
-        PredefinedShipDesignSimpleMatch(const std::string& name, const Universe& u) :
+        PredefinedShipDesignSimpleMatch(std::string_view name, const Universe& u) :
             m_any_predef_design_ok(false),
-            m_name(name),
+            m_name_id(StringInterning::InternedID(name)),
             m_u(u)
         {}
 
-        bool operator()(const UniverseObject* candidate) const {
-            if (candidate->ObjectType() != UniverseObjectType::OBJ_SHIP)
-                return false;
-            auto* ship = static_cast<const Ship*>(candidate);
+        // candidate null and type checks are done by EvalTypedImpl
+        bool operator()(const ::Ship* ship) const {
+            // the result depends only on the ship's design, and a fleet has
+            // few distinct designs among many ships, so memoize per design id
+            const int design_id = ship->DesignID();
+            const auto it = m_results_by_design.find(design_id);
+            if (it != m_results_by_design.end())
+                return it->second;
 
-            const ShipDesign* candidate_design = m_u.GetShipDesign(ship->DesignID());
+            const bool result = DesignMatches(design_id);
+            m_results_by_design.emplace(design_id, result);
+            return result;
+        }
+
+        bool DesignMatches(int design_id) const {
+            const ShipDesign* candidate_design = m_u.GetShipDesign(design_id);
             if (!candidate_design)
                 return false;
 
@@ -5936,12 +7304,16 @@ namespace {
             if (m_any_predef_design_ok)
                 return true;    // any predefined design is OK; don't need to check name.
 
-            return (m_name == candidate_design->Name(false)); // don't look up in stringtable; predefined designs are stored by stringtable entry key
+            // compares interned IDs of the untranslated names, equivalent to
+            // m_name == candidate_design->Name(false); predefined designs are
+            // stored by stringtable entry key
+            return candidate_design->NameInternedID() == m_name_id;
         }
 
-        bool               m_any_predef_design_ok;
-        const std::string& m_name;
-        const Universe&    m_u;
+        bool                m_any_predef_design_ok;
+        const std::uint32_t m_name_id;
+        const Universe&     m_u;
+        mutable boost::container::flat_map<int, bool> m_results_by_design;
     };
 }
 
@@ -5955,16 +7327,19 @@ void PredefinedShipDesign::Eval(const ScriptingContext& parent_context,
         // testing each candidate to see if its design is predefined or is a
         // particular named predefined design
         if (!m_name) {
-            EvalImpl(matches, non_matches, search_domain,
-                     PredefinedShipDesignSimpleMatch(parent_context.ContextUniverse()));
+            EvalTypedImpl<::Ship>(matches, non_matches, search_domain, UniverseObjectType::OBJ_SHIP,
+                                  PredefinedShipDesignSimpleMatch(parent_context.ContextUniverse()));
         } else {
-            std::string name = m_name->Eval(parent_context);
-            EvalImpl(matches, non_matches, search_domain,
-                     PredefinedShipDesignSimpleMatch(name, parent_context.ContextUniverse()));
+            // constant names were already evaluated at construction
+            std::string name = m_constant_name ? std::string{} : m_name->Eval(parent_context);
+            const std::string& name_ref = m_constant_name ? *m_constant_name : name;
+            EvalTypedImpl<::Ship>(matches, non_matches, search_domain, UniverseObjectType::OBJ_SHIP,
+                                  PredefinedShipDesignSimpleMatch(name_ref, parent_context.ContextUniverse()));
         }
     } else {
-        // re-evaluate allowed turn range for each candidate object
-        Condition::Eval(parent_context, matches, non_matches, search_domain);
+        // re-evaluate the design name for each candidate, ships only
+        EvalTypedFallback(parent_context, matches, non_matches, search_domain,
+                          UniverseObjectType::OBJ_SHIP);
     }
 }
 
@@ -5991,28 +7366,45 @@ std::string PredefinedShipDesign::Dump(unsigned short ntabs) const {
 
 bool PredefinedShipDesign::Match(const ScriptingContext& local_context) const {
     const auto* candidate = local_context.condition_local_candidate;
-    if (!candidate) {
+    if (CONDITION_UNLIKELY(!candidate)) {
         ErrorLogger(conditions) << "PredefinedShipDesign::Match passed no candidate object";
         return false;
     }
 
+    if (candidate->ObjectType() != UniverseObjectType::OBJ_SHIP)
+        return false;
+    auto* ship = static_cast<const ::Ship*>(candidate);
+
     if (!m_name)
-        return PredefinedShipDesignSimpleMatch(local_context.ContextUniverse())(candidate);
+        return PredefinedShipDesignSimpleMatch(local_context.ContextUniverse())(ship);
 
-    std::string name = m_name->Eval(local_context);
-    return PredefinedShipDesignSimpleMatch(name, local_context.ContextUniverse())(candidate);
+    std::string name = m_constant_name ? std::string{} : m_name->Eval(local_context);
+    const std::string& name_ref = m_constant_name ? *m_constant_name : name;
+    return PredefinedShipDesignSimpleMatch(name_ref, local_context.ContextUniverse())(ship);
 }
 
 void PredefinedShipDesign::SetTopLevelContent(const std::string& content_name) {
     if (m_name)
         m_name->SetTopLevelContent(content_name);
+    // "CurrentContent" substitution can change a constant string's value
+    if (m_name && m_name->ConstantExpr())
+        m_constant_name = m_name->Eval();
+    m_checksum_cached.store(false); // content substitution can change the operands' checksums
 }
 
 unsigned int PredefinedShipDesign::GetCheckSum() const {
+    // operands only change via SetTopLevelContent, which invalidates the
+    // cache, so the checksum can be memoized
+    if (m_checksum_cached.load())
+        return m_cached_checksum.load();
+
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::PredefinedShipDesign");
-    CheckSums::CheckSumCombine(retval, m_name);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::PredefinedShipDesign");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_name);
+
+    m_cached_checksum.store(retval);
+    m_checksum_cached.store(true);
 
     TraceLogger(conditions) << "GetCheckSum(PredefinedShipDesign): retval: " << retval;
     return retval;
@@ -6051,17 +7443,18 @@ namespace {
             m_design_id(design_id)
         {}
 
-        bool operator()(const UniverseObject* candidate) const {
-            if (!candidate)
-                return false;
+        // candidate null and type checks are done by EvalTypedImpl
+        bool operator()(const ::Ship* ship) const noexcept {
             if (m_design_id == INVALID_DESIGN_ID)
                 return false;
-            if (auto ship = dynamic_cast<const Ship*>(candidate))
-                if (ship->DesignID() == m_design_id)
-                    return true;
-            return false;
+            return ship->DesignID() == m_design_id;
         }
 
+        // columnar form for EvalColumnImpl: non-ships gather as
+        // INVALID_DESIGN_ID, which never equals the (valid) sought id
+        void operator()(const int* design_ids, uint8_t* out_flags, std::size_t count) const
+        { FlagsEqI32(design_ids, count, m_design_id, out_flags); }
+
         int m_design_id;
     };
 }
@@ -6077,11 +7470,26 @@ void NumberedShipDesign::Eval(const ScriptingContext& parent_context,
         // evaluate design id once, and use to check all candidate objects
         int design_id = m_design_id->Eval(parent_context);
 
-        // design of the candidate objects is tested, so need to check each separately
-        EvalImpl(matches, non_matches, search_domain, NumberedShipDesignSimpleMatch(design_id));
+        if (design_id == INVALID_DESIGN_ID) {
+            // nothing can match an invalid id: skip the per-candidate checks
+            EvalImpl(matches, non_matches, search_domain,
+                     [](const UniverseObject*) { return false; });
+            return;
+        }
+
+        // the test reduces to one int compare per candidate, so gather the
+        // candidates' design ids into a column and run the compare kernel
+        // over it instead of dispatching a per-candidate predicate
+        EvalColumnImpl<int>(matches, non_matches, search_domain,
+                            [](const UniverseObject* o) {
+                                return o->ObjectType() == UniverseObjectType::OBJ_SHIP ?
+                                    static_cast<const ::Ship*>(o)->DesignID() : INVALID_DESIGN_ID;
+                            },
+                            NumberedShipDesignSimpleMatch(design_id));
     } else {
-        // re-evaluate design id for each candidate object
-        Condition::Eval(parent_context, matches, non_matches, search_domain);
+        // re-evaluate the design id for each candidate, ships only
+        EvalTypedFallback(parent_context, matches, non_matches, search_domain,
+                          UniverseObjectType::OBJ_SHIP);
     }
 }
 
@@ -6101,23 +7509,35 @@ std::string NumberedShipDesign::Dump(unsigned short ntabs) const
 
 bool NumberedShipDesign::Match(const ScriptingContext& local_context) const {
     const auto* candidate = local_context.condition_local_candidate;
-    if (!candidate) {
+    if (CONDITION_UNLIKELY(!candidate)) {
         ErrorLogger(conditions) << "NumberedShipDesign::Match passed no candidate object";
         return false;
     }
-    return NumberedShipDesignSimpleMatch(m_design_id->Eval(local_context))(candidate);
+    if (candidate->ObjectType() != UniverseObjectType::OBJ_SHIP)
+        return false;
+    return NumberedShipDesignSimpleMatch(m_design_id->Eval(local_context))(
+        static_cast<const ::Ship*>(candidate));
 }
 
 void NumberedShipDesign::SetTopLevelContent(const std::string& content_name) {
     if (m_design_id)
         m_design_id->SetTopLevelContent(content_name);
+    m_checksum_cached.store(false); // content substitution can change the operands' checksums
 }
 
 unsigned int NumberedShipDesign::GetCheckSum() const {
+    // operands only change via SetTopLevelContent, which invalidates the
+    // cache, so the checksum can be memoized
+    if (m_checksum_cached.load())
+        return m_cached_checksum.load();
+
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::NumberedShipDesign");
-    CheckSums::CheckSumCombine(retval, m_design_id);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::NumberedShipDesign");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_design_id);
+
+    m_cached_checksum.store(retval);
+    m_checksum_cached.store(true);
 
     TraceLogger(conditions) << "GetCheckSum(NumberedShipDesign): retval: " << retval;
     return retval;
@@ -6135,6 +7555,8 @@ ProducedByEmpire::ProducedByEmpire(std::unique_ptr<ValueRef::ValueRef<int>>&& em
     m_root_candidate_invariant = !m_empire_id || m_empire_id->RootCandidateInvariant();
     m_target_invariant = !m_empire_id || m_empire_id->TargetInvariant();
     m_source_invariant = !m_empire_id || m_empire_id->SourceInvariant();
+    if (m_empire_id && m_empire_id->ConstantExpr())
+        m_constant_empire_id = m_empire_id->Eval();
 }
 
 bool ProducedByEmpire::operator==(const Condition& rhs) const {
@@ -6156,17 +7578,26 @@ namespace {
             m_empire_id(empire_id)
         {}
 
-        bool operator()(const UniverseObject* candidate) const {
+        bool operator()(const UniverseObject* candidate) const noexcept {
             if (!candidate)
                 return false;
 
-            if (auto ship = dynamic_cast<const ::Ship*>(candidate))
-                return ship->ProducedByEmpireID() == m_empire_id;
-            else if (auto building = dynamic_cast<const ::Building*>(candidate))
-                return building->ProducedByEmpireID() == m_empire_id;
-            return false;
+            // type-tag dispatch instead of an RTTI walk per candidate
+            switch (candidate->ObjectType()) {
+            case UniverseObjectType::OBJ_SHIP:
+                return static_cast<const ::Ship*>(candidate)->ProducedByEmpireID() == m_empire_id;
+            case UniverseObjectType::OBJ_BUILDING:
+                return static_cast<const ::Building*>(candidate)->ProducedByEmpireID() == m_empire_id;
+            default:
+                return false;
+            }
         }
 
+        // columnar form for EvalColumnImpl: objects that are neither ships
+        // nor buildings gather as INT_MIN, which no empire id equals
+        void operator()(const int* producer_ids, uint8_t* out_flags, std::size_t count) const
+        { FlagsEqI32(producer_ids, count, m_empire_id, out_flags); }
+
         int m_empire_id;
     };
 }
@@ -6179,9 +7610,21 @@ void ProducedByEmpire::Eval(const ScriptingContext& parent_context,
                             (m_empire_id->LocalCandidateInvariant() &&
                             (parent_context.condition_root_candidate || RootCandidateInvariant()));
     if (simple_eval_safe) {
-        // evaluate empire id once, and use to check all candidate objects
-        int empire_id = m_empire_id->Eval(parent_context);
-        EvalImpl(matches, non_matches, search_domain, ProducedByEmpireSimpleMatch(empire_id));
+        // evaluate empire id once, gather the candidates' producer ids into
+        // a column, and compare the column against it
+        int empire_id = m_constant_empire_id ? *m_constant_empire_id : m_empire_id->Eval(parent_context);
+        EvalColumnImpl<int>(matches, non_matches, search_domain,
+                            [](const UniverseObject* o) {
+                                switch (o->ObjectType()) {
+                                case UniverseObjectType::OBJ_SHIP:
+                                    return static_cast<const ::Ship*>(o)->ProducedByEmpireID();
+                                case UniverseObjectType::OBJ_BUILDING:
+                                    return static_cast<const ::Building*>(o)->ProducedByEmpireID();
+                                default:
+                                    return INT_MIN;
+                                }
+                            },
+                            ProducedByEmpireSimpleMatch(empire_id));
     } else {
         // re-evaluate empire id for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -6207,8 +7650,14 @@ std::string ProducedByEmpire::Description(bool negated) const {
                % empire_str);
 }
 
-std::string ProducedByEmpire::Dump(unsigned short ntabs) const
-{ return DumpIndent(ntabs) + "ProducedByEmpire empire = " + m_empire_id->Dump(ntabs); }
+std::string ProducedByEmpire::Dump(unsigned short ntabs) const {
+    std::string retval;
+    retval.reserve(ntabs * 4 + 40);     // rough guess at operand dump length
+    retval += DumpIndent(ntabs);
+    retval += "ProducedByEmpire empire = ";
+    retval += m_empire_id->Dump(ntabs);
+    return retval;
+}
 
 bool ProducedByEmpire::Match(const ScriptingContext& local_context) const {
     const auto* candidate = local_context.condition_local_candidate;
@@ -6217,19 +7666,18 @@ bool ProducedByEmpire::Match(const ScriptingContext& local_context) const {
         return false;
     }
 
-    return ProducedByEmpireSimpleMatch(m_empire_id->Eval(local_context))(candidate);
+    return ProducedByEmpireSimpleMatch(m_constant_empire_id ? *m_constant_empire_id : m_empire_id->Eval(local_context))(candidate);
 }
 
 void ProducedByEmpire::SetTopLevelContent(const std::string& content_name) {
-    if (m_empire_id)
-        m_empire_id->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_empire_id);
 }
 
 unsigned int ProducedByEmpire::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::ProducedByEmpire");
-    CheckSums::CheckSumCombine(retval, m_empire_id);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::ProducedByEmpire");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_empire_id);
 
     TraceLogger(conditions) << "GetCheckSum(ProducedByEmpire): retval: " << retval;
     return retval;
@@ -6247,6 +7695,8 @@ Chance::Chance(std::unique_ptr<ValueRef::ValueRef<double>>&& chance) :
     m_root_candidate_invariant = !m_chance || m_chance->RootCandidateInvariant();
     m_target_invariant = !m_chance || m_chance->TargetInvariant();
     m_source_invariant = !m_chance || m_chance->SourceInvariant();
+    if (m_chance && m_chance->ConstantExpr())
+        m_constant_chance = m_chance->Eval();
 }
 
 bool Chance::operator==(const Condition& rhs) const {
@@ -6262,19 +7712,6 @@ bool Chance::operator==(const Condition& rhs) const {
     return true;
 }
 
-namespace {
-    struct ChanceSimpleMatch {
-        ChanceSimpleMatch(float chance) :
-            m_chance(chance)
-        {}
-
-        bool operator()(const UniverseObject*) const
-        { return RandZeroToOne() <= m_chance; }
-
-        float m_chance;
-    };
-}
-
 void Chance::Eval(const ScriptingContext& parent_context,
                   ObjectSet& matches, ObjectSet& non_matches,
                   SearchDomain search_domain) const
@@ -6283,12 +7720,31 @@ void Chance::Eval(const ScriptingContext& parent_context,
                             (m_chance->LocalCandidateInvariant() &&
                             (parent_context.condition_root_candidate || RootCandidateInvariant()));
     if (simple_eval_safe) {
-        // evaluate empire id once, and use to check all candidate objects
-        float chance = std::max(0.0, std::min(1.0, m_chance->Eval(parent_context)));
-        // chance is tested independently for each candidate object
-        EvalImpl(matches, non_matches, search_domain, ChanceSimpleMatch(chance));
+        // evaluate the chance once, and use to check all candidate objects
+        float chance = std::clamp(m_constant_chance ? *m_constant_chance : m_chance->Eval(parent_context), 0.0, 1.0);
+
+        // the chance is tested independently for each candidate; draw for
+        // the whole set under one generator lock instead of locking per
+        // candidate. the draw sequence matches per-candidate calls
+        const bool domain_matches = search_domain == SearchDomain::MATCHES;
+        auto& from_set = domain_matches ? matches : non_matches;
+        auto& to_set = domain_matches ? non_matches : matches;
+
+        static thread_local std::vector<double> draws;
+        draws.resize(from_set.size());
+        RandZeroToOneBatch(draws.data(), draws.size());
+
+        std::size_t keep_count = 0;
+        for (std::size_t i = 0; i < from_set.size(); ++i) {
+            const bool matched = draws[i] <= chance;
+            if (matched == domain_matches)
+                from_set[keep_count++] = from_set[i];
+            else
+                to_set.push_back(from_set[i]);
+        }
+        from_set.erase(from_set.begin() + keep_count, from_set.end());
     } else {
-        // re-evaluate empire id for each candidate object
+        // re-evaluate the chance for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
     }
 }
@@ -6298,7 +7754,7 @@ std::string Chance::Description(bool negated) const {
         return str(FlexibleFormat((!negated)
             ? UserString("DESC_CHANCE_PERCENTAGE")
             : UserString("DESC_CHANCE_PERCENTAGE_NOT"))
-                % std::to_string(std::max(0.0, std::min(m_chance->Eval(), 1.0)) * 100));
+                % std::to_string(std::clamp(m_chance->Eval(), 0.0, 1.0) * 100));
     } else {
         return str(FlexibleFormat((!negated)
             ? UserString("DESC_CHANCE")
@@ -6307,24 +7763,30 @@ std::string Chance::Description(bool negated) const {
     }
 }
 
-std::string Chance::Dump(unsigned short ntabs) const
-{ return DumpIndent(ntabs) + "Random probability = " + m_chance->Dump(ntabs) + "\n"; }
+std::string Chance::Dump(unsigned short ntabs) const {
+    std::string retval;
+    retval.reserve(ntabs * 4 + 40);     // rough guess at operand dump length
+    retval += DumpIndent(ntabs);
+    retval += "Random probability = ";
+    retval += m_chance->Dump(ntabs);
+    retval += "\n";
+    return retval;
+}
 
 bool Chance::Match(const ScriptingContext& local_context) const {
-    float chance = std::max(0.0, std::min(m_chance->Eval(local_context), 1.0));
+    float chance = std::clamp(m_constant_chance ? *m_constant_chance : m_chance->Eval(local_context), 0.0, 1.0);
     return RandZeroToOne() <= chance;
 }
 
 void Chance::SetTopLevelContent(const std::string& content_name) {
-    if (m_chance)
-        m_chance->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_chance);
 }
 
 unsigned int Chance::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Chance");
-    CheckSums::CheckSumCombine(retval, m_chance);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Chance");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_chance);
 
     TraceLogger(conditions) << "GetCheckSum(Chance): retval: " << retval;
     return retval;
@@ -6344,9 +7806,14 @@ MeterValue::MeterValue(MeterType meter,
     m_high(std::move(high))
 {
     std::array<const ValueRef::ValueRefBase*, 2> operands = {{m_low.get(), m_high.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    if (m_low && m_low->ConstantExpr())
+        m_constant_low = m_low->Eval();
+    if (m_high && m_high->ConstantExpr())
+        m_constant_high = m_high->Eval();
 }
 
 bool MeterValue::operator==(const Condition& rhs) const {
@@ -6386,51 +7853,63 @@ namespace {
             return false;
         }
 
+        // columnar form for EvalColumnImpl: objects without the meter gather
+        // as NaN, which the ordered range compares reject
+        void operator()(const float* values, uint8_t* out_flags, std::size_t count) const
+        { FlagsInRangeF32(values, count, m_low, m_high, out_flags); }
+
         float m_low;
         float m_high;
         MeterType m_meter_type;
     };
 
-    std::string MeterTypeDumpString(MeterType meter) {
-        switch (meter) {
-        case MeterType::INVALID_METER_TYPE:        return "INVALID_METER_TYPE"; break;
-        case MeterType::METER_TARGET_POPULATION:   return "TargetPopulation";   break;
-        case MeterType::METER_TARGET_INDUSTRY:     return "TargetIndustry";     break;
-        case MeterType::METER_TARGET_RESEARCH:     return "TargetResearch";     break;
-        case MeterType::METER_TARGET_INFLUENCE:    return "TargetInfluence";    break;
-        case MeterType::METER_TARGET_CONSTRUCTION: return "TargetConstruction"; break;
-        case MeterType::METER_TARGET_HAPPINESS:    return "TargetHappiness";    break;
-        case MeterType::METER_MAX_CAPACITY:        return "MaxCapacity";        break;
-        case MeterType::METER_MAX_SECONDARY_STAT:  return "MaxSecondaryStat";   break;
-        case MeterType::METER_MAX_FUEL:            return "MaxFuel";            break;
-        case MeterType::METER_MAX_SHIELD:          return "MaxShield";          break;
-        case MeterType::METER_MAX_STRUCTURE:       return "MaxStructure";       break;
-        case MeterType::METER_MAX_DEFENSE:         return "MaxDefense";         break;
-        case MeterType::METER_MAX_SUPPLY:          return "MaxSupply";          break;
-        case MeterType::METER_MAX_STOCKPILE:       return "MaxStockpile";       break;
-        case MeterType::METER_MAX_TROOPS:          return "MaxTroops";          break;
-        case MeterType::METER_POPULATION:          return "Population";         break;
-        case MeterType::METER_INDUSTRY:            return "Industry";           break;
-        case MeterType::METER_RESEARCH:            return "Research";           break;
-        case MeterType::METER_INFLUENCE:           return "Influence";          break;
-        case MeterType::METER_CONSTRUCTION:        return "Construction";       break;
-        case MeterType::METER_HAPPINESS:           return "Happiness";          break;
-        case MeterType::METER_CAPACITY:            return "Capacity";           break;
-        case MeterType::METER_SECONDARY_STAT:      return "SecondaryStat";      break;
-        case MeterType::METER_FUEL:                return "Fuel";               break;
-        case MeterType::METER_SHIELD:              return "Shield";             break;
-        case MeterType::METER_STRUCTURE:           return "Structure";          break;
-        case MeterType::METER_DEFENSE:             return "Defense";            break;
-        case MeterType::METER_SUPPLY:              return "Supply";             break;
-        case MeterType::METER_STOCKPILE:           return "Stockpile";          break;
-        case MeterType::METER_TROOPS:              return "Troops";             break;
-        case MeterType::METER_REBEL_TROOPS:        return "RebelTroops";        break;
-        case MeterType::METER_SIZE:                return "Size";               break;
-        case MeterType::METER_STEALTH:             return "Stealth";            break;
-        case MeterType::METER_DETECTION:           return "Detection";          break;
-        case MeterType::METER_SPEED:               return "Speed";              break;
-        default:                                   return "?Meter?";            break;
-        }
+    // indexed by static_cast<int>(meter) + 1, as MeterType starts at
+    // INVALID_METER_TYPE = -1
+    constexpr std::array<std::string_view,
+                         static_cast<std::size_t>(MeterType::NUM_METER_TYPES) + 1>
+        METER_TYPE_DUMP_STRINGS{{
+            "INVALID_METER_TYPE",
+            "TargetPopulation",
+            "TargetIndustry",
+            "TargetResearch",
+            "TargetInfluence",
+            "TargetConstruction",
+            "TargetHappiness",
+            "MaxCapacity",
+            "MaxSecondaryStat",
+            "MaxFuel",
+            "MaxShield",
+            "MaxStructure",
+            "MaxDefense",
+            "MaxSupply",
+            "MaxStockpile",
+            "MaxTroops",
+            "Population",
+            "Industry",
+            "Research",
+            "Influence",
+            "Construction",
+            "Happiness",
+            "Capacity",
+            "SecondaryStat",
+            "Fuel",
+            "Shield",
+            "Structure",
+            "Defense",
+            "Supply",
+            "Stockpile",
+            "Troops",
+            "RebelTroops",
+            "Size",
+            "Stealth",
+            "Detection",
+            "Speed"}};
+
+    constexpr std::string_view MeterTypeDumpString(MeterType meter) noexcept {
+        const auto idx = static_cast<std::size_t>(static_cast<int>(meter) + 1);
+        if (idx < METER_TYPE_DUMP_STRINGS.size())
+            return METER_TYPE_DUMP_STRINGS[idx];
+        return "?Meter?";
     }
 }
 
@@ -6442,10 +7921,17 @@ void MeterValue::Eval(const ScriptingContext& parent_context,
                              (!m_high || m_high->LocalCandidateInvariant()) &&
                              (parent_context.condition_root_candidate || RootCandidateInvariant()));
     if (simple_eval_safe) {
-        // evaluate number limits once, use to match all candidates
-        float low = (m_low ? m_low->Eval(parent_context) : -Meter::LARGE_VALUE);
-        float high = (m_high ? m_high->Eval(parent_context) : Meter::LARGE_VALUE);
-        EvalImpl(matches, non_matches, search_domain, MeterValueSimpleMatch(low, high, m_meter));
+        // evaluate number limits once, gather the candidates' meter values
+        // into a column, and range-test the column
+        float low = (m_low ? (m_constant_low ? *m_constant_low : m_low->Eval(parent_context)) : -Meter::LARGE_VALUE);
+        float high = (m_high ? (m_constant_high ? *m_constant_high : m_high->Eval(parent_context)) : Meter::LARGE_VALUE);
+        EvalColumnImpl<float>(matches, non_matches, search_domain,
+                              [meter_type{m_meter}](const UniverseObject* o) {
+                                  const Meter* meter = o->GetMeter(meter_type);
+                                  return meter ? meter->Initial()
+                                               : std::numeric_limits<float>::quiet_NaN();
+                              },
+                              MeterValueSimpleMatch(low, high, m_meter));
     } else {
         // re-evaluate allowed turn range for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -6485,12 +7971,18 @@ std::string MeterValue::Description(bool negated) const {
 }
 
 std::string MeterValue::Dump(unsigned short ntabs) const {
-    std::string retval = DumpIndent(ntabs);
+    std::string retval;
+    retval.reserve(ntabs * 4 + 60);     // rough guess at operand dump lengths
+    retval += DumpIndent(ntabs);
     retval += MeterTypeDumpString(m_meter);
-    if (m_low)
-        retval += " low = " + m_low->Dump(ntabs);
-    if (m_high)
-        retval += " high = " + m_high->Dump(ntabs);
+    if (m_low) {
+        retval += " low = ";
+        retval += m_low->Dump(ntabs);
+    }
+    if (m_high) {
+        retval += " high = ";
+        retval += m_high->Dump(ntabs);
+    }
     retval += "\n";
     return retval;
 }
@@ -6501,25 +7993,20 @@ bool MeterValue::Match(const ScriptingContext& local_context) const {
         ErrorLogger(conditions) << "MeterValue::Match passed no candidate object";
         return false;
     }
-    float low = (m_low ? m_low->Eval(local_context) : -Meter::LARGE_VALUE);
-    float high = (m_high ? m_high->Eval(local_context) : Meter::LARGE_VALUE);
+    float low = (m_low ? (m_constant_low ? *m_constant_low : m_low->Eval(local_context)) : -Meter::LARGE_VALUE);
+    float high = (m_high ? (m_constant_high ? *m_constant_high : m_high->Eval(local_context)) : Meter::LARGE_VALUE);
     return MeterValueSimpleMatch(low, high, m_meter)(candidate);
 }
 
 void MeterValue::SetTopLevelContent(const std::string& content_name) {
-    if (m_low)
-        m_low->SetTopLevelContent(content_name);
-    if (m_high)
-        m_high->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_low, m_high);
 }
 
 unsigned int MeterValue::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::MeterValue");
-    CheckSums::CheckSumCombine(retval, m_meter);
-    CheckSums::CheckSumCombine(retval, m_low);
-    CheckSums::CheckSumCombine(retval, m_high);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::MeterValue");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_meter, m_low, m_high);
 
     TraceLogger(conditions) << "GetCheckSum(MeterValue): retval: " << retval;
     return retval;
@@ -6544,9 +8031,16 @@ ShipPartMeterValue::ShipPartMeterValue(std::unique_ptr<ValueRef::ValueRef<std::s
     m_high(std::move(high))
 {
     std::array<const ValueRef::ValueRefBase*, 3> operands = {{m_part_name.get(), m_low.get(), m_high.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    if (m_part_name && m_part_name->ConstantExpr())
+        m_constant_part_name = m_part_name->Eval();
+    if (m_low && m_low->ConstantExpr())
+        m_constant_low = m_low->Eval();
+    if (m_high && m_high->ConstantExpr())
+        m_constant_high = m_high->Eval();
 }
 
 bool ShipPartMeterValue::operator==(const Condition& rhs) const {
@@ -6571,29 +8065,30 @@ namespace {
     struct ShipPartMeterValueSimpleMatch {
         ShipPartMeterValueSimpleMatch(const std::string& ship_part_name,
                                       MeterType meter, float low, float high) :
-            m_part_name(ship_part_name),
+            m_key(meter, ship_part_name),
             m_low(low),
-            m_high(high),
-            m_meter(meter)
+            m_high(high)
         {}
 
         bool operator()(const UniverseObject* candidate) const {
             if (!candidate)
                 return false;
-            auto ship = dynamic_cast<const Ship*>(candidate);
-            if (!ship)
+            // type-tag dispatch instead of an RTTI walk per candidate
+            if (candidate->ObjectType() != UniverseObjectType::OBJ_SHIP)
                 return false;
-            const Meter* meter = ship->GetPartMeter(m_meter, m_part_name);
+            auto ship = static_cast<const Ship*>(candidate);
+            const Meter* meter = ship->GetPartMeter(m_key);
             if (!meter)
                 return false;
             float meter_current = meter->Current();
             return (m_low <= meter_current && meter_current <= m_high);
         }
 
-        const std::string& m_part_name;
-        float              m_low;
-        float              m_high;
-        MeterType          m_meter;
+        // lookup key built once, so per-candidate GetPartMeter calls don't
+        // copy the part name into a temporary key pair
+        Ship::PartMeterMap::key_type m_key;
+        float                        m_low;
+        float                        m_high;
     };
 }
 
@@ -6607,10 +8102,11 @@ void ShipPartMeterValue::Eval(const ScriptingContext& parent_context,
                              (parent_context.condition_root_candidate || RootCandidateInvariant()));
     if (simple_eval_safe) {
         // evaluate number limits once, use to match all candidates
-        float low = (m_low ? m_low->Eval(parent_context) : -Meter::LARGE_VALUE);
-        float high = (m_high ? m_high->Eval(parent_context) : Meter::LARGE_VALUE);
-        std::string part_name = (m_part_name ? m_part_name->Eval(parent_context) : "");
-        EvalImpl(matches, non_matches, search_domain, ShipPartMeterValueSimpleMatch(part_name, m_meter, low, high));
+        float low = (m_low ? (m_constant_low ? *m_constant_low : m_low->Eval(parent_context)) : -Meter::LARGE_VALUE);
+        float high = (m_high ? (m_constant_high ? *m_constant_high : m_high->Eval(parent_context)) : Meter::LARGE_VALUE);
+        std::string part_name = (m_part_name && !m_constant_part_name) ? m_part_name->Eval(parent_context) : "";
+        const std::string& part_name_ref = m_constant_part_name ? *m_constant_part_name : part_name;
+        EvalImpl(matches, non_matches, search_domain, ShipPartMeterValueSimpleMatch(part_name_ref, m_meter, low, high));
     } else {
         // re-evaluate allowed turn range for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -6647,14 +8143,22 @@ std::string ShipPartMeterValue::Description(bool negated) const {
 }
 
 std::string ShipPartMeterValue::Dump(unsigned short ntabs) const {
-    std::string retval = DumpIndent(ntabs);
+    std::string retval;
+    retval.reserve(ntabs * 4 + 80);     // rough guess at operand dump lengths
+    retval += DumpIndent(ntabs);
     retval += MeterTypeDumpString(m_meter);
-    if (m_part_name)
-        retval += " part = " + m_part_name->Dump(ntabs);
-    if (m_low)
-        retval += " low = " + m_low->Dump(ntabs);
-    if (m_high)
-        retval += " high = " + m_high->Dump(ntabs);
+    if (m_part_name) {
+        retval += " part = ";
+        retval += m_part_name->Dump(ntabs);
+    }
+    if (m_low) {
+        retval += " low = ";
+        retval += m_low->Dump(ntabs);
+    }
+    if (m_high) {
+        retval += " high = ";
+        retval += m_high->Dump(ntabs);
+    }
     retval += "\n";
     return retval;
 }
@@ -6665,10 +8169,11 @@ bool ShipPartMeterValue::Match(const ScriptingContext& local_context) const {
         ErrorLogger(conditions) << "ShipPartMeterValue::Match passed no candidate object";
         return false;
     }
-    float low = (m_low ? m_low->Eval(local_context) : -Meter::LARGE_VALUE);
-    float high = (m_high ? m_high->Eval(local_context) : Meter::LARGE_VALUE);
-    std::string part_name = (m_part_name ? m_part_name->Eval(local_context) : "");
-    return ShipPartMeterValueSimpleMatch(std::move(part_name), m_meter, low, high)(candidate);
+    float low = (m_low ? (m_constant_low ? *m_constant_low : m_low->Eval(local_context)) : -Meter::LARGE_VALUE);
+    float high = (m_high ? (m_constant_high ? *m_constant_high : m_high->Eval(local_context)) : Meter::LARGE_VALUE);
+    std::string part_name = (m_part_name && !m_constant_part_name) ? m_part_name->Eval(local_context) : "";
+    const std::string& part_name_ref = m_constant_part_name ? *m_constant_part_name : part_name;
+    return ShipPartMeterValueSimpleMatch(part_name_ref, m_meter, low, high)(candidate);
 }
 
 void ShipPartMeterValue::SetTopLevelContent(const std::string& content_name) {
@@ -6678,16 +8183,16 @@ void ShipPartMeterValue::SetTopLevelContent(const std::string& content_name) {
         m_low->SetTopLevelContent(content_name);
     if (m_high)
         m_high->SetTopLevelContent(content_name);
+    // "CurrentContent" substitution can change a constant string's value
+    if (m_part_name && m_part_name->ConstantExpr())
+        m_constant_part_name = m_part_name->Eval();
 }
 
 unsigned int ShipPartMeterValue::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::ShipPartMeterValue");
-    CheckSums::CheckSumCombine(retval, m_part_name);
-    CheckSums::CheckSumCombine(retval, m_meter);
-    CheckSums::CheckSumCombine(retval, m_low);
-    CheckSums::CheckSumCombine(retval, m_high);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::ShipPartMeterValue");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_part_name, m_meter, m_low, m_high);
 
     TraceLogger(conditions) << "GetCheckSum(ShipPartMeterValue): retval: " << retval;
     return retval;
@@ -6719,9 +8224,16 @@ EmpireMeterValue::EmpireMeterValue(std::unique_ptr<ValueRef::ValueRef<int>>&& em
     m_high(std::move(high))
 {
     std::array<const ValueRef::ValueRefBase*, 3> operands = {{m_empire_id.get(), m_low.get(), m_high.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    if (m_empire_id && m_empire_id->ConstantExpr())
+        m_constant_empire_id = m_empire_id->Eval();
+    if (m_low && m_low->ConstantExpr())
+        m_constant_low = m_low->Eval();
+    if (m_high && m_high->ConstantExpr())
+        m_constant_high = m_high->Eval();
 }
 
 bool EmpireMeterValue::operator==(const Condition& rhs) const {
@@ -6743,6 +8255,46 @@ bool EmpireMeterValue::operator==(const Condition& rhs) const {
     return true;
 }
 
+namespace {
+    // matches objects whose owner's empire meter value lies in [low, high];
+    // meter pointers are resolved at most once per owning empire and
+    // memoized, so candidates sharing an owner skip the empire lookup and
+    // the string-keyed meter lookup
+    struct EmpireMeterValueSimpleMatch {
+        EmpireMeterValueSimpleMatch(const ScriptingContext& context,
+                                    const std::string& meter_name,
+                                    float low, float high) :
+            m_context(context),
+            m_meter_name(meter_name),
+            m_low(low),
+            m_high(high)
+        {}
+
+        bool operator()(const UniverseObject* candidate) const {
+            if (!candidate)
+                return false;
+            auto it = m_meters_by_empire.find(candidate->Owner());
+            if (it == m_meters_by_empire.end()) {
+                const Meter* found = nullptr;
+                if (auto empire = m_context.GetEmpire(candidate->Owner()))
+                    found = empire->GetMeter(m_meter_name);
+                it = m_meters_by_empire.emplace(candidate->Owner(), found).first;
+            }
+            const Meter* meter = it->second;
+            if (!meter)
+                return false;
+            float meter_current = meter->Current();
+            return (m_low <= meter_current && meter_current <= m_high);
+        }
+
+        const ScriptingContext& m_context;
+        const std::string&      m_meter_name;
+        float                   m_low;
+        float                   m_high;
+        mutable boost::container::flat_map<int, const Meter*> m_meters_by_empire;
+    };
+}
+
 void EmpireMeterValue::Eval(const ScriptingContext& parent_context,
                             ObjectSet& matches, ObjectSet& non_matches,
                             SearchDomain search_domain) const
@@ -6762,14 +8314,25 @@ void EmpireMeterValue::Eval(const ScriptingContext& parent_context,
         // specified empire meter was in the requested range
         if (search_domain == SearchDomain::MATCHES && !match) {
             // move all objects from matches to non_matches
-            non_matches.insert(non_matches.end(), matches.begin(), matches.end());
-            matches.clear();
+            MoveAll(matches, non_matches);
         } else if (search_domain == SearchDomain::NON_MATCHES && match) {
             // move all objects from non_matches to matches
-            matches.insert(matches.end(), non_matches.begin(), non_matches.end());
-            non_matches.clear();
+            MoveAll(non_matches, matches);
         }
 
+    } else if (!m_empire_id &&
+               (!m_low || m_low->LocalCandidateInvariant()) &&
+               (!m_high || m_high->LocalCandidateInvariant()) &&
+               (parent_context.condition_root_candidate || RootCandidateInvariant()))
+    {
+        // the empire is determined by each candidate's owner, but the meter
+        // name and bounds are fixed: evaluate the bounds once and resolve
+        // each owner's meter at most once across the whole candidate set
+        float low = (m_low ? (m_constant_low ? *m_constant_low : m_low->Eval(parent_context)) : -Meter::LARGE_VALUE);
+        float high = (m_high ? (m_constant_high ? *m_constant_high : m_high->Eval(parent_context)) : Meter::LARGE_VALUE);
+        EvalImpl(matches, non_matches, search_domain,
+                 EmpireMeterValueSimpleMatch(parent_context, m_meter, low, high));
+
     } else {
         // re-evaluate all parameters for each candidate object.
         // could optimize further by only re-evaluating the local-candidate
@@ -6808,14 +8371,24 @@ std::string EmpireMeterValue::Description(bool negated) const {
 }
 
 std::string EmpireMeterValue::Dump(unsigned short ntabs) const {
-    std::string retval = DumpIndent(ntabs) + "EmpireMeterValue";
-    if (m_empire_id)
-        retval += " empire = " + m_empire_id->Dump(ntabs);
-    retval += " meter = " + m_meter;
-    if (m_low)
-        retval += " low = " + m_low->Dump(ntabs);
-    if (m_high)
-        retval += " high = " + m_high->Dump(ntabs);
+    std::string retval;
+    retval.reserve(ntabs * 4 + 80 + m_meter.size());    // rough guess at operand dump lengths
+    retval += DumpIndent(ntabs);
+    retval += "EmpireMeterValue";
+    if (m_empire_id) {
+        retval += " empire = ";
+        retval += m_empire_id->Dump(ntabs);
+    }
+    retval += " meter = ";
+    retval += m_meter;
+    if (m_low) {
+        retval += " low = ";
+        retval += m_low->Dump(ntabs);
+    }
+    if (m_high) {
+        retval += " high = ";
+        retval += m_high->Dump(ntabs);
+    }
     retval += "\n";
     return retval;
 }
@@ -6823,25 +8396,22 @@ std::string EmpireMeterValue::Dump(unsigned short ntabs) const {
 bool EmpireMeterValue::Match(const ScriptingContext& local_context) const {
     int empire_id = ALL_EMPIRES;
     const auto* candidate = local_context.condition_local_candidate;
-    // if m_empire_id not set, default to candidate object's owner
-    if (!m_empire_id && !candidate) {
-        ErrorLogger(conditions) << "EmpireMeterValue::Match passed no candidate object but expects one due to having no empire id valueref specified and thus wanting to use the local candidate's owner as the empire id";
-        return false;
-
-    } else if (m_empire_id && !candidate && !m_empire_id->LocalCandidateInvariant()) {
-        ErrorLogger(conditions) << "EmpireMeterValue::Match passed no candidate object but but empire id valueref references the local candidate";
-        return false;
+    // if m_empire_id not set, default to candidate object's owner.
+    // test m_empire_id just once so each case is handled by one branch
+    if (m_empire_id) {
+        if (CONDITION_UNLIKELY(!candidate && !m_empire_id->LocalCandidateInvariant())) {
+            ErrorLogger(conditions) << "EmpireMeterValue::Match passed no candidate object but but empire id valueref references the local candidate";
+            return false;
+        }
+        // either candidate exists or m_empire_id is local-candidate-invariant (or both)
+        empire_id = m_constant_empire_id ? *m_constant_empire_id : m_empire_id->Eval(local_context);
 
-    } else if (!m_empire_id && candidate) {
+    } else if (candidate) {
         // default to candidate's owner if no empire id valueref is specified
         empire_id = candidate->Owner();
 
-    } else if (m_empire_id) {
-        // either candidate exists or m_empire_id is local-candidate-invariant (or both)
-        empire_id = m_empire_id->Eval(local_context);
-
     } else {
-        ErrorLogger(conditions) << "EmpireMeterValue::Match reached unexpected default case for candidate and empire id valueref existance";
+        ErrorLogger(conditions) << "EmpireMeterValue::Match passed no candidate object but expects one due to having no empire id valueref specified and thus wanting to use the local candidate's owner as the empire id";
         return false;
     }
 
@@ -6853,29 +8423,21 @@ bool EmpireMeterValue::Match(const ScriptingContext& local_context) const {
         return false;
 
     float meter_current = meter->Current();
-    float low =  (m_low ? m_low->Eval(local_context) : -Meter::LARGE_VALUE);
-    float high = (m_high ? m_high->Eval(local_context) : Meter::LARGE_VALUE);
+    float low =  (m_low ? (m_constant_low ? *m_constant_low : m_low->Eval(local_context)) : -Meter::LARGE_VALUE);
+    float high = (m_high ? (m_constant_high ? *m_constant_high : m_high->Eval(local_context)) : Meter::LARGE_VALUE);
 
     return (low <= meter_current && meter_current <= high);
 }
 
 void EmpireMeterValue::SetTopLevelContent(const std::string& content_name) {
-    if (m_empire_id)
-        m_empire_id->SetTopLevelContent(content_name);
-    if (m_low)
-        m_low->SetTopLevelContent(content_name);
-    if (m_high)
-        m_high->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_empire_id, m_low, m_high);
 }
 
 unsigned int EmpireMeterValue::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::EmpireMeterValue");
-    CheckSums::CheckSumCombine(retval, m_empire_id);
-    CheckSums::CheckSumCombine(retval, m_meter);
-    CheckSums::CheckSumCombine(retval, m_low);
-    CheckSums::CheckSumCombine(retval, m_high);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::EmpireMeterValue");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_empire_id, m_meter, m_low, m_high);
 
     TraceLogger(conditions) << "GetCheckSum(EmpireMeterValue): retval: " << retval;
     return retval;
@@ -6907,9 +8469,14 @@ EmpireStockpileValue::EmpireStockpileValue(std::unique_ptr<ValueRef::ValueRef<in
     m_high(std::move(high))
 {
     std::array<const ValueRef::ValueRefBase*, 3> operands = {{m_empire_id.get(), m_low.get(), m_high.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    if (m_low && m_low->ConstantExpr())
+        m_constant_low = m_low->Eval();
+    if (m_high && m_high->ConstantExpr())
+        m_constant_high = m_high->Eval();
 }
 
 bool EmpireStockpileValue::operator==(const Condition& rhs) const {
@@ -6951,12 +8518,10 @@ void EmpireStockpileValue::Eval(const ScriptingContext& parent_context,
         // specified empire meter was in the requested range
         if (search_domain == SearchDomain::MATCHES && !match) {
             // move all objects from matches to non_matches
-            non_matches.insert(non_matches.end(), matches.begin(), matches.end());
-            matches.clear();
+            MoveAll(matches, non_matches);
         } else if (search_domain == SearchDomain::NON_MATCHES && match) {
             // move all objects from non_matches to matches
-            matches.insert(matches.end(), non_matches.begin(), non_matches.end());
-            non_matches.clear();
+            MoveAll(non_matches, matches);
         }
 
     } else {
@@ -6982,14 +8547,24 @@ std::string EmpireStockpileValue::Description(bool negated) const {
                % high_str);
 }
 
+namespace {
+    // indexed by static_cast<int>(resource) + 1, as ResourceType starts at
+    // INVALID_RESOURCE_TYPE = -1; RE_STOCKPILE has no scripted condition
+    constexpr std::array<std::string_view, static_cast<std::size_t>(ResourceType::NUM_RESOURCE_TYPES) + 1>
+        STOCKPILE_DUMP_STRINGS{{
+            "?", "OwnerIndustryStockpile", "OwnerInfluenceStockpile", "OwnerResearchStockpile", "?"}};
+
+    constexpr std::string_view StockpileDumpString(ResourceType resource) noexcept {
+        const auto idx = static_cast<std::size_t>(static_cast<int>(resource) + 1);
+        if (idx < STOCKPILE_DUMP_STRINGS.size())
+            return STOCKPILE_DUMP_STRINGS[idx];
+        return "?";
+    }
+}
+
 std::string EmpireStockpileValue::Dump(unsigned short ntabs) const {
     std::string retval = DumpIndent(ntabs);
-    switch (m_stockpile) {
-    case ResourceType::RE_INFLUENCE: retval += "OwnerInfluenceStockpile";break;
-    case ResourceType::RE_RESEARCH:  retval += "OwnerResearchStockpile"; break;
-    case ResourceType::RE_INDUSTRY:  retval += "OwnerIndustryStockpile"; break;
-    default:                         retval += "?";                      break;
-    }
+    retval += StockpileDumpString(m_stockpile);
     if (m_empire_id)
         retval += " empire = " + m_empire_id->Dump(ntabs);
     if (m_low)
@@ -7003,25 +8578,22 @@ std::string EmpireStockpileValue::Dump(unsigned short ntabs) const {
 bool EmpireStockpileValue::Match(const ScriptingContext& local_context) const {
     int empire_id = ALL_EMPIRES;
     const auto* candidate = local_context.condition_local_candidate;
-    // if m_empire_id not set, default to candidate object's owner
-    if (!m_empire_id && !candidate) {
-        ErrorLogger(conditions) << "EmpireStockpileValue::Match passed no candidate object but expects one due to having no empire id valueref specified and thus wanting to use the local candidate's owner as the empire id";
-        return false;
-
-    } else if (m_empire_id && !candidate && !m_empire_id->LocalCandidateInvariant()) {
-        ErrorLogger(conditions) << "EmpireStockpileValue::Match passed no candidate object but but empire id valueref references the local candidate";
-        return false;
+    // if m_empire_id not set, default to candidate object's owner.
+    // test m_empire_id just once so each case is handled by one branch
+    if (m_empire_id) {
+        if (CONDITION_UNLIKELY(!candidate && !m_empire_id->LocalCandidateInvariant())) {
+            ErrorLogger(conditions) << "EmpireStockpileValue::Match passed no candidate object but but empire id valueref references the local candidate";
+            return false;
+        }
+        // either candidate exists or m_empire_id is local-candidate-invariant (or both)
+        empire_id = m_empire_id->Eval(local_context);
 
-    } else if (!m_empire_id && candidate) {
+    } else if (candidate) {
         // default to candidate's owner if no empire id valueref is specified
         empire_id = candidate->Owner();
 
-    } else if (m_empire_id) {
-        // either candidate exists or m_empire_id is local-candidate-invariant (or both)
-        empire_id = m_empire_id->Eval(local_context);
-
     } else {
-        ErrorLogger(conditions) << "EmpireStockpileValue::Match reached unexpected default case for candidate and empire id valueref existance";
+        ErrorLogger(conditions) << "EmpireStockpileValue::Match passed no candidate object but expects one due to having no empire id valueref specified and thus wanting to use the local candidate's owner as the empire id";
         return false;
     }
 
@@ -7030,8 +8602,8 @@ bool EmpireStockpileValue::Match(const ScriptingContext& local_context) const {
          return false;
 
     try {
-        float low = (m_low ? m_low->Eval(local_context) : -Meter::LARGE_VALUE);
-        float high = (m_high ? m_high->Eval(local_context) : Meter::LARGE_VALUE);
+        float low = (m_low ? static_cast<float>(m_constant_low ? *m_constant_low : m_low->Eval(local_context)) : -Meter::LARGE_VALUE);
+        float high = (m_high ? static_cast<float>(m_constant_high ? *m_constant_high : m_high->Eval(local_context)) : Meter::LARGE_VALUE);
         float amount = empire->ResourceStockpile(m_stockpile);
         return (low <= amount && amount <= high);
     } catch (...) {
@@ -7040,22 +8612,14 @@ bool EmpireStockpileValue::Match(const ScriptingContext& local_context) const {
 }
 
 void EmpireStockpileValue::SetTopLevelContent(const std::string& content_name) {
-    if (m_empire_id)
-        m_empire_id->SetTopLevelContent(content_name);
-    if (m_low)
-        m_low->SetTopLevelContent(content_name);
-    if (m_high)
-        m_high->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_empire_id, m_low, m_high);
 }
 
 unsigned int EmpireStockpileValue::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::EmpireStockpileValue");
-    CheckSums::CheckSumCombine(retval, m_empire_id);
-    CheckSums::CheckSumCombine(retval, m_stockpile);
-    CheckSums::CheckSumCombine(retval, m_low);
-    CheckSums::CheckSumCombine(retval, m_high);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::EmpireStockpileValue");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_empire_id, m_stockpile, m_low, m_high);
 
     TraceLogger(conditions) << "GetCheckSum(EmpireStockpileValue): retval: " << retval;
     return retval;
@@ -7077,9 +8641,12 @@ EmpireHasAdoptedPolicy::EmpireHasAdoptedPolicy(std::unique_ptr<ValueRef::ValueRe
     m_empire_id(std::move(empire_id))
 {
     std::array<const ValueRef::ValueRefBase*, 2> operands = {{m_name.get(), m_empire_id.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    if (m_name && m_name->ConstantExpr())
+        m_constant_name = m_name->Eval();
 }
 
 EmpireHasAdoptedPolicy::EmpireHasAdoptedPolicy(std::unique_ptr<ValueRef::ValueRef<std::string>>&& name) :
@@ -7102,6 +8669,37 @@ bool EmpireHasAdoptedPolicy::operator==(const Condition& rhs) const {
     return true;
 }
 
+namespace {
+    struct EmpireHasAdoptedPolicySimpleMatch {
+        EmpireHasAdoptedPolicySimpleMatch(const std::string& name, const ScriptingContext& context) :
+            m_name(name),
+            m_context(context)
+        {}
+
+        bool operator()(const UniverseObject* candidate) const {
+            if (!candidate || candidate->Unowned())
+                return false;
+            const int empire_id = candidate->Owner();
+
+            // the answer is fixed per empire for the whole evaluation, so
+            // resolve each owner at most once
+            auto it = m_results_by_empire.find(empire_id);
+            if (it != m_results_by_empire.end())
+                return it->second;
+
+            bool result = false;
+            if (auto empire = m_context.GetEmpire(empire_id))
+                result = empire->PolicyAdopted(m_name);
+            m_results_by_empire.emplace(empire_id, result);
+            return result;
+        }
+
+        const std::string&      m_name;
+        const ScriptingContext& m_context;
+        mutable boost::container::flat_map<int, bool> m_results_by_empire;
+    };
+}
+
 void EmpireHasAdoptedPolicy::Eval(const ScriptingContext& parent_context,
                                   ObjectSet& matches, ObjectSet& non_matches,
                                   SearchDomain search_domain) const
@@ -7120,14 +8718,24 @@ void EmpireHasAdoptedPolicy::Eval(const ScriptingContext& parent_context,
         // specified empire meter was in the requested range
         if (match && search_domain == SearchDomain::NON_MATCHES) {
             // move all objects from non_matches to matches
-            matches.insert(matches.end(), non_matches.begin(), non_matches.end());
-            non_matches.clear();
+            MoveAll(non_matches, matches);
         } else if (!match && search_domain == SearchDomain::MATCHES) {
             // move all objects from matches to non_matches
-            non_matches.insert(non_matches.end(), matches.begin(), matches.end());
-            matches.clear();
+            MoveAll(matches, non_matches);
         }
 
+    } else if (!m_empire_id &&
+               (!m_name || m_name->LocalCandidateInvariant()) &&
+               (parent_context.condition_root_candidate || RootCandidateInvariant()))
+    {
+        // no empire id specified, so the empire to check is each candidate's
+        // owner; the policy name is the same for all of them, so resolve it
+        // once and memoize the per-empire answers across the whole sweep
+        std::string name = (m_name && !m_constant_name) ? m_name->Eval(parent_context) : "";
+        const std::string& name_ref = m_constant_name ? *m_constant_name : name;
+        EvalImpl(matches, non_matches, search_domain,
+                 EmpireHasAdoptedPolicySimpleMatch(name_ref, parent_context));
+
     } else {
         // re-evaluate allowed turn range for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -7160,25 +8768,22 @@ std::string EmpireHasAdoptedPolicy::Dump(unsigned short ntabs) const {
 bool EmpireHasAdoptedPolicy::Match(const ScriptingContext& local_context) const {
     int empire_id = ALL_EMPIRES;
     const auto* candidate = local_context.condition_local_candidate;
-    // if m_empire_id not set, default to candidate object's owner
-    if (!m_empire_id && !candidate) {
-        ErrorLogger(conditions) << "EmpireHasAdoptedPolicy::Match passed no candidate object but expects one due to having no empire id valueref specified and thus wanting to use the local candidate's owner as the empire id";
-        return false;
-
-    } else if (m_empire_id && !candidate && !m_empire_id->LocalCandidateInvariant()) {
-        ErrorLogger(conditions) << "EmpireHasAdoptedPolicy::Match passed no candidate object but but empire id valueref references the local candidate";
-        return false;
+    // if m_empire_id not set, default to candidate object's owner.
+    // test m_empire_id just once so each case is handled by one branch
+    if (m_empire_id) {
+        if (CONDITION_UNLIKELY(!candidate && !m_empire_id->LocalCandidateInvariant())) {
+            ErrorLogger(conditions) << "EmpireHasAdoptedPolicy::Match passed no candidate object but but empire id valueref references the local candidate";
+            return false;
+        }
+        // either candidate exists or m_empire_id is local-candidate-invariant (or both)
+        empire_id = m_empire_id->Eval(local_context);
 
-    } else if (!m_empire_id && candidate) {
+    } else if (candidate) {
         // default to candidate's owner if no empire id valueref is specified
         empire_id = candidate->Owner();
 
-    } else if (m_empire_id) {
-        // either candidate exists or m_empire_id is local-candidate-invariant (or both)
-        empire_id = m_empire_id->Eval(local_context);
-
     } else {
-        ErrorLogger(conditions) << "EmpireHasAdoptedPolicy::Match reached unexpected default case for candidate and empire id valueref existance";
+        ErrorLogger(conditions) << "EmpireHasAdoptedPolicy::Match passed no candidate object but expects one due to having no empire id valueref specified and thus wanting to use the local candidate's owner as the empire id";
         return false;
     }
 
@@ -7186,9 +8791,10 @@ bool EmpireHasAdoptedPolicy::Match(const ScriptingContext& local_context) const
     if (!empire)
          return false;
 
-    std::string name = m_name ? m_name->Eval(local_context) : "";
+    std::string name = (m_name && !m_constant_name) ? m_name->Eval(local_context) : "";
+    const std::string& name_ref = m_constant_name ? *m_constant_name : name;
 
-    return empire->PolicyAdopted(name);
+    return empire->PolicyAdopted(name_ref);
 }
 
 void EmpireHasAdoptedPolicy::SetTopLevelContent(const std::string& content_name) {
@@ -7196,14 +8802,16 @@ void EmpireHasAdoptedPolicy::SetTopLevelContent(const std::string& content_name)
         m_empire_id->SetTopLevelContent(content_name);
     if (m_name)
         m_name->SetTopLevelContent(content_name);
+    // "CurrentContent" substitution can change a constant string's value
+    if (m_name && m_name->ConstantExpr())
+        m_constant_name = m_name->Eval();
 }
 
 unsigned int EmpireHasAdoptedPolicy::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::EmpireHasAdoptedPolicy");
-    CheckSums::CheckSumCombine(retval, m_empire_id);
-    CheckSums::CheckSumCombine(retval, m_name);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::EmpireHasAdoptedPolicy");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_empire_id, m_name);
 
     TraceLogger(conditions) << "GetCheckSum(EmpireHasAdoptedPolicy): retval: " << retval;
     return retval;
@@ -7223,9 +8831,12 @@ OwnerHasTech::OwnerHasTech(std::unique_ptr<ValueRef::ValueRef<int>>&& empire_id,
     m_empire_id(std::move(empire_id))
 {
     std::array<const ValueRef::ValueRefBase*, 2> operands = {{m_name.get(), m_empire_id.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    if (m_name && m_name->ConstantExpr())
+        m_constant_name = m_name->Eval();
 }
 
 OwnerHasTech::OwnerHasTech(std::unique_ptr<ValueRef::ValueRef<std::string>>&& name) :
@@ -7265,16 +8876,23 @@ namespace {
                 actual_empire_id = candidate->Owner();
             }
 
-            auto empire = m_context.GetEmpire(actual_empire_id);
-            if (!empire)
-                return false;
+            // the answer is fixed per empire for the whole evaluation, so
+            // resolve each owner at most once
+            auto it = m_results_by_empire.find(actual_empire_id);
+            if (it != m_results_by_empire.end())
+                return it->second;
 
-            return empire->TechResearched(m_name);
+            bool result = false;
+            if (auto empire = m_context.GetEmpire(actual_empire_id))
+                result = empire->TechResearched(m_name);
+            m_results_by_empire.emplace(actual_empire_id, result);
+            return result;
         }
 
         int                     m_empire_id = ALL_EMPIRES;
         const std::string&      m_name;
         const ScriptingContext& m_context;
+        mutable boost::container::flat_map<int, bool> m_results_by_empire;
     };
 }
 
@@ -7289,8 +8907,18 @@ void OwnerHasTech::Eval(const ScriptingContext& parent_context,
     if (simple_eval_safe) {
         // evaluate number limits once, use to match all candidates
         int empire_id = m_empire_id->Eval(parent_context);   // check above should ensure m_empire_id is non-null
-        std::string name = m_name ? m_name->Eval(parent_context) : "";
-        EvalImpl(matches, non_matches, search_domain, OwnerHasTechSimpleMatch(empire_id, name, parent_context));
+        std::string name = (m_name && !m_constant_name) ? m_name->Eval(parent_context) : "";
+        const std::string& name_ref = m_constant_name ? *m_constant_name : name;
+        if (empire_id != ALL_EMPIRES) {
+            // a fixed empire id means the answer is the same for every
+            // candidate: resolve it once and broadcast the boolean
+            const auto empire = parent_context.GetEmpire(empire_id);
+            const bool res = empire && empire->TechResearched(name_ref);
+            EvalImpl(matches, non_matches, search_domain,
+                     [res](const UniverseObject* candidate) { return candidate && res; });
+        } else {
+            EvalImpl(matches, non_matches, search_domain, OwnerHasTechSimpleMatch(empire_id, name_ref, parent_context));
+        }
     } else {
         // re-evaluate allowed turn range for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -7330,9 +8958,10 @@ bool OwnerHasTech::Match(const ScriptingContext& local_context) const {
     int empire_id = (m_empire_id ? m_empire_id->Eval(local_context) : candidate->Owner());
     if (empire_id == ALL_EMPIRES)
         return false;
-    std::string name = m_name ? m_name->Eval(local_context) : "";
+    std::string name = (m_name && !m_constant_name) ? m_name->Eval(local_context) : "";
+    const std::string& name_ref = m_constant_name ? *m_constant_name : name;
 
-    return OwnerHasTechSimpleMatch(empire_id, name, local_context)(candidate);
+    return OwnerHasTechSimpleMatch(empire_id, name_ref, local_context)(candidate);
 }
 
 void OwnerHasTech::SetTopLevelContent(const std::string& content_name) {
@@ -7340,14 +8969,16 @@ void OwnerHasTech::SetTopLevelContent(const std::string& content_name) {
         m_empire_id->SetTopLevelContent(content_name);
     if (m_name)
         m_name->SetTopLevelContent(content_name);
+    // "CurrentContent" substitution can change a constant string's value
+    if (m_name && m_name->ConstantExpr())
+        m_constant_name = m_name->Eval();
 }
 
 unsigned int OwnerHasTech::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::OwnerHasTech");
-    CheckSums::CheckSumCombine(retval, m_empire_id);
-    CheckSums::CheckSumCombine(retval, m_name);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::OwnerHasTech");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_empire_id, m_name);
 
     TraceLogger(conditions) << "GetCheckSum(OwnerHasTech): retval: " << retval;
     return retval;
@@ -7368,9 +8999,12 @@ OwnerHasBuildingTypeAvailable::OwnerHasBuildingTypeAvailable(
     m_empire_id(std::move(empire_id))
 {
     std::array<const ValueRef::ValueRefBase*, 2> operands = {{m_name.get(), m_empire_id.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    if (m_name && m_name->ConstantExpr())
+        m_constant_name = m_name->Eval();
 }
 
 OwnerHasBuildingTypeAvailable::OwnerHasBuildingTypeAvailable(const std::string& name) :
@@ -7415,16 +9049,23 @@ namespace {
                 actual_empire_id = candidate->Owner();
             }
 
-            auto empire = m_context.GetEmpire(actual_empire_id);
-            if (!empire)
-                return false;
+            // the answer is fixed per empire for the whole evaluation, so
+            // resolve each owner at most once
+            auto it = m_results_by_empire.find(actual_empire_id);
+            if (it != m_results_by_empire.end())
+                return it->second;
 
-            return empire->BuildingTypeAvailable(m_name);
+            bool result = false;
+            if (auto empire = m_context.GetEmpire(actual_empire_id))
+                result = empire->BuildingTypeAvailable(m_name);
+            m_results_by_empire.emplace(actual_empire_id, result);
+            return result;
         }
 
         int                     m_empire_id = ALL_EMPIRES;
         const std::string&      m_name;
         const ScriptingContext& m_context;
+        mutable boost::container::flat_map<int, bool> m_results_by_empire;
     };
 }
 
@@ -7439,8 +9080,18 @@ void OwnerHasBuildingTypeAvailable::Eval(const ScriptingContext& parent_context,
     if (simple_eval_safe) {
         // evaluate number limits once, use to match all candidates
         int empire_id = m_empire_id->Eval(parent_context);   // check above should ensure m_empire_id is non-null
-        std::string name = m_name ? m_name->Eval(parent_context) : "";
-        EvalImpl(matches, non_matches, search_domain, OwnerHasBuildingTypeAvailableSimpleMatch(empire_id, name, parent_context));
+        std::string name = (m_name && !m_constant_name) ? m_name->Eval(parent_context) : "";
+        const std::string& name_ref = m_constant_name ? *m_constant_name : name;
+        if (empire_id != ALL_EMPIRES) {
+            // a fixed empire id means the answer is the same for every
+            // candidate: resolve it once and broadcast the boolean
+            const auto empire = parent_context.GetEmpire(empire_id);
+            const bool res = empire && empire->BuildingTypeAvailable(name_ref);
+            EvalImpl(matches, non_matches, search_domain,
+                     [res](const UniverseObject* candidate) { return candidate && res; });
+        } else {
+            EvalImpl(matches, non_matches, search_domain, OwnerHasBuildingTypeAvailableSimpleMatch(empire_id, name_ref, parent_context));
+        }
     } else {
         // re-evaluate allowed turn range for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -7475,9 +9126,10 @@ bool OwnerHasBuildingTypeAvailable::Match(const ScriptingContext& local_context)
     int empire_id = (m_empire_id ? m_empire_id->Eval(local_context) : candidate->Owner());
     if (empire_id == ALL_EMPIRES)
         return false;
-    std::string name = m_name ? m_name->Eval(local_context) : "";
+    std::string name = (m_name && !m_constant_name) ? m_name->Eval(local_context) : "";
+    const std::string& name_ref = m_constant_name ? *m_constant_name : name;
 
-    return OwnerHasBuildingTypeAvailableSimpleMatch(empire_id, name, local_context)(candidate);
+    return OwnerHasBuildingTypeAvailableSimpleMatch(empire_id, name_ref, local_context)(candidate);
 }
 
 void OwnerHasBuildingTypeAvailable::SetTopLevelContent(const std::string& content_name) {
@@ -7485,14 +9137,16 @@ void OwnerHasBuildingTypeAvailable::SetTopLevelContent(const std::string& conten
         m_empire_id->SetTopLevelContent(content_name);
     if (m_name)
         m_name->SetTopLevelContent(content_name);
+    // "CurrentContent" substitution can change a constant string's value
+    if (m_name && m_name->ConstantExpr())
+        m_constant_name = m_name->Eval();
 }
 
 unsigned int OwnerHasBuildingTypeAvailable::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::OwnerHasBuildingTypeAvailable");
-    CheckSums::CheckSumCombine(retval, m_empire_id);
-    CheckSums::CheckSumCombine(retval, m_name);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::OwnerHasBuildingTypeAvailable");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_empire_id, m_name);
 
     TraceLogger(conditions) << "GetCheckSum(OwnerHasBuildingTypeAvailable): retval: " << retval;
     return retval;
@@ -7513,9 +9167,14 @@ OwnerHasShipDesignAvailable::OwnerHasShipDesignAvailable(
     m_empire_id(std::move(empire_id))
 {
     std::array<const ValueRef::ValueRefBase*, 2> operands = {{m_id.get(), m_empire_id.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    if (m_id && m_id->ConstantExpr())
+        m_constant_id = m_id->Eval();
+    if (m_empire_id && m_empire_id->ConstantExpr())
+        m_constant_empire_id = m_empire_id->Eval();
 }
 
 OwnerHasShipDesignAvailable::OwnerHasShipDesignAvailable(int design_id) :
@@ -7559,16 +9218,23 @@ namespace {
                 actual_empire_id = candidate->Owner();
             }
 
-            auto empire = m_context.GetEmpire(actual_empire_id);
-            if (!empire)
-                return false;
+            // the answer is fixed per empire for the whole evaluation, so
+            // resolve each owner at most once
+            auto it = m_results_by_empire.find(actual_empire_id);
+            if (it != m_results_by_empire.end())
+                return it->second;
 
-            return empire->ShipDesignAvailable(m_id, m_context.ContextUniverse());
+            bool result = false;
+            if (auto empire = m_context.GetEmpire(actual_empire_id))
+                result = empire->ShipDesignAvailable(m_id, m_context.ContextUniverse());
+            m_results_by_empire.emplace(actual_empire_id, result);
+            return result;
         }
 
         int                     m_empire_id = ALL_EMPIRES;
         int                     m_id = INVALID_DESIGN_ID;
         const ScriptingContext& m_context;
+        mutable boost::container::flat_map<int, bool> m_results_by_empire;
     };
 }
 
@@ -7582,9 +9248,19 @@ void OwnerHasShipDesignAvailable::Eval(const ScriptingContext& parent_context,
                              (parent_context.condition_root_candidate || RootCandidateInvariant()));
     if (simple_eval_safe) {
         // evaluate number limits once, use to match all candidates
-        int empire_id = m_empire_id->Eval(parent_context);   // check above should ensure m_empire_id is non-null
-        int design_id = m_id ? m_id->Eval(parent_context) : INVALID_DESIGN_ID;
-        EvalImpl(matches, non_matches, search_domain, OwnerHasShipDesignAvailableSimpleMatch(empire_id, design_id, parent_context));
+        int empire_id = m_constant_empire_id ? *m_constant_empire_id :
+            m_empire_id->Eval(parent_context);   // check above should ensure m_empire_id is non-null
+        int design_id = m_id ? (m_constant_id ? *m_constant_id : m_id->Eval(parent_context)) : INVALID_DESIGN_ID;
+        if (empire_id != ALL_EMPIRES) {
+            // a fixed empire id means the answer is the same for every
+            // candidate: resolve it once and broadcast the boolean
+            const auto empire = parent_context.GetEmpire(empire_id);
+            const bool res = empire && empire->ShipDesignAvailable(design_id, parent_context.ContextUniverse());
+            EvalImpl(matches, non_matches, search_domain,
+                     [res](const UniverseObject* candidate) { return candidate && res; });
+        } else {
+            EvalImpl(matches, non_matches, search_domain, OwnerHasShipDesignAvailableSimpleMatch(empire_id, design_id, parent_context));
+        }
     } else {
         // re-evaluate allowed turn range for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -7600,11 +9276,18 @@ std::string OwnerHasShipDesignAvailable::Description(bool negated) const {
 }
 
 std::string OwnerHasShipDesignAvailable::Dump(unsigned short ntabs) const {
-    std::string retval = DumpIndent(ntabs) + "OwnerHasShipDesignAvailable";
-    if (m_empire_id)
-        retval += " empire = " + m_empire_id->Dump(ntabs);
-    if (m_id)
-        retval += " id = " + m_id->Dump(ntabs);
+    std::string retval;
+    retval.reserve(ntabs * 4 + 60);     // rough guess at operand dump length
+    retval += DumpIndent(ntabs);
+    retval += "OwnerHasShipDesignAvailable";
+    if (m_empire_id) {
+        retval += " empire = ";
+        retval += m_empire_id->Dump(ntabs);
+    }
+    if (m_id) {
+        retval += " id = ";
+        retval += m_id->Dump(ntabs);
+    }
     retval += "\n";
     return retval;
 }
@@ -7616,27 +9299,25 @@ bool OwnerHasShipDesignAvailable::Match(const ScriptingContext& local_context) c
         return false;
     }
 
-    int empire_id = (m_empire_id ? m_empire_id->Eval(local_context) : candidate->Owner());
+    int empire_id = (m_empire_id ?
+        (m_constant_empire_id ? *m_constant_empire_id : m_empire_id->Eval(local_context)) :
+        candidate->Owner());
     if (empire_id == ALL_EMPIRES)
         return false;
-    int design_id = m_id ? m_id->Eval(local_context) : INVALID_DESIGN_ID;
+    int design_id = m_id ? (m_constant_id ? *m_constant_id : m_id->Eval(local_context)) : INVALID_DESIGN_ID;
 
     return OwnerHasShipDesignAvailableSimpleMatch(empire_id, design_id, local_context)(candidate);
 }
 
 void OwnerHasShipDesignAvailable::SetTopLevelContent(const std::string& content_name) {
-    if (m_empire_id)
-        m_empire_id->SetTopLevelContent(content_name);
-    if (m_id)
-        m_id->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_empire_id, m_id);
 }
 
 unsigned int OwnerHasShipDesignAvailable::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::OwnerHasShipDesignAvailable");
-    CheckSums::CheckSumCombine(retval, m_empire_id);
-    CheckSums::CheckSumCombine(retval, m_id);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::OwnerHasShipDesignAvailable");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_empire_id, m_id);
 
     TraceLogger(conditions) << "GetCheckSum(OwnerHasShipDesignAvailable): retval: " << retval;
     return retval;
@@ -7657,9 +9338,14 @@ OwnerHasShipPartAvailable::OwnerHasShipPartAvailable(
     m_empire_id(std::move(empire_id))
 {
     std::array<const ValueRef::ValueRefBase*, 2> operands = {{m_empire_id.get(), m_name.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    if (m_name && m_name->ConstantExpr())
+        m_constant_name = m_name->Eval();
+    if (m_empire_id && m_empire_id->ConstantExpr())
+        m_constant_empire_id = m_empire_id->Eval();
 }
 
 OwnerHasShipPartAvailable::OwnerHasShipPartAvailable(const std::string& name) :
@@ -7703,16 +9389,23 @@ namespace {
                 actual_empire_id = candidate->Owner();
             }
 
-            auto empire = m_context.GetEmpire(actual_empire_id);
-            if (!empire)
-                return false;
+            // the answer is fixed per empire for the whole evaluation, so
+            // resolve each owner at most once
+            auto it = m_results_by_empire.find(actual_empire_id);
+            if (it != m_results_by_empire.end())
+                return it->second;
 
-            return empire->ShipPartAvailable(m_name);
+            bool result = false;
+            if (auto empire = m_context.GetEmpire(actual_empire_id))
+                result = empire->ShipPartAvailable(m_name);
+            m_results_by_empire.emplace(actual_empire_id, result);
+            return result;
         }
 
         int                     m_empire_id = ALL_EMPIRES;
         const std::string&      m_name;
         const ScriptingContext& m_context;
+        mutable boost::container::flat_map<int, bool> m_results_by_empire;
     };
 }
 
@@ -7726,9 +9419,20 @@ void OwnerHasShipPartAvailable::Eval(const ScriptingContext& parent_context,
                              (parent_context.condition_root_candidate || RootCandidateInvariant()));
     if (simple_eval_safe) {
         // evaluate number limits once, use to match all candidates
-        int empire_id = m_empire_id->Eval(parent_context);   // check above should ensure m_empire_id is non-null
-        std::string name = m_name ? m_name->Eval(parent_context) : "";
-        EvalImpl(matches, non_matches, search_domain, OwnerHasShipPartAvailableSimpleMatch(empire_id, name, parent_context));
+        int empire_id = m_constant_empire_id ? *m_constant_empire_id :
+            m_empire_id->Eval(parent_context);   // check above should ensure m_empire_id is non-null
+        std::string name = (m_name && !m_constant_name) ? m_name->Eval(parent_context) : "";
+        const std::string& name_ref = m_constant_name ? *m_constant_name : name;
+        if (empire_id != ALL_EMPIRES) {
+            // a fixed empire id means the answer is the same for every
+            // candidate: resolve it once and broadcast the boolean
+            const auto empire = parent_context.GetEmpire(empire_id);
+            const bool res = empire && empire->ShipPartAvailable(name_ref);
+            EvalImpl(matches, non_matches, search_domain,
+                     [res](const UniverseObject* candidate) { return candidate && res; });
+        } else {
+            EvalImpl(matches, non_matches, search_domain, OwnerHasShipPartAvailableSimpleMatch(empire_id, name_ref, parent_context));
+        }
     } else {
         // re-evaluate allowed turn range for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -7742,11 +9446,18 @@ std::string OwnerHasShipPartAvailable::Description(bool negated) const {
 }
 
 std::string OwnerHasShipPartAvailable::Dump(unsigned short ntabs) const {
-    std::string retval = DumpIndent(ntabs) + "OwnerHasShipPartAvailable";
-    if (m_empire_id)
-        retval += " empire = " + m_empire_id->Dump(ntabs);
-    if (m_name)
-        retval += " name = " + m_name->Dump(ntabs);
+    std::string retval;
+    retval.reserve(ntabs * 4 + 60);     // rough guess at operand dump length
+    retval += DumpIndent(ntabs);
+    retval += "OwnerHasShipPartAvailable";
+    if (m_empire_id) {
+        retval += " empire = ";
+        retval += m_empire_id->Dump(ntabs);
+    }
+    if (m_name) {
+        retval += " name = ";
+        retval += m_name->Dump(ntabs);
+    }
     retval += "\n";
     return retval;
 }
@@ -7758,12 +9469,15 @@ bool OwnerHasShipPartAvailable::Match(const ScriptingContext& local_context) con
         return false;
     }
 
-    int empire_id = (m_empire_id ? m_empire_id->Eval(local_context) : candidate->Owner());
+    int empire_id = (m_empire_id ?
+        (m_constant_empire_id ? *m_constant_empire_id : m_empire_id->Eval(local_context)) :
+        candidate->Owner());
     if (empire_id == ALL_EMPIRES)
         return false;
-    std::string name = m_name ? m_name->Eval(local_context) : "";
+    std::string name = (m_name && !m_constant_name) ? m_name->Eval(local_context) : "";
+    const std::string& name_ref = m_constant_name ? *m_constant_name : name;
 
-    return OwnerHasShipPartAvailableSimpleMatch(empire_id, name, local_context)(candidate);
+    return OwnerHasShipPartAvailableSimpleMatch(empire_id, name_ref, local_context)(candidate);
 }
 
 void OwnerHasShipPartAvailable::SetTopLevelContent(const std::string& content_name) {
@@ -7771,14 +9485,16 @@ void OwnerHasShipPartAvailable::SetTopLevelContent(const std::string& content_na
         m_empire_id->SetTopLevelContent(content_name);
     if (m_name)
         m_name->SetTopLevelContent(content_name);
+    // "CurrentContent" substitution can change a constant string's value
+    if (m_name && m_name->ConstantExpr())
+        m_constant_name = m_name->Eval();
 }
 
 unsigned int OwnerHasShipPartAvailable::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::OwnerHasShipPartAvailable");
-    CheckSums::CheckSumCombine(retval, m_empire_id);
-    CheckSums::CheckSumCombine(retval, m_name);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::OwnerHasShipPartAvailable");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_empire_id, m_name);
 
     TraceLogger(conditions) << "GetCheckSum(OwnerHasShipPartAvailable): retval: " << retval;
     return retval;
@@ -7804,9 +9520,16 @@ VisibleToEmpire::VisibleToEmpire(std::unique_ptr<ValueRef::ValueRef<int>>&& empi
     m_vis(std::move(vis))
 {
     std::array<const ValueRef::ValueRefBase*, 3> operands = {{m_empire_id.get(), m_since_turn.get(), m_vis.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    if (m_empire_id && m_empire_id->ConstantExpr())
+        m_constant_empire_id = m_empire_id->Eval();
+    if (m_since_turn && m_since_turn->ConstantExpr())
+        m_constant_since_turn = m_since_turn->Eval();
+    if (m_vis && m_vis->ConstantExpr())
+        m_constant_vis = m_vis->Eval();
 }
 
 bool VisibleToEmpire::operator==(const Condition& rhs) const {
@@ -7825,6 +9548,66 @@ bool VisibleToEmpire::operator==(const Condition& rhs) const {
 }
 
 namespace {
+    // per-candidate kernels for the two real visibility checks; the checks
+    // that are invariant across a whole sweep are resolved once in Eval,
+    // which dispatches to whichever kernel applies
+    struct CurrentVisMatch {
+        // resolves the empire-level step of the context visibility lookup
+        // once, so each candidate pays a single map walk
+        CurrentVisMatch(int empire_id, Visibility vis, const ScriptingContext& context) :
+            m_vis(vis)
+        {
+            auto empire_it = context.empire_object_vis.find(empire_id);
+            if (empire_it != context.empire_object_vis.end())
+                m_object_vis = &empire_it->second;
+        }
+
+        bool operator()(const UniverseObject* candidate) const {
+            if (!candidate || !m_object_vis)
+                return false;
+            // no valid game turn was specified, so use current universe state
+            auto object_it = m_object_vis->find(candidate->ID());
+            return object_it != m_object_vis->end() && object_it->second >= m_vis;
+        }
+
+        Visibility m_vis = Visibility::VIS_BASIC_VISIBILITY;
+        const Universe::ObjectVisibilityMap* m_object_vis = nullptr;
+    };
+
+    struct HistoricalVisMatch {
+        // resolves the empire-level step of the empire -> object -> vis
+        // lookup chain once, so each candidate pays two map walks, not three
+        HistoricalVisMatch(int empire_id, int since_turn, Visibility vis,
+                           const ScriptingContext& context) :
+            m_since_turn(since_turn),
+            m_vis(vis)
+        {
+            const auto& vis_turn_map{context.empire_object_vis_turns};
+            auto empire_it = vis_turn_map.find(empire_id);
+            if (empire_it != vis_turn_map.end())
+                m_object_vis_turns = &empire_it->second;
+        }
+
+        bool operator()(const UniverseObject* candidate) const {
+            if (!candidate || !m_object_vis_turns)
+                return false;
+            // a game turn after which to check is specified, so check the
+            // history of when the empire saw which objects at which visibility
+            auto object_it = m_object_vis_turns->find(candidate->ID());
+            if (object_it == m_object_vis_turns->end())
+                return false;
+            const auto& vis_turns = object_it->second;
+            auto vis_it = vis_turns.find(m_vis);
+            if (vis_it == vis_turns.end())
+                return false;
+            return vis_it->second >= m_since_turn;
+        }
+
+        int        m_since_turn = BEFORE_FIRST_TURN;
+        Visibility m_vis = Visibility::VIS_BASIC_VISIBILITY;
+        const Universe::ObjectVisibilityTurnMap* m_object_vis_turns = nullptr;
+    };
+
     struct VisibleToEmpireSimpleMatch {
         VisibleToEmpireSimpleMatch(int empire_id, int since_turn, Visibility vis,
                                    const ScriptingContext& context) :
@@ -7842,27 +9625,9 @@ namespace {
             if (m_empire_id == ALL_EMPIRES && m_context.combat_bout < 1)
                 return true; // outside of battle neutral forces have full visibility per default
 
-            if (m_since_turn == INVALID_GAME_TURN) {
-                // no valid game turn was specified, so use current universe state
-                return m_context.ContextVis(candidate->ID(), m_empire_id) >= m_vis;
-
-            } else {
-                // if a game turn after which to check is specified, check the
-                // history of when empires saw which objects at which visibility
-                const auto& vis_turn_map{m_context.empire_object_vis_turns};
-                auto empire_it = vis_turn_map.find(m_empire_id);
-                if (empire_it == vis_turn_map.end())
-                    return false;
-                const auto& object_vis_turns_map = empire_it->second;
-                auto object_it = object_vis_turns_map.find(candidate->ID());
-                if (object_it == object_vis_turns_map.end())
-                    return false;
-                const auto& vis_turns = object_it->second;
-                auto vis_it = vis_turns.find(m_vis);
-                if (vis_it == vis_turns.end())
-                    return false;
-                return vis_it->second >= m_since_turn;
-            }
+            if (m_since_turn == INVALID_GAME_TURN)
+                return CurrentVisMatch{m_empire_id, m_vis, m_context}(candidate);
+            return HistoricalVisMatch{m_empire_id, m_since_turn, m_vis, m_context}(candidate);
         }
 
         int                     m_empire_id = ALL_EMPIRES;
@@ -7884,13 +9649,31 @@ void VisibleToEmpire::Eval(const ScriptingContext& parent_context,
 
     if (simple_eval_safe) {
         // evaluate empire id once, and use to check all candidate objects
-        int empire_id = m_empire_id ? m_empire_id->Eval(parent_context) : ALL_EMPIRES;
-        int since_turn = m_since_turn ? m_since_turn->Eval(parent_context) : INVALID_GAME_TURN;  // indicates current turn
-        Visibility vis = m_vis ? m_vis->Eval(parent_context) : Visibility::VIS_BASIC_VISIBILITY;
-
-        // need to check visibility of each candidate object separately
-        EvalImpl(matches, non_matches, search_domain,
-                 VisibleToEmpireSimpleMatch(empire_id, since_turn, vis, parent_context));
+        int empire_id = m_empire_id ?
+            (m_constant_empire_id ? *m_constant_empire_id : m_empire_id->Eval(parent_context)) : ALL_EMPIRES;
+        int since_turn = m_since_turn ?
+            (m_constant_since_turn ? *m_constant_since_turn : m_since_turn->Eval(parent_context)) : INVALID_GAME_TURN;  // indicates current turn
+        Visibility vis = m_vis ?
+            (m_constant_vis ? *m_constant_vis : m_vis->Eval(parent_context)) : Visibility::VIS_BASIC_VISIBILITY;
+        if (vis == Visibility::INVALID_VISIBILITY)
+            vis = Visibility::VIS_BASIC_VISIBILITY;
+
+        // the sweep-invariant checks are resolved here, once, so the
+        // per-candidate loop runs only the visibility test that applies
+        if (vis == Visibility::VIS_NO_VISIBILITY ||
+            (empire_id == ALL_EMPIRES && parent_context.combat_bout < 1))
+        {
+            // every candidate matches: outside of battle neutral forces have
+            // full visibility per default
+            EvalImpl(matches, non_matches, search_domain,
+                     [](const UniverseObject* candidate) { return candidate != nullptr; });
+        } else if (since_turn == INVALID_GAME_TURN) {
+            EvalImpl(matches, non_matches, search_domain,
+                     CurrentVisMatch{empire_id, vis, parent_context});
+        } else {
+            EvalImpl(matches, non_matches, search_domain,
+                     HistoricalVisMatch{empire_id, since_turn, vis, parent_context});
+        }
     } else {
         // re-evaluate empire id for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -7952,13 +9735,22 @@ std::string VisibleToEmpire::Description(bool negated) const {
 }
 
 std::string VisibleToEmpire::Dump(unsigned short ntabs) const {
-    std::string retval = DumpIndent(ntabs) + "VisibleToEmpire";
-    if (m_empire_id)
-        retval += " empire = " + m_empire_id->Dump(ntabs);
-    if (m_since_turn)
-        retval += " turn = " + m_since_turn->Dump(ntabs);
-    if (m_vis)
-        retval += " visibility = " + m_vis->Dump(ntabs);
+    std::string retval;
+    retval.reserve(ntabs * 4 + 80);     // rough guess at operand dump length
+    retval += DumpIndent(ntabs);
+    retval += "VisibleToEmpire";
+    if (m_empire_id) {
+        retval += " empire = ";
+        retval += m_empire_id->Dump(ntabs);
+    }
+    if (m_since_turn) {
+        retval += " turn = ";
+        retval += m_since_turn->Dump(ntabs);
+    }
+    if (m_vis) {
+        retval += " visibility = ";
+        retval += m_vis->Dump(ntabs);
+    }
     retval += "\n";
     return retval;
 }
@@ -7970,28 +9762,24 @@ bool VisibleToEmpire::Match(const ScriptingContext& local_context) const {
         return false;
     }
 
-    int empire_id = m_empire_id ? m_empire_id->Eval(local_context) : ALL_EMPIRES;
-    int since_turn = m_since_turn ? m_since_turn->Eval(local_context) : INVALID_GAME_TURN;  // indicates current turn
-    Visibility vis = m_vis ? m_vis->Eval(local_context) : Visibility::VIS_BASIC_VISIBILITY;
+    int empire_id = m_empire_id ?
+        (m_constant_empire_id ? *m_constant_empire_id : m_empire_id->Eval(local_context)) : ALL_EMPIRES;
+    int since_turn = m_since_turn ?
+        (m_constant_since_turn ? *m_constant_since_turn : m_since_turn->Eval(local_context)) : INVALID_GAME_TURN;  // indicates current turn
+    Visibility vis = m_vis ?
+        (m_constant_vis ? *m_constant_vis : m_vis->Eval(local_context)) : Visibility::VIS_BASIC_VISIBILITY;
     return VisibleToEmpireSimpleMatch(empire_id, since_turn, vis, local_context)(candidate);
 }
 
 void VisibleToEmpire::SetTopLevelContent(const std::string& content_name) {
-    if (m_empire_id)
-        m_empire_id->SetTopLevelContent(content_name);
-    if (m_since_turn)
-        m_since_turn->SetTopLevelContent(content_name);
-    if (m_vis)
-        m_vis->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_empire_id, m_since_turn, m_vis);
 }
 
 unsigned int VisibleToEmpire::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::VisibleToEmpire");
-    CheckSums::CheckSumCombine(retval, m_empire_id);
-    CheckSums::CheckSumCombine(retval, m_since_turn);
-    CheckSums::CheckSumCombine(retval, m_vis);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::VisibleToEmpire");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_empire_id, m_since_turn, m_vis);
 
     TraceLogger(conditions) << "GetCheckSum(VisibleToEmpire): retval: " << retval;
     return retval;
@@ -8037,29 +9825,97 @@ bool WithinDistance::operator==(const Condition& rhs) const {
 }
 
 namespace {
-    struct WithinDistanceSimpleMatch {
-        WithinDistanceSimpleMatch(const ObjectSet& from_objects, double distance) :
-            m_from_objects(from_objects),
-            m_distance2(distance*distance)
-        {}
-
-        bool operator()(const UniverseObject* candidate) const {
-            if (!candidate)
-                return false;
+    // returns whether any of the \a n points is within squared distance
+    // \a dist2 of (\a cx, \a cy)
+    bool AnyWithin2Scalar(const double* xs, const double* ys, std::size_t n,
+                          double cx, double cy, double dist2)
+    {
+        for (std::size_t i = 0; i < n; ++i) {
+            const double dx = xs[i] - cx;
+            const double dy = ys[i] - cy;
+            if (dx*dx + dy*dy <= dist2)
+                return true;
+        }
+        return false;
+    }
 
-            // is candidate object close enough to any of the passed-in objects?
-            for (auto* obj : m_from_objects) { // TODO: if_any
-                double delta_x = candidate->X() - obj->X();
-                double delta_y = candidate->Y() - obj->Y();
-                if (delta_x*delta_x + delta_y*delta_y <= m_distance2)
-                    return true;
-            }
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    // AVX2 variant, compiled regardless of the baseline target and chosen
+    // at startup behind the CPU-feature check, as with the flag kernels.
+    // mul+add rather than fmadd so each lane rounds exactly as the scalar
+    // variant does, keeping match results identical across machines
+    __attribute__((target("avx2")))
+    bool AnyWithin2AVX2(const double* xs, const double* ys, std::size_t n,
+                        double cx, double cy, double dist2)
+    {
+        const __m256d cx4 = _mm256_set1_pd(cx);
+        const __m256d cy4 = _mm256_set1_pd(cy);
+        const __m256d dist2_4 = _mm256_set1_pd(dist2);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            const __m256d dx = _mm256_sub_pd(_mm256_loadu_pd(xs + i), cx4);
+            const __m256d dy = _mm256_sub_pd(_mm256_loadu_pd(ys + i), cy4);
+            const __m256d d2 = _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+            if (_mm256_movemask_pd(_mm256_cmp_pd(d2, dist2_4, _CMP_LE_OQ)))
+                return true;
+        }
+        return AnyWithin2Scalar(xs + i, ys + i, n - i, cx, cy, dist2);
+    }
 
-            return false;
+    bool (*const AnyWithin2)(const double*, const double*, std::size_t, double, double, double) =
+        __builtin_cpu_supports("avx2") ? &AnyWithin2AVX2 : &AnyWithin2Scalar;
+#else
+    inline bool AnyWithin2(const double* xs, const double* ys, std::size_t n,
+                           double cx, double cy, double dist2)
+    { return AnyWithin2Scalar(xs, ys, n, cx, cy, dist2); }
+#endif
+
+    struct WithinDistanceSimpleMatch {
+        WithinDistanceSimpleMatch(const ObjectSet& from_objects, double distance) :
+            m_distance2(distance*distance),
+            m_band(std::abs(distance))
+        {
+            // gather the coordinates into columns once, sorted by x, so the
+            // per-candidate scan is a contiguous numeric kernel over just the
+            // x band that could be near, instead of a pointer chase over the
+            // whole set
+            std::vector<std::pair<double, double>> points;
+            points.reserve(from_objects.size());
+            for (auto* obj : from_objects) {
+                if (!obj)
+                    continue;
+                points.emplace_back(obj->X(), obj->Y());
+            }
+            std::sort(points.begin(), points.end());
+            m_xs.reserve(points.size());
+            m_ys.reserve(points.size());
+            for (const auto& [x, y] : points) {
+                m_xs.push_back(x);
+                m_ys.push_back(y);
+            }
         }
 
-        const ObjectSet& m_from_objects;
+        bool operator()(const UniverseObject* candidate) const {
+            if (!candidate)
+                return false;
+
+            // is candidate object close enough to any of the passed-in
+            // objects? only points whose x lies within the distance band
+            // around the candidate can qualify, so binary-search that band
+            const double cx = candidate->X();
+            const double cy = candidate->Y();
+            const auto first = std::lower_bound(m_xs.begin(), m_xs.end(), cx - m_band);
+            const auto last = std::upper_bound(first, m_xs.end(), cx + m_band);
+            const auto offset = static_cast<std::size_t>(first - m_xs.begin());
+            return AnyWithin2(m_xs.data() + offset, m_ys.data() + offset,
+                              static_cast<std::size_t>(last - first),
+                              cx, cy, m_distance2);
+        }
+
+        std::vector<double> m_xs;
+        std::vector<double> m_ys;
         double m_distance2;
+        double m_band;      // |distance|: half-width of the candidate-centered x interval worth testing
     };
 }
 
@@ -8098,7 +9954,12 @@ std::string WithinDistance::Description(bool negated) const {
 }
 
 std::string WithinDistance::Dump(unsigned short ntabs) const {
-    std::string retval = DumpIndent(ntabs) + "WithinDistance distance = " + m_distance->Dump(ntabs) + " condition =\n";
+    std::string retval;
+    retval.reserve(ntabs * 4 + 60);     // rough guess at operand dump length
+    retval += DumpIndent(ntabs);
+    retval += "WithinDistance distance = ";
+    retval += m_distance->Dump(ntabs);
+    retval += " condition =\n";
     retval += m_condition->Dump(ntabs+1);
     return retval;
 }
@@ -8110,27 +9971,27 @@ bool WithinDistance::Match(const ScriptingContext& local_context) const {
         return false;
     }
 
-    // get subcondition matches
-    ObjectSet subcondition_matches = m_condition->Eval(local_context);
-    if (subcondition_matches.empty())
-        return false;
+    // get subcondition matches, into a reused buffer as in Contains::Match
+    static thread_local ObjectSet subcondition_matches_buf;
+    ObjectSet subcondition_matches{std::move(subcondition_matches_buf)};
+    m_condition->Eval(local_context, subcondition_matches);
 
-    return WithinDistanceSimpleMatch(subcondition_matches, m_distance->Eval(local_context))(candidate);
+    bool retval = !subcondition_matches.empty() &&
+        WithinDistanceSimpleMatch(subcondition_matches, m_distance->Eval(local_context))(candidate);
+
+    subcondition_matches_buf = std::move(subcondition_matches);     // keep the capacity for the next call
+    return retval;
 }
 
 void WithinDistance::SetTopLevelContent(const std::string& content_name) {
-    if (m_distance)
-        m_distance->SetTopLevelContent(content_name);
-    if (m_condition)
-        m_condition->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_distance, m_condition);
 }
 
 unsigned int WithinDistance::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::WithinDistance");
-    CheckSums::CheckSumCombine(retval, m_distance);
-    CheckSums::CheckSumCombine(retval, m_condition);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::WithinDistance");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_distance, m_condition);
 
     TraceLogger(conditions) << "GetCheckSum(WithinDistance): retval: " << retval;
     return retval;
@@ -8141,6 +10002,156 @@ std::unique_ptr<Condition> WithinDistance::Clone() const {
                                             ValueRef::CloneUnique(m_condition));
 }
 
+std::unique_ptr<Condition> WithinDistance::TryFuse(const Condition& next) const {
+    // an immediately following VisibleToEmpire sibling in an And can share
+    // this condition's pass over the candidates
+    const auto* vis_cond = dynamic_cast<const VisibleToEmpire*>(&next);
+    if (!vis_cond)
+        return nullptr;
+    return std::make_unique<WithinDistanceAndVisibleToEmpire>(*this, *vis_cond);
+}
+
+///////////////////////////////////////////////////////////
+// WithinDistanceAndVisibleToEmpire                      //
+///////////////////////////////////////////////////////////
+WithinDistanceAndVisibleToEmpire::WithinDistanceAndVisibleToEmpire(
+    const WithinDistance& within_distance, const VisibleToEmpire& visible_to_empire) :
+    m_within_distance(std::make_unique<WithinDistance>(
+        ValueRef::CloneUnique(within_distance.m_distance),
+        ValueRef::CloneUnique(within_distance.m_condition))),
+    m_visible_to_empire(std::make_unique<VisibleToEmpire>(
+        ValueRef::CloneUnique(visible_to_empire.m_empire_id),
+        ValueRef::CloneUnique(visible_to_empire.m_since_turn),
+        ValueRef::CloneUnique(visible_to_empire.m_vis)))
+{
+    m_root_candidate_invariant = m_within_distance->RootCandidateInvariant() &&
+                                 m_visible_to_empire->RootCandidateInvariant();
+    m_target_invariant = m_within_distance->TargetInvariant() &&
+                         m_visible_to_empire->TargetInvariant();
+    m_source_invariant = m_within_distance->SourceInvariant() &&
+                         m_visible_to_empire->SourceInvariant();
+}
+
+bool WithinDistanceAndVisibleToEmpire::operator==(const Condition& rhs) const {
+    if (this == &rhs)
+        return true;
+    if (typeid(*this) != typeid(rhs))
+        return false;
+
+    const WithinDistanceAndVisibleToEmpire& rhs_ = static_cast<const WithinDistanceAndVisibleToEmpire&>(rhs);
+
+    CHECK_COND_VREF_MEMBER(m_within_distance)
+    CHECK_COND_VREF_MEMBER(m_visible_to_empire)
+
+    return true;
+}
+
+void WithinDistanceAndVisibleToEmpire::Eval(const ScriptingContext& parent_context,
+                                            ObjectSet& matches, ObjectSet& non_matches,
+                                            SearchDomain search_domain) const
+{
+    const WithinDistance& wd{*m_within_distance};
+    const VisibleToEmpire& vte{*m_visible_to_empire};
+
+    bool simple_eval_safe = wd.m_distance->LocalCandidateInvariant() &&
+                            (!vte.m_empire_id || vte.m_empire_id->LocalCandidateInvariant()) &&
+                            (!vte.m_since_turn || vte.m_since_turn->LocalCandidateInvariant()) &&
+                            (!vte.m_vis || vte.m_vis->LocalCandidateInvariant()) &&
+                            (parent_context.condition_root_candidate || RootCandidateInvariant());
+    if (!simple_eval_safe) {
+        // evaluate the two wrapped conditions in sequence, exactly as the
+        // unfused operand pair would have been evaluated by And::Eval
+        if (search_domain == SearchDomain::NON_MATCHES) {
+            ObjectSet partly_checked;
+            partly_checked.reserve(non_matches.size());
+            m_within_distance->Eval(parent_context, partly_checked, non_matches, SearchDomain::NON_MATCHES);
+            m_visible_to_empire->Eval(parent_context, partly_checked, non_matches, SearchDomain::MATCHES);
+            matches.insert(matches.end(), partly_checked.begin(), partly_checked.end());
+        } else {
+            m_within_distance->Eval(parent_context, matches, non_matches, SearchDomain::MATCHES);
+            m_visible_to_empire->Eval(parent_context, matches, non_matches, SearchDomain::MATCHES);
+        }
+        return;
+    }
+
+    // evaluate the operands of both conditions once, as each condition's own
+    // simple-eval branch does
+    ObjectSet subcondition_matches = wd.m_condition->Eval(parent_context);
+    double distance = wd.m_distance->Eval(parent_context);
+
+    int empire_id = vte.m_empire_id ?
+        (vte.m_constant_empire_id ? *vte.m_constant_empire_id : vte.m_empire_id->Eval(parent_context)) : ALL_EMPIRES;
+    int since_turn = vte.m_since_turn ?
+        (vte.m_constant_since_turn ? *vte.m_constant_since_turn : vte.m_since_turn->Eval(parent_context)) : INVALID_GAME_TURN;  // indicates current turn
+    Visibility vis = vte.m_vis ?
+        (vte.m_constant_vis ? *vte.m_constant_vis : vte.m_vis->Eval(parent_context)) : Visibility::VIS_BASIC_VISIBILITY;
+    if (vis == Visibility::INVALID_VISIBILITY)
+        vis = Visibility::VIS_BASIC_VISIBILITY;
+
+    WithinDistanceSimpleMatch within_match(subcondition_matches, distance);
+
+    // one pass over the candidates, applying both per-candidate kernels, so
+    // the intermediate partition between the two conditions is never written.
+    // the visibility probe runs first: a map walk is cheaper than the banded
+    // coordinate scan it can rule out
+    if (vis == Visibility::VIS_NO_VISIBILITY ||
+        (empire_id == ALL_EMPIRES && parent_context.combat_bout < 1))
+    {
+        // every candidate passes the visibility part: outside of battle
+        // neutral forces have full visibility per default
+        EvalImpl(matches, non_matches, search_domain, within_match);
+    } else if (since_turn == INVALID_GAME_TURN) {
+        CurrentVisMatch vis_match{empire_id, vis, parent_context};
+        EvalImpl(matches, non_matches, search_domain,
+                 [&](const UniverseObject* candidate)
+                 { return vis_match(candidate) && within_match(candidate); });
+    } else {
+        HistoricalVisMatch vis_match{empire_id, since_turn, vis, parent_context};
+        EvalImpl(matches, non_matches, search_domain,
+                 [&](const UniverseObject* candidate)
+                 { return vis_match(candidate) && within_match(candidate); });
+    }
+}
+
+std::string WithinDistanceAndVisibleToEmpire::Description(bool negated) const {
+    // describe as the operand pair the condition was fused from
+    return m_within_distance->Description(negated) +
+           ((!negated)
+                ? UserString("DESC_AND_BETWEEN_OPERANDS")
+                : UserString("DESC_NOT_AND_BETWEEN_OPERANDS")) +
+           m_visible_to_empire->Description(negated);
+}
+
+std::string WithinDistanceAndVisibleToEmpire::Dump(unsigned short ntabs) const {
+    // dump as the unfused operand pair, so dumped text re-parses (and
+    // re-fuses) cleanly
+    std::string retval = m_within_distance->Dump(ntabs);
+    retval += m_visible_to_empire->Dump(ntabs);
+    return retval;
+}
+
+bool WithinDistanceAndVisibleToEmpire::Match(const ScriptingContext& local_context) const {
+    return m_within_distance->Match(local_context) &&
+           m_visible_to_empire->Match(local_context);
+}
+
+void WithinDistanceAndVisibleToEmpire::SetTopLevelContent(const std::string& content_name) {
+    SetTopLevelContentAll(content_name, m_within_distance, m_visible_to_empire);
+}
+
+unsigned int WithinDistanceAndVisibleToEmpire::GetCheckSum() const {
+    unsigned int retval{0};
+
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::WithinDistanceAndVisibleToEmpire");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_within_distance, m_visible_to_empire);
+
+    TraceLogger(conditions) << "GetCheckSum(WithinDistanceAndVisibleToEmpire): retval: " << retval;
+    return retval;
+}
+
+std::unique_ptr<Condition> WithinDistanceAndVisibleToEmpire::Clone() const
+{ return std::make_unique<WithinDistanceAndVisibleToEmpire>(*m_within_distance, *m_visible_to_empire); }
+
 ///////////////////////////////////////////////////////////
 // WithinStarlaneJumps                                   //
 ///////////////////////////////////////////////////////////
@@ -8207,7 +10218,12 @@ std::string WithinStarlaneJumps::Description(bool negated) const {
 }
 
 std::string WithinStarlaneJumps::Dump(unsigned short ntabs) const {
-    std::string retval = DumpIndent(ntabs) + "WithinStarlaneJumps jumps = " + m_jumps->Dump(ntabs) + " condition =\n";
+    std::string retval;
+    retval.reserve(ntabs * 4 + 60);     // rough guess at operand dump length
+    retval += DumpIndent(ntabs);
+    retval += "WithinStarlaneJumps jumps = ";
+    retval += m_jumps->Dump(ntabs);
+    retval += " condition =\n";
     retval += m_condition->Dump(ntabs+1);
     return retval;
 }
@@ -8219,39 +10235,33 @@ bool WithinStarlaneJumps::Match(const ScriptingContext& local_context) const {
         return false;
     }
 
-    // get subcondition matches
-    ObjectSet subcondition_matches = m_condition->Eval(local_context);
-    if (subcondition_matches.empty())
-        return false;
+    // get subcondition matches, into a reused buffer as in Contains::Match
+    static thread_local ObjectSet subcondition_matches_buf;
+    ObjectSet subcondition_matches{std::move(subcondition_matches_buf)};
+    m_condition->Eval(local_context, subcondition_matches);
 
-    int jump_limit = m_jumps->Eval(local_context);
-    if (jump_limit < 0)
-        return false;
-
-    ObjectSet candidate_set{candidate};
-
-    // candidate objects within jumps of subcondition_matches objects
-    ObjectSet near_objs;
+    bool retval = false;
+    if (!subcondition_matches.empty()) {
+        int jump_limit = m_jumps->Eval(local_context);
+        // is the candidate within jumps of any subcondition_matches object?
+        if (jump_limit >= 0)
+            retval = local_context.ContextUniverse().GetPathfinder()->WithinJumpsOfOthers(
+                jump_limit, local_context.ContextObjects(), candidate, subcondition_matches);
+    }
 
-    std::tie(near_objs, std::ignore) =
-        local_context.ContextUniverse().GetPathfinder()->WithinJumpsOfOthers(
-            jump_limit, local_context.ContextObjects(), candidate_set, subcondition_matches);
-    return !near_objs.empty();
+    subcondition_matches_buf = std::move(subcondition_matches);     // keep the capacity for the next call
+    return retval;
 }
 
 void WithinStarlaneJumps::SetTopLevelContent(const std::string& content_name) {
-    if (m_jumps)
-        m_jumps->SetTopLevelContent(content_name);
-    if (m_condition)
-        m_condition->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_jumps, m_condition);
 }
 
 unsigned int WithinStarlaneJumps::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::WithinStarlaneJumps");
-    CheckSums::CheckSumCombine(retval, m_jumps);
-    CheckSums::CheckSumCombine(retval, m_condition);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::WithinStarlaneJumps");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_jumps, m_condition);
 
     TraceLogger(conditions) << "GetCheckSum(WithinStarlaneJumps): retval: " << retval;
     return retval;
@@ -8287,372 +10297,705 @@ bool CanAddStarlaneConnection::operator==(const Condition& rhs) const {
 }
 
 namespace {
-    // check if two destination systems, connected to the same origin system
-    // would have starlanes too close angularly to eachother
-    bool LanesAngularlyTooClose(const UniverseObject* sys1,
-                                const UniverseObject* lane1_sys2,
-                                const UniverseObject* lane2_sys2)
-    {
-        if (!sys1 || !lane1_sys2 || !lane2_sys2)
-            return true;
-        if (sys1 == lane1_sys2 || sys1 == lane2_sys2 || lane1_sys2 == lane2_sys2)
-            return true;
-
-        float dx1 = lane1_sys2->X() - sys1->X();
-        float dy1 = lane1_sys2->Y() - sys1->Y();
-        float mag = std::sqrt(dx1*dx1 + dy1*dy1);
-        if (mag == 0.0f)
-            return true;
-        dx1 /= mag;
-        dy1 /= mag;
-
-        float dx2 = lane2_sys2->X() - sys1->X();
-        float dy2 = lane2_sys2->Y() - sys1->Y();
-        mag = std::sqrt(dx2*dx2 + dy2*dy2);
-        if (mag == 0.0f)
-            return true;
-        dx2 /= mag;
-        dy2 /= mag;
-
-
-        static constexpr float MAX_LANE_DOT_PRODUCT = 0.87f; // magic limit adjusted to allow no more than 12 starlanes from a system
-                                                             // arccos(0.87) = 0.515594 rad = 29.5 degrees
-
-        float dp = (dx1 * dx2) + (dy1 * dy2);
-        //TraceLogger(conditions) << "systems: " << sys1->UniverseObject::Name() << "  " << lane1_sys2->UniverseObject::Name() << "  " << lane2_sys2->UniverseObject::Name() << "  dp: " << dp << "\n";
-
-        return dp >= MAX_LANE_DOT_PRODUCT;   // if dot product too high after normalizing vectors, angles are adequately separated
-    }
-
-    // check the distance between a system and a (possibly nonexistant)
-    // starlane between two other systems. distance here is how far the third
-    // system is from the line passing through the lane endpoint systems, as
-    // long as the third system is closer to either end point than the endpoints
-    // are to eachother. if the third system is further than the endpoints, than
-    // the distance to the line is not considered and the lane is considered
-    // acceptable
-    bool ObjectTooCloseToLane(const UniverseObject* lane_end_sys1,
-                              const UniverseObject* lane_end_sys2,
-                              const UniverseObject* obj)
-    {
-        if (!lane_end_sys1 || !lane_end_sys2 || !obj)
-            return true;
-        if (lane_end_sys1 == lane_end_sys2 || obj == lane_end_sys1 || obj == lane_end_sys2)
-            return true;
-
-        // check distances (squared) between object and lane-end systems
-        float v_12_x = lane_end_sys2->X() - lane_end_sys1->X();
-        float v_12_y = lane_end_sys2->Y() - lane_end_sys1->Y();
-        float v_o1_x = lane_end_sys1->X() - obj->X();
-        float v_o1_y = lane_end_sys1->Y() - obj->Y();
-        float v_o2_x = lane_end_sys2->X() - obj->X();
-        float v_o2_y = lane_end_sys2->Y() - obj->Y();
-
-        float dist2_12 = v_12_x*v_12_x + v_12_y*v_12_y;
-        float dist2_o1 = v_o1_x*v_o1_x + v_o1_y*v_o1_y;
-        float dist2_o2 = v_o2_x*v_o2_x + v_o2_y*v_o2_y;
-
-        // object to zero-length lanes
-        if (dist2_12 == 0.0f || dist2_o1 == 0.0f || dist2_o2 == 0.0f)
-            return true;
-
-        // if object is further from either of the lane end systems than they
-        // are from each other, it is fine, regardless of the right-angle
-        // distance to the line between the systems
-        if (dist2_12 < dist2_o1 || dist2_12 < dist2_o2)
-            return false;
-
-
-        // check right-angle distance between obj and lane
-
-        // normalize vector components of lane vector
-        float mag_12 = std::sqrt(dist2_12);
-        if (mag_12 == 0.0f)
-            return true;
-        v_12_x /= mag_12;
-        v_12_y /= mag_12;
-
-        // distance to point from line from vector projection / cross products
-        //       O
-        //      /|
-        //     / |
-        //    /  |d
-        //   /   |
-        //  /a___|___
-        // 1         2
-        // (1O)x(12) = |1O| |12| sin(a)
-        // d = |1O| sin(a) = (1O)x(12) / |12|
-        // d = (10)x(12 / |12|)
-        static constexpr float MIN_PERP_DIST = 20; // magic limit, in units of universe units (uu)
-
-        float perp_dist = std::abs(v_o1_x*v_12_y - v_o1_y*v_12_x);
-
-        return perp_dist < MIN_PERP_DIST;
-    }
-
     inline float CrossProduct(float dx1, float dy1, float dx2, float dy2)
     { return dx1*dy2 - dy1*dx2; }
 
-    bool LanesCross(const System* lane1_end_sys1,
-                    const System* lane1_end_sys2,
-                    const System* lane2_end_sys1,
-                    const System* lane2_end_sys2)
+    // returns whether \a a and \a b have strictly opposite signs, a zero of
+    // either sign counting as neither sign: the sign bits are compared
+    // directly, saving the multiply of the equivalent a*b < 0 test and its
+    // underflow-to-zero edge case
+    inline bool OppositeSigns(float a, float b) {
+        uint32_t ua, ub;
+        std::memcpy(&ua, &a, sizeof(ua));
+        std::memcpy(&ub, &b, sizeof(ub));
+        return ((ua ^ ub) >> 31) && a != 0.0f && b != 0.0f;
+    }
+
+    constexpr float MAX_LANE_DOT_PRODUCT = 0.87f;   // magic limit adjusted to allow no more than 12 starlanes from a system
+                                                    // arccos(0.87) = 0.515594 rad = 29.5 degrees
+    constexpr float MAX_LANE_DOT_PRODUCT_SQ = MAX_LANE_DOT_PRODUCT * MAX_LANE_DOT_PRODUCT;
+
+    constexpr float MIN_PERP_DIST = 20; // magic limit, in units of universe units (uu)
+    constexpr float MIN_PERP_DIST_SQ = MIN_PERP_DIST * MIN_PERP_DIST;
+
+    // cell size of the uniform grid over system positions, a few times the
+    // proximity limit so a lane's expanded bounding box covers few cells
+    constexpr float GRID_CELL_SIZE = MIN_PERP_DIST * 4.0f;
+
+    // returns whether a lane from (\a sys1_x, \a sys1_y) towards any of the
+    // \a n destinations would be angularly too close to the lane towards
+    // (\a dx1, \a dy1) (relative to sys1, squared length \a mag2_1).
+    // destination column positions are compared against the two endpoint
+    // positions, since position equality means identical systems
+    bool AnyLaneAngularlyTooCloseScalar(float sys1_x, float sys1_y,
+                                        float dx1, float dy1, float mag2_1,
+                                        uint32_t sys1_idx, uint32_t lane1_idx,
+                                        const float* dest_xs, const float* dest_ys,
+                                        const uint32_t* dest_idxs, std::size_t n)
     {
-        // are all endpoints valid systems?
-        if (!lane1_end_sys1 || !lane1_end_sys2 || !lane2_end_sys1 || !lane2_end_sys2)
-            return false;
-
-        // is either lane degenerate (same start and endpoints)
-        if (lane1_end_sys1 == lane1_end_sys2 || lane2_end_sys1 == lane2_end_sys2)
-            return false;
-
-        // do the two lanes share endpoints?
-        bool share_endpoint_1 = lane1_end_sys1 == lane2_end_sys1 || lane1_end_sys1 == lane2_end_sys2;
-        bool share_endpoint_2 = lane1_end_sys2 == lane2_end_sys1 || lane1_end_sys2 == lane2_end_sys2;
-        if (share_endpoint_1 && share_endpoint_2)
-            return true;    // two copies of the same lane?
-        if (share_endpoint_1 || share_endpoint_2)
-            return false;   // one common endpoing, but not both common, so can't cross in middle
-
-        // calculate vector components for lanes
-        // lane 1
-        float v_11_12_x = lane1_end_sys2->X() - lane1_end_sys1->X();
-        float v_11_12_y = lane1_end_sys2->Y() - lane1_end_sys1->Y();
-        // lane 2
-        float v_21_22_x = lane2_end_sys2->X() - lane2_end_sys1->X();
-        float v_21_22_y = lane2_end_sys2->Y() - lane2_end_sys1->Y();
-
-        // calculate vector components from lane 1 system 1 to lane 2 endpoints
-        // lane 1 endpoint 1 to lane 2 endpoint 1
-        float v_11_21_x = lane2_end_sys1->X() - lane1_end_sys1->X();
-        float v_11_21_y = lane2_end_sys1->Y() - lane1_end_sys1->Y();
-        // lane 1 endpoint 1 to lane 2 endpoint 2
-        float v_11_22_x = lane2_end_sys2->X() - lane1_end_sys1->X();
-        float v_11_22_y = lane2_end_sys2->Y() - lane1_end_sys1->Y();
-
-        // find cross products of vectors to check on which sides of lane 1 the
-        // endpoints of lane 2 are located...
-        float cp_1_21 = CrossProduct(v_11_12_x, v_11_12_y, v_11_21_x, v_11_21_y);
-        float cp_1_22 = CrossProduct(v_11_12_x, v_11_12_y, v_11_22_x, v_11_22_y);
-        if (cp_1_21*cp_1_22 >= 0) // product of same sign numbers is positive, of different sign numbers is negative
-            return false;   // if same sign, points are on same side of line, so can't cross it
-
-        // calculate vector components from lane 2 system 1 to lane 1 endpoints
-        // lane 2 endpoint 1 to lane 1 endpoint 1
-        float v_21_11_x = -v_11_21_x;
-        float v_21_11_y = -v_11_21_y;
-        // lane 2 endpoint 1 to lane 1 endpoint 2
-        float v_21_12_x = lane1_end_sys2->X() - lane2_end_sys1->X();
-        float v_21_12_y = lane1_end_sys2->Y() - lane2_end_sys1->Y();
-
-        // find cross products of vectors to check on which sides of lane 2 the
-        // endpoints of lane 1 are located...
-        float cp_2_11 = CrossProduct(v_21_22_x, v_21_22_y, v_21_11_x, v_21_11_y);
-        float cp_2_12 = CrossProduct(v_21_22_x, v_21_22_y, v_21_12_x, v_21_12_y);
-        if (cp_2_11*cp_2_12 >= 0)
-            return false;
-
-        // endpoints of both lines are on opposite sides of the other line, so
-        // the lines must cross
-
-        return true;
+        const float limit = MAX_LANE_DOT_PRODUCT_SQ * mag2_1;
+        for (std::size_t i = 0; i < n; ++i) {
+            if (dest_idxs[i] == sys1_idx || dest_idxs[i] == lane1_idx)
+                return true;
+            const float dx2 = dest_xs[i] - sys1_x;
+            const float dy2 = dest_ys[i] - sys1_y;
+            const float mag2_2 = dx2*dx2 + dy2*dy2;
+            if (mag2_2 == 0.0f)
+                return true;
+            const float dp = dx1*dx2 + dy1*dy2;
+            if (dp > 0.0f && dp*dp >= limit * mag2_2)
+                return true;
+        }
+        return false;
     }
 
-    bool LaneCrossesExistingLane(const System* lane_end_sys1,
-                                 const System* lane_end_sys2,
-                                 const ObjectMap& objects)
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    // AVX2 variant testing eight destinations per iteration, compiled
+    // regardless of the baseline target and chosen at startup behind the
+    // CPU-feature check, as with the flag kernels. mul+add rather than
+    // fmadd, and the squared comparison rather than rsqrt, so each lane
+    // rounds exactly as the scalar variant does, keeping match results
+    // identical across machines
+    __attribute__((target("avx2")))
+    bool AnyLaneAngularlyTooCloseAVX2(float sys1_x, float sys1_y,
+                                      float dx1, float dy1, float mag2_1,
+                                      uint32_t sys1_idx, uint32_t lane1_idx,
+                                      const float* dest_xs, const float* dest_ys,
+                                      const uint32_t* dest_idxs, std::size_t n)
     {
-        if (!lane_end_sys1 || !lane_end_sys2 || lane_end_sys1 == lane_end_sys2)
-            return true;
-
-        // loop over all existing lanes in all systems, checking if a lane
-        // beween the specified systems would cross any of the existing lanes
-        for (auto* system : objects.allRaw<System>()) {
-            if (system == lane_end_sys1 || system == lane_end_sys2)
+        const __m256 sys1_x8 = _mm256_set1_ps(sys1_x);
+        const __m256 sys1_y8 = _mm256_set1_ps(sys1_y);
+        const __m256 dx1_8 = _mm256_set1_ps(dx1);
+        const __m256 dy1_8 = _mm256_set1_ps(dy1);
+        const __m256 limit8 = _mm256_set1_ps(MAX_LANE_DOT_PRODUCT_SQ * mag2_1);
+        const __m256i sys1_idx8 = _mm256_set1_epi32(static_cast<int>(sys1_idx));
+        const __m256i lane1_idx8 = _mm256_set1_epi32(static_cast<int>(lane1_idx));
+        const __m256 zero8 = _mm256_setzero_ps();
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const __m256i idx8 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dest_idxs + i));
+            const __m256i identical = _mm256_or_si256(_mm256_cmpeq_epi32(idx8, sys1_idx8),
+                                                      _mm256_cmpeq_epi32(idx8, lane1_idx8));
+            const __m256 dx2 = _mm256_sub_ps(_mm256_loadu_ps(dest_xs + i), sys1_x8);
+            const __m256 dy2 = _mm256_sub_ps(_mm256_loadu_ps(dest_ys + i), sys1_y8);
+            const __m256 mag2_2 = _mm256_add_ps(_mm256_mul_ps(dx2, dx2), _mm256_mul_ps(dy2, dy2));
+            const __m256 zero_len = _mm256_cmp_ps(mag2_2, zero8, _CMP_EQ_OQ);
+            const __m256 dp = _mm256_add_ps(_mm256_mul_ps(dx1_8, dx2), _mm256_mul_ps(dy1_8, dy2));
+            const __m256 dp_pos = _mm256_cmp_ps(dp, zero8, _CMP_GT_OQ);
+            const __m256 dp_close = _mm256_cmp_ps(_mm256_mul_ps(dp, dp),
+                                                  _mm256_mul_ps(limit8, mag2_2), _CMP_GE_OQ);
+            const __m256 too_close = _mm256_or_ps(_mm256_castsi256_ps(identical),
+                                                  _mm256_or_ps(zero_len,
+                                                               _mm256_and_ps(dp_pos, dp_close)));
+            if (_mm256_movemask_ps(too_close))
+                return true;
+        }
+        return AnyLaneAngularlyTooCloseScalar(sys1_x, sys1_y, dx1, dy1, mag2_1,
+                                              sys1_idx, lane1_idx,
+                                              dest_xs + i, dest_ys + i, dest_idxs + i, n - i);
+    }
+
+    bool (*const AnyLaneAngularlyTooClose)(float, float, float, float, float,
+                                           uint32_t, uint32_t,
+                                           const float*, const float*,
+                                           const uint32_t*, std::size_t) =
+        __builtin_cpu_supports("avx2") ? &AnyLaneAngularlyTooCloseAVX2 : &AnyLaneAngularlyTooCloseScalar;
+#else
+    inline bool AnyLaneAngularlyTooClose(float sys1_x, float sys1_y,
+                                         float dx1, float dy1, float mag2_1,
+                                         uint32_t sys1_idx, uint32_t lane1_idx,
+                                         const float* dest_xs, const float* dest_ys,
+                                         const uint32_t* dest_idxs, std::size_t n)
+    {
+        return AnyLaneAngularlyTooCloseScalar(sys1_x, sys1_y, dx1, dy1, mag2_1,
+                                              sys1_idx, lane1_idx, dest_xs, dest_ys, dest_idxs, n);
+    }
+#endif
+
+    // returns whether the proposed lane from (\a p1x, \a p1y) to
+    // (\a p2x, \a p2y) crosses any of the \a n existing lanes, given as
+    // endpoint column positions and coordinates. lanes sharing an endpoint
+    // with the proposed lane can touch but not cross, so they are skipped
+    // by index, as are degenerate lanes
+    bool AnyLaneCrossesScalar(float p1x, float p1y, float p2x, float p2y,
+                              uint32_t p1_idx, uint32_t p2_idx,
+                              const uint32_t* a_idxs, const uint32_t* b_idxs,
+                              const float* axs, const float* ays,
+                              const float* bxs, const float* bys, std::size_t n)
+    {
+        // vector along the proposed lane
+        const float v_12_x = p2x - p1x;
+        const float v_12_y = p2y - p1y;
+
+        // bounding box of the proposed lane
+        const float p_lo_x = std::min(p1x, p2x);
+        const float p_hi_x = std::max(p1x, p2x);
+        const float p_lo_y = std::min(p1y, p2y);
+        const float p_hi_y = std::max(p1y, p2y);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            if (a_idxs[i] == b_idxs[i] ||
+                a_idxs[i] == p1_idx || a_idxs[i] == p2_idx ||
+                b_idxs[i] == p1_idx || b_idxs[i] == p2_idx)
+            { continue; }
+
+            // cheap bounding-box rejection ahead of the cross-product side
+            // tests: segments whose x or y ranges don't overlap can't cross.
+            // combined bitwise so the rejection costs one predictable branch
+            if (static_cast<int>(p_hi_x < std::min(axs[i], bxs[i])) |
+                static_cast<int>(std::max(axs[i], bxs[i]) < p_lo_x) |
+                static_cast<int>(p_hi_y < std::min(ays[i], bys[i])) |
+                static_cast<int>(std::max(ays[i], bys[i]) < p_lo_y))
+            { continue; }
+
+            // are the existing lane's endpoints on opposite sides of the
+            // proposed lane? endpoints on the same side, or on the lane's
+            // line itself, mean no crossing
+            const float v_1a_x = axs[i] - p1x;
+            const float v_1a_y = ays[i] - p1y;
+            const float v_1b_x = bxs[i] - p1x;
+            const float v_1b_y = bys[i] - p1y;
+            const float cp_1a = CrossProduct(v_12_x, v_12_y, v_1a_x, v_1a_y);
+            const float cp_1b = CrossProduct(v_12_x, v_12_y, v_1b_x, v_1b_y);
+            if (!OppositeSigns(cp_1a, cp_1b))
                 continue;
 
-            const auto& sys_existing_lanes = system->StarlanesWormholes();
-
-            // check all existing lanes of currently-being-checked system
-            for (const auto& [land_end_3_id, is_wormhole] : sys_existing_lanes) {
-                (void)is_wormhole;
-                auto lane_end_sys3 = objects.getRaw<System>(land_end_3_id);
-                if (!lane_end_sys3)
-                    continue;
-                // don't need to check against existing lanes that include one
-                // of the endpoints of the lane is one of the specified systems
-                if (lane_end_sys3 == lane_end_sys1 || lane_end_sys3 == lane_end_sys2)
-                    continue;
+            // and are the proposed lane's endpoints on opposite sides of
+            // the existing lane?
+            const float v_ab_x = bxs[i] - axs[i];
+            const float v_ab_y = bys[i] - ays[i];
+            const float v_a1_x = -v_1a_x;
+            const float v_a1_y = -v_1a_y;
+            const float v_a2_x = p2x - axs[i];
+            const float v_a2_y = p2y - ays[i];
+            const float cp_a1 = CrossProduct(v_ab_x, v_ab_y, v_a1_x, v_a1_y);
+            const float cp_a2 = CrossProduct(v_ab_x, v_ab_y, v_a2_x, v_a2_y);
+            if (!OppositeSigns(cp_a1, cp_a2))
+                continue;
 
-                if (LanesCross(lane_end_sys1, lane_end_sys2, system, lane_end_sys3)) {
-                    //TraceLogger(conditions) << "... ... ... lane from: " << lane_end_sys1->UniverseObject::Name() << " to: " << lane_end_sys2->UniverseObject::Name() << " crosses lane from: " << system->UniverseObject::Name() << " to: " << lane_end_sys3->UniverseObject::Name() << "\n";
-                    return true;
-                }
-            }
+            // endpoints of each lane are on opposite sides of the other
+            // lane, so the lanes must cross
+            return true;
         }
-
         return false;
     }
 
-    bool LaneTooCloseToOtherSystem(const System* lane_end_sys1,
-                                   const System* lane_end_sys2,
-                                   const ObjectMap& objects)
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    // AVX2 variant testing eight existing lanes per iteration. the side
+    // tests compare the products of cross products against zero exactly as
+    // the scalar variant does, rather than testing raw sign bits, so
+    // collinear (zero cross product) cases keep reporting no crossing
+    __attribute__((target("avx2")))
+    bool AnyLaneCrossesAVX2(float p1x, float p1y, float p2x, float p2y,
+                            uint32_t p1_idx, uint32_t p2_idx,
+                            const uint32_t* a_idxs, const uint32_t* b_idxs,
+                            const float* axs, const float* ays,
+                            const float* bxs, const float* bys, std::size_t n)
     {
-        if (!lane_end_sys1 || !lane_end_sys2 || lane_end_sys1 == lane_end_sys2)
-            return true;
-
-        // loop over all existing systems, checking if each is too close to a
-        // lane between the specified lane endpoints
-        for (auto* system : objects.allRaw<System>()) {
-            if (system == lane_end_sys1 || system == lane_end_sys2)
+        const __m256 p1x8 = _mm256_set1_ps(p1x);
+        const __m256 p1y8 = _mm256_set1_ps(p1y);
+        const __m256 p2x8 = _mm256_set1_ps(p2x);
+        const __m256 p2y8 = _mm256_set1_ps(p2y);
+        const __m256 v12x8 = _mm256_set1_ps(p2x - p1x);
+        const __m256 v12y8 = _mm256_set1_ps(p2y - p1y);
+        const __m256i p1_idx8 = _mm256_set1_epi32(static_cast<int>(p1_idx));
+        const __m256i p2_idx8 = _mm256_set1_epi32(static_cast<int>(p2_idx));
+        const __m256 zero8 = _mm256_setzero_ps();
+        const __m256 signbit8 = _mm256_set1_ps(-0.0f);
+        const __m256 p_lo_x8 = _mm256_set1_ps(std::min(p1x, p2x));
+        const __m256 p_hi_x8 = _mm256_set1_ps(std::max(p1x, p2x));
+        const __m256 p_lo_y8 = _mm256_set1_ps(std::min(p1y, p2y));
+        const __m256 p_hi_y8 = _mm256_set1_ps(std::max(p1y, p2y));
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const __m256i a_idx8 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_idxs + i));
+            const __m256i b_idx8 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b_idxs + i));
+            const __m256i skip =
+                _mm256_or_si256(_mm256_cmpeq_epi32(a_idx8, b_idx8),
+                    _mm256_or_si256(
+                        _mm256_or_si256(_mm256_cmpeq_epi32(a_idx8, p1_idx8),
+                                        _mm256_cmpeq_epi32(a_idx8, p2_idx8)),
+                        _mm256_or_si256(_mm256_cmpeq_epi32(b_idx8, p1_idx8),
+                                        _mm256_cmpeq_epi32(b_idx8, p2_idx8))));
+            const __m256 ax8 = _mm256_loadu_ps(axs + i);
+            const __m256 ay8 = _mm256_loadu_ps(ays + i);
+            const __m256 bx8 = _mm256_loadu_ps(bxs + i);
+            const __m256 by8 = _mm256_loadu_ps(bys + i);
+            // bounding-box rejection: if no unskipped lane's x and y ranges
+            // both overlap the proposed lane's, the whole batch can be
+            // dropped before any of the side tests
+            const __m256 disjoint =
+                _mm256_or_ps(
+                    _mm256_or_ps(_mm256_cmp_ps(p_hi_x8, _mm256_min_ps(ax8, bx8), _CMP_LT_OQ),
+                                 _mm256_cmp_ps(_mm256_max_ps(ax8, bx8), p_lo_x8, _CMP_LT_OQ)),
+                    _mm256_or_ps(_mm256_cmp_ps(p_hi_y8, _mm256_min_ps(ay8, by8), _CMP_LT_OQ),
+                                 _mm256_cmp_ps(_mm256_max_ps(ay8, by8), p_lo_y8, _CMP_LT_OQ)));
+            const __m256 candidates = _mm256_andnot_ps(
+                _mm256_or_ps(_mm256_castsi256_ps(skip), disjoint), _mm256_castsi256_ps(_mm256_set1_epi32(-1)));
+            if (!_mm256_movemask_ps(candidates))
                 continue;
-
-            if (ObjectTooCloseToLane(lane_end_sys1, lane_end_sys2, system))
+            const __m256 v1ax = _mm256_sub_ps(ax8, p1x8);
+            const __m256 v1ay = _mm256_sub_ps(ay8, p1y8);
+            const __m256 v1bx = _mm256_sub_ps(bx8, p1x8);
+            const __m256 v1by = _mm256_sub_ps(by8, p1y8);
+            const __m256 cp_1a = _mm256_sub_ps(_mm256_mul_ps(v12x8, v1ay),
+                                               _mm256_mul_ps(v12y8, v1ax));
+            const __m256 cp_1b = _mm256_sub_ps(_mm256_mul_ps(v12x8, v1by),
+                                               _mm256_mul_ps(v12y8, v1bx));
+            // opposite-sign test on the sign bits with zeros excluded, as in
+            // the scalar OppositeSigns
+            const __m256 side1 = _mm256_and_ps(
+                _mm256_castsi256_ps(_mm256_srai_epi32(
+                    _mm256_castps_si256(_mm256_xor_ps(cp_1a, cp_1b)), 31)),
+                _mm256_and_ps(_mm256_cmp_ps(cp_1a, zero8, _CMP_NEQ_OQ),
+                              _mm256_cmp_ps(cp_1b, zero8, _CMP_NEQ_OQ)));
+            const __m256 vabx = _mm256_sub_ps(bx8, ax8);
+            const __m256 vaby = _mm256_sub_ps(by8, ay8);
+            const __m256 va1x = _mm256_xor_ps(v1ax, signbit8);  // exact sign flip, as the scalar negation
+            const __m256 va1y = _mm256_xor_ps(v1ay, signbit8);
+            const __m256 va2x = _mm256_sub_ps(p2x8, ax8);
+            const __m256 va2y = _mm256_sub_ps(p2y8, ay8);
+            const __m256 cp_a1 = _mm256_sub_ps(_mm256_mul_ps(vabx, va1y),
+                                               _mm256_mul_ps(vaby, va1x));
+            const __m256 cp_a2 = _mm256_sub_ps(_mm256_mul_ps(vabx, va2y),
+                                               _mm256_mul_ps(vaby, va2x));
+            const __m256 side2 = _mm256_and_ps(
+                _mm256_castsi256_ps(_mm256_srai_epi32(
+                    _mm256_castps_si256(_mm256_xor_ps(cp_a1, cp_a2)), 31)),
+                _mm256_and_ps(_mm256_cmp_ps(cp_a1, zero8, _CMP_NEQ_OQ),
+                              _mm256_cmp_ps(cp_a2, zero8, _CMP_NEQ_OQ)));
+            const __m256 crossing = _mm256_and_ps(candidates, _mm256_and_ps(side1, side2));
+            if (_mm256_movemask_ps(crossing))
                 return true;
         }
-
-        return false;
+        return AnyLaneCrossesScalar(p1x, p1y, p2x, p2y, p1_idx, p2_idx,
+                                    a_idxs + i, b_idxs + i,
+                                    axs + i, ays + i, bxs + i, bys + i, n - i);
+    }
+
+    bool (*const AnyLaneCrosses)(float, float, float, float, uint32_t, uint32_t,
+                                 const uint32_t*, const uint32_t*,
+                                 const float*, const float*,
+                                 const float*, const float*, std::size_t) =
+        __builtin_cpu_supports("avx2") ? &AnyLaneCrossesAVX2 : &AnyLaneCrossesScalar;
+#else
+    inline bool AnyLaneCrosses(float p1x, float p1y, float p2x, float p2y,
+                               uint32_t p1_idx, uint32_t p2_idx,
+                               const uint32_t* a_idxs, const uint32_t* b_idxs,
+                               const float* axs, const float* ays,
+                               const float* bxs, const float* bys, std::size_t n)
+    {
+        return AnyLaneCrossesScalar(p1x, p1y, p2x, p2y, p1_idx, p2_idx,
+                                    a_idxs, b_idxs, axs, ays, bxs, bys, n);
     }
+#endif
 
     struct CanAddStarlaneConnectionSimpleMatch {
         CanAddStarlaneConnectionSimpleMatch(const ObjectSet& destination_objects,
-                                            const ObjectMap& objects) :
-            m_objects(objects),
-            m_destination_systems{[&destination_objects, &objects]() {
-                // get set of (unique) systems that are or that contain any
-                // destination objects
-                std::vector<const System*> retval;
-                retval.reserve(destination_objects.size());
-                std::for_each(destination_objects.begin(), destination_objects.end(),
-                              [&objects, &retval](const UniverseObject* obj) {
-                                  if (!obj)
-                                      return;
-                                  if (obj->ObjectType() == UniverseObjectType::OBJ_SYSTEM) {
-                                      retval.push_back(static_cast<const System*>(obj));
-                                      return;
-                                  }
-                                  int sys_id = obj->SystemID();
-                                  if (sys_id != INVALID_OBJECT_ID)
-                                      if (const auto* sys = objects.getRaw<const System>(sys_id))
-                                          retval.push_back(sys);
-                              });
-                // ensure uniqueness
-                std::sort(retval.begin(), retval.end());
-                auto unique_it = std::unique(retval.begin(), retval.end());
-                retval.resize(std::distance(retval.begin(), unique_it));
-                return retval;
-            }()}
-        {}
+                                            const ObjectMap& objects)
+        {
+            // gather all systems' coordinates into columns, with positions
+            // keyed by system id, and all existing lanes into a deduplicated
+            // list of column-position pairs, so the per-candidate geometry
+            // checks below read contiguous floats instead of re-walking the
+            // object map for every candidate / destination pair
+            for (const auto* system : objects.allRaw<System>()) {
+                m_sys_idx_by_id.emplace(system->ID(), static_cast<uint32_t>(m_xs.size()));
+                m_xs.push_back(static_cast<float>(system->X()));
+                m_ys.push_back(static_cast<float>(system->Y()));
+            }
+            uint32_t idx = 0;
+            m_sys_lane_offsets.reserve(m_xs.size() + 1);
+            m_sys_lane_offsets.push_back(0u);
+            for (const auto* system : objects.allRaw<System>()) {
+                for (const auto& [lane_end_id, is_wormhole] : system->StarlanesWormholes()) {
+                    const auto it = m_sys_idx_by_id.find(lane_end_id);
+                    if (it == m_sys_idx_by_id.end())
+                        continue;
+                    // every system's lane ends, so the per-candidate checks
+                    // read a contiguous slice instead of the system's lane map
+                    m_sys_lane_end_idxs.push_back(it->second);
+                    // each lane appears in both of its endpoints' lane lists,
+                    // so keep only the ordered-pair occurrence
+                    if (idx < it->second) {
+                        m_lane_a_idxs.push_back(idx);
+                        m_lane_b_idxs.push_back(it->second);
+                    }
+                    // proper starlanes (not wormholes) also go into a directed
+                    // adjacency list, searched instead of the lane-end maps
+                    if (!is_wormhole)
+                        m_starlanes.emplace_back(idx, it->second);
+                }
+                m_sys_lane_offsets.push_back(static_cast<uint32_t>(m_sys_lane_end_idxs.size()));
+                ++idx;
+            }
+            std::sort(m_starlanes.begin(), m_starlanes.end());
+
+            // coordinates of the deduplicated lanes' endpoints, as columns for
+            // the batched crossing check
+            m_lane_axs.reserve(m_lane_a_idxs.size());
+            m_lane_ays.reserve(m_lane_a_idxs.size());
+            m_lane_bxs.reserve(m_lane_a_idxs.size());
+            m_lane_bys.reserve(m_lane_a_idxs.size());
+            for (std::size_t i = 0; i < m_lane_a_idxs.size(); ++i) {
+                m_lane_axs.push_back(m_xs[m_lane_a_idxs[i]]);
+                m_lane_ays.push_back(m_ys[m_lane_a_idxs[i]]);
+                m_lane_bxs.push_back(m_xs[m_lane_b_idxs[i]]);
+                m_lane_bys.push_back(m_ys[m_lane_b_idxs[i]]);
+            }
+
+            // bin the systems into a uniform grid over their bounding box, so
+            // the lane-proximity check can visit just the systems near a lane
+            // instead of every system in the universe
+            if (!m_xs.empty()) {
+                const auto [min_x, max_x] = std::minmax_element(m_xs.begin(), m_xs.end());
+                const auto [min_y, max_y] = std::minmax_element(m_ys.begin(), m_ys.end());
+                m_grid_min_x = *min_x;
+                m_grid_min_y = *min_y;
+                m_grid_w = static_cast<uint32_t>((*max_x - *min_x) / GRID_CELL_SIZE) + 1;
+                m_grid_h = static_cast<uint32_t>((*max_y - *min_y) / GRID_CELL_SIZE) + 1;
+                m_grid.resize(static_cast<std::size_t>(m_grid_w) * m_grid_h);
+                for (uint32_t i = 0; i < static_cast<uint32_t>(m_xs.size()); ++i)
+                    m_grid[GridCellY(m_ys[i]) * m_grid_w + GridCellX(m_xs[i])].push_back(i);
+            }
+
+            // get set of (unique) systems that are or that contain any
+            // destination objects. destinations are typically few, so the
+            // working set lives in an inline buffer instead of a heap
+            // allocation
+            boost::container::small_vector<const System*, 16> dest_systems;
+            for (const auto* obj : destination_objects) {
+                if (!obj)
+                    continue;
+                if (obj->ObjectType() == UniverseObjectType::OBJ_SYSTEM) {
+                    dest_systems.push_back(static_cast<const System*>(obj));
+                    continue;
+                }
+                int sys_id = obj->SystemID();
+                if (sys_id != INVALID_OBJECT_ID)
+                    if (const auto* sys = objects.getRaw<const System>(sys_id))
+                        dest_systems.push_back(sys);
+            }
+            // ensure uniqueness
+            std::sort(dest_systems.begin(), dest_systems.end());
+            auto unique_it = std::unique(dest_systems.begin(), dest_systems.end());
+            dest_systems.erase(unique_it, dest_systems.end());
+
+            m_destination_systems.reserve(dest_systems.size());
+            m_destination_idxs.reserve(dest_systems.size());
+            m_dest_xs.reserve(dest_systems.size());
+            m_dest_ys.reserve(dest_systems.size());
+            for (const auto* sys : dest_systems) {
+                const auto it = m_sys_idx_by_id.find(sys->ID());
+                if (it == m_sys_idx_by_id.end())
+                    continue;   // can't happen: every destination system is in the same object map
+                m_destination_systems.push_back(sys);
+                m_destination_idxs.push_back(it->second);
+                m_dest_xs.push_back(m_xs[it->second]);
+                m_dest_ys.push_back(m_ys[it->second]);
+            }
+
+            // sorted copy of the destination column positions, for the
+            // membership test each candidate starts with
+            m_sorted_destination_idxs = m_destination_idxs;
+            std::sort(m_sorted_destination_idxs.begin(), m_sorted_destination_idxs.end());
+
+            // precompute each destination's existing lane vectors, so the
+            // per-candidate angle checks against them read ready-made columns
+            // instead of re-resolving and re-subtracting per candidate
+            m_dest_lane_offsets.reserve(m_destination_systems.size() + 1);
+            m_dest_lane_offsets.push_back(0u);
+            for (std::size_t dest_num = 0; dest_num < m_destination_systems.size(); ++dest_num) {
+                const float dest_x = m_dest_xs[dest_num];
+                const float dest_y = m_dest_ys[dest_num];
+                const uint32_t dest_idx = m_destination_idxs[dest_num];
+                for (uint32_t li = m_sys_lane_offsets[dest_idx];
+                     li < m_sys_lane_offsets[dest_idx + 1]; ++li)
+                {
+                    const uint32_t lane_end_idx = m_sys_lane_end_idxs[li];
+                    const float dx = m_xs[lane_end_idx] - dest_x;
+                    const float dy = m_ys[lane_end_idx] - dest_y;
+                    m_dest_lane_end_idxs.push_back(lane_end_idx);
+                    m_dest_lane_dxs.push_back(dx);
+                    m_dest_lane_dys.push_back(dy);
+                    m_dest_lane_mag2s.push_back(dx*dx + dy*dy);
+                }
+                m_dest_lane_offsets.push_back(static_cast<uint32_t>(m_dest_lane_end_idxs.size()));
+            }
+        }
 
         bool operator()(const UniverseObject* candidate) const {
             if (!candidate)
                 return false;
 
-            // get system from candidate
-            const System* candidate_sys = nullptr;
-            if (candidate->ObjectType() == UniverseObjectType::OBJ_SYSTEM)
-                candidate_sys = static_cast<const System*>(candidate);
-            if (!candidate_sys)
-                candidate_sys = m_objects.getRaw<System>(candidate->SystemID());
-            if (!candidate_sys)
+            // resolve the candidate's system column position directly by id:
+            // the id map was built from every system in the same object map,
+            // so a hit also establishes that the system exists, without an
+            // object map lookup per candidate
+            const int sys_id = candidate->ObjectType() == UniverseObjectType::OBJ_SYSTEM ?
+                candidate->ID() : candidate->SystemID();
+            const auto cand_it = m_sys_idx_by_id.find(sys_id);
+            if (cand_it == m_sys_idx_by_id.end())
                 return false;
+            const uint32_t cand_idx = cand_it->second;
 
             // check if candidate is one of the destination systems
-            if (std::any_of(m_destination_systems.begin(), m_destination_systems.end(),
-                [can_id{candidate_sys->ID()}](const auto* d) { return can_id == d->ID(); }))
+            if (std::binary_search(m_sorted_destination_idxs.begin(),
+                                   m_sorted_destination_idxs.end(), cand_idx))
             { return false; }
 
 
-            // check if candidate already has a lane to any of the destination systems
-            for (auto* destination : m_destination_systems) {
-                if (candidate_sys->HasStarlaneTo(destination->ID()))
-                    return false;
+            // check if any of the proposed lanes are too close to any already-
+            // present lanes of the candidate system, a batch of destinations
+            // at a time
+            const float cand_x = m_xs[cand_idx];
+            const float cand_y = m_ys[cand_idx];
+            if (!m_destination_idxs.empty()) {
+                const uint32_t cand_lanes_begin = m_sys_lane_offsets[cand_idx];
+                const uint32_t cand_lanes_end = m_sys_lane_offsets[cand_idx + 1];
+                for (uint32_t li = cand_lanes_begin; li < cand_lanes_end; ++li) {
+                    const uint32_t lane_end_idx = m_sys_lane_end_idxs[li];
+                    if (lane_end_idx == cand_idx)
+                        return false;   // degenerate existing lane
+
+                    const float dx1 = m_xs[lane_end_idx] - cand_x;
+                    const float dy1 = m_ys[lane_end_idx] - cand_y;
+                    const float mag2_1 = dx1*dx1 + dy1*dy1;
+                    if (mag2_1 == 0.0f ||
+                        AnyLaneAngularlyTooClose(cand_x, cand_y, dx1, dy1, mag2_1,
+                                                 cand_idx, lane_end_idx,
+                                                 m_dest_xs.data(), m_dest_ys.data(),
+                                                 m_destination_idxs.data(), m_destination_idxs.size()))
+                    { return false; }
+                }
             }
 
-            // check if any of the proposed lanes are too close to any already-
-            // present lanes of the candidate system
-            //TraceLogger(conditions) << "... Checking lanes of candidate system: " << candidate->UniverseObject::Name() << "\n";
-            for (const auto& lane : candidate_sys->StarlanesWormholes()) {
-                auto candidate_existing_lane_end_sys = m_objects.getRaw<System>(lane.first);
-                if (!candidate_existing_lane_end_sys)
-                    continue;
 
-                // check this existing lane against potential lanes to all destination systems
-                for (auto* dest_sys : m_destination_systems) {
-                    if (LanesAngularlyTooClose(candidate_sys, candidate_existing_lane_end_sys,
-                                               dest_sys))
-                    {
-                        //TraceLogger(conditions) << " ... ... can't add lane from candidate: " << candidate_sys->UniverseObject::Name() << " to " << dest_sys->UniverseObject::Name() << " due to existing lane to " << candidate_existing_lane_end_sys->UniverseObject::Name() << "\n";
+            // the remaining per-destination checks run fused in a single
+            // pass, sharing each destination's column position and keeping
+            // its lane columns hot across the checks
+            for (std::size_t dest_num = 0; dest_num < m_destination_idxs.size(); ++dest_num) {
+                const uint32_t dest_idx = m_destination_idxs[dest_num];
+
+                // does the candidate already have a lane to this destination?
+                // one binary search of the sorted adjacency list instead of a
+                // walk of the candidate's lane map
+                if (std::binary_search(m_starlanes.begin(), m_starlanes.end(),
+                                       std::pair{cand_idx, dest_idx}))
+                { return false; }
+
+                // is the proposed lane too close angularly to any already-
+                // present lane of this destination? uses the lane vectors
+                // precomputed per destination in the ctor
+                const uint32_t lanes_begin = m_dest_lane_offsets[dest_num];
+                const uint32_t lanes_end = m_dest_lane_offsets[dest_num + 1];
+
+                // vector from this destination to the candidate
+                const float dx1 = cand_x - m_dest_xs[dest_num];
+                const float dy1 = cand_y - m_dest_ys[dest_num];
+                const float mag2_1 = dx1*dx1 + dy1*dy1;
+                if (mag2_1 == 0.0f) {
+                    // coincident with the candidate: too close to any existing lane
+                    if (lanes_begin != lanes_end)
                         return false;
+                } else {
+                    const float limit = MAX_LANE_DOT_PRODUCT_SQ * mag2_1;
+                    for (uint32_t i = lanes_begin; i < lanes_end; ++i) {
+                        if (m_dest_lane_end_idxs[i] == cand_idx || m_dest_lane_end_idxs[i] == dest_idx)
+                            return false;   // lane to the candidate itself, or degenerate existing lane
+                        if (m_dest_lane_mag2s[i] == 0.0f)
+                            return false;
+                        const float dp = dx1*m_dest_lane_dxs[i] + dy1*m_dest_lane_dys[i];
+                        if (dp > 0.0f && dp*dp >= limit * m_dest_lane_mag2s[i])
+                            return false;
                     }
                 }
-            }
 
+                // is the proposed lane too close to a system it is not
+                // connected to?
+                if (LaneTooCloseToOtherSystem(cand_idx, dest_idx))
+                    return false;
 
-            // check if any of the proposed lanes are too close to any already-
-            // present lanes of any of the destination systems
-            //TraceLogger(conditions) << "... Checking lanes of destination systems:" << "\n";
-            for (auto* dest_sys : m_destination_systems) {
-                // check this destination system's existing lanes against a lane
-                // to the candidate system
-                for (const auto& dest_lane : dest_sys->StarlanesWormholes()) {
-                    auto dest_lane_end_sys = m_objects.getRaw<const System>(dest_lane.first);
-                    if (!dest_lane_end_sys)
-                        continue;
+                // does the proposed lane cross an already-existing lane?
+                if (LaneCrossesExistingLane(cand_idx, dest_idx))
+                    return false;
+            }
 
-                    if (LanesAngularlyTooClose(dest_sys, candidate_sys, dest_lane_end_sys)) {
-                        //TraceLogger(conditions) << " ... ... can't add lane from candidate: " << candidate_sys->UniverseObject::Name() << " to " << dest_sys->UniverseObject::Name() << " due to existing lane from dest to " << dest_lane_end_sys->UniverseObject::Name() << "\n";
-                        return false;
-                    }
-                }
+            // check if any of the proposed lanes are too close to eachother:
+            // each pair once, batching each position against the positions
+            // after it. this check stays a separate pass since it pairs
+            // destinations with each other rather than visiting them singly
+            for (std::size_t i = 0; i + 1 < m_destination_idxs.size(); ++i) {
+                const uint32_t dest1_idx = m_destination_idxs[i];
+                const float dx1 = m_dest_xs[i] - cand_x;
+                const float dy1 = m_dest_ys[i] - cand_y;
+                const float mag2_1 = dx1*dx1 + dy1*dy1;
+                if (mag2_1 == 0.0f ||
+                    AnyLaneAngularlyTooClose(cand_x, cand_y, dx1, dy1, mag2_1,
+                                             cand_idx, dest1_idx,
+                                             m_dest_xs.data() + i + 1, m_dest_ys.data() + i + 1,
+                                             m_destination_idxs.data() + i + 1,
+                                             m_destination_idxs.size() - i - 1))
+                { return false; }
             }
 
+            return true;
+        }
 
-            // check if any of the proposed lanes are too close to eachother
-            //TraceLogger(conditions) << "... Checking proposed lanes against eachother" << "\n";
-            for (auto it1 = m_destination_systems.begin();
-                 it1 != m_destination_systems.end(); ++it1)
-            {
-                auto* dest_sys1 = *it1;
-
-                // don't need to check a lane in both directions, so start at one past it1
-                auto it2 = it1;
-                ++it2;
-                for (; it2 != m_destination_systems.end(); ++it2) {
-                    auto* dest_sys2 = *it2;
-                    if (LanesAngularlyTooClose(candidate_sys, dest_sys1, dest_sys2)) {
-                        //TraceLogger(conditions) << " ... ... can't add lane from candidate: " << candidate_sys->UniverseObject::Name() << " to " << dest_sys1->UniverseObject::Name() << " and also to " << dest_sys2->UniverseObject::Name() << "\n";
-                        return false;
-                    }
-                }
-            }
+        // the geometry checks below read positions from the coordinate
+        // columns, with column-position equality standing in for the object
+        // pointer equality their old object-based forms tested
 
+        // check the distance between a system and a (possibly nonexistant)
+        // starlane between two other systems. distance here is how far the third
+        // system is from the line passing through the lane endpoint systems, as
+        // long as the third system is closer to either end point than the endpoints
+        // are to eachother. if the third system is further than the endpoints, than
+        // the distance to the line is not considered and the lane is considered
+        // acceptable
+        bool ObjectTooCloseToLane(uint32_t lane_end_sys1, uint32_t lane_end_sys2,
+                                  uint32_t obj) const
+        {
+            if (lane_end_sys1 == lane_end_sys2 || obj == lane_end_sys1 || obj == lane_end_sys2)
+                return true;
 
-            // check that the proposed lanes are not too close to any existing
-            // system they are not connected to
-            //TraceLogger(conditions) << "... Checking proposed lanes for proximity to other systems" << "\n";
-            for (auto* dest_sys : m_destination_systems) {
-                if (LaneTooCloseToOtherSystem(candidate_sys, dest_sys, m_objects)) {
-                    //TraceLogger(conditions) << " ... ... can't add lane from candidate: " << candidate_sys->Name() << " to " << dest_sys->Name() << " due to proximity to another system." << "\n";
-                    return false;
-                }
-            }
+            // check distances (squared) between object and lane-end systems
+            const float v_12_x = m_xs[lane_end_sys2] - m_xs[lane_end_sys1];
+            const float v_12_y = m_ys[lane_end_sys2] - m_ys[lane_end_sys1];
+            const float v_o1_x = m_xs[lane_end_sys1] - m_xs[obj];
+            const float v_o1_y = m_ys[lane_end_sys1] - m_ys[obj];
+            const float v_o2_x = m_xs[lane_end_sys2] - m_xs[obj];
+            const float v_o2_y = m_ys[lane_end_sys2] - m_ys[obj];
+
+            const float dist2_12 = v_12_x*v_12_x + v_12_y*v_12_y;
+            const float dist2_o1 = v_o1_x*v_o1_x + v_o1_y*v_o1_y;
+            const float dist2_o2 = v_o2_x*v_o2_x + v_o2_y*v_o2_y;
+
+            // object on a zero-length lane: the three comparisons are combined
+            // bitwise, so one predictable branch tests them all rather than one
+            // poorly-predicted branch each
+            if (static_cast<int>(dist2_12 == 0.0f) | static_cast<int>(dist2_o1 == 0.0f) |
+                static_cast<int>(dist2_o2 == 0.0f))
+            { return true; }
+
+            // if object is further from either of the lane end systems than they
+            // are from each other, it is fine, regardless of the right-angle
+            // distance to the line between the systems
+            if (static_cast<int>(dist2_12 < dist2_o1) | static_cast<int>(dist2_12 < dist2_o2))
+                return false;
 
+            // check right-angle distance between obj and lane
 
-            // check that there are no lanes already existing that cross the proposed lanes
-            //TraceLogger(conditions) << "... Checking for potential lanes crossing existing lanes" << "\n";
-            for (auto* dest_sys : m_destination_systems) {
-                if (LaneCrossesExistingLane(candidate_sys, dest_sys, m_objects)) {
-                    //TraceLogger(conditions) << " ... ... can't add lane from candidate: " << candidate_sys->Name() << " to " << dest_sys->Name() << " due to crossing an existing lane." << "\n";
-                    return false;
+            // distance to point from line from vector projection / cross products
+            //       O
+            //      /|
+            //     / |
+            //    /  |d
+            //   /   |
+            //  /a___|___
+            // 1         2
+            // (1O)x(12) = |1O| |12| sin(a)
+            // d = |1O| sin(a) = (1O)x(12) / |12|
+            // compared squared and scaled by the lane's squared length: the same
+            // test as normalizing the lane vector first, but with no sqrt or
+            // divides
+            const float cross = v_o1_x*v_12_y - v_o1_y*v_12_x;
+
+            return cross*cross < MIN_PERP_DIST_SQ * dist2_12;
+        }
+
+        bool LaneCrossesExistingLane(uint32_t lane_end_sys1, uint32_t lane_end_sys2) const {
+            if (lane_end_sys1 == lane_end_sys2)
+                return true;
+
+            // check the proposed lane against the existing lane endpoint
+            // columns, a batch of lanes at a time
+            return AnyLaneCrosses(m_xs[lane_end_sys1], m_ys[lane_end_sys1],
+                                  m_xs[lane_end_sys2], m_ys[lane_end_sys2],
+                                  lane_end_sys1, lane_end_sys2,
+                                  m_lane_a_idxs.data(), m_lane_b_idxs.data(),
+                                  m_lane_axs.data(), m_lane_ays.data(),
+                                  m_lane_bxs.data(), m_lane_bys.data(),
+                                  m_lane_a_idxs.size());
+        }
+
+        // clamped grid cell coordinates of a position
+        uint32_t GridCellX(float x) const {
+            const float off = (x - m_grid_min_x) / GRID_CELL_SIZE;
+            return off <= 0.0f ? 0u : std::min(m_grid_w - 1, static_cast<uint32_t>(off));
+        }
+        uint32_t GridCellY(float y) const {
+            const float off = (y - m_grid_min_y) / GRID_CELL_SIZE;
+            return off <= 0.0f ? 0u : std::min(m_grid_h - 1, static_cast<uint32_t>(off));
+        }
+
+        bool LaneTooCloseToOtherSystem(uint32_t lane_end_sys1, uint32_t lane_end_sys2) const {
+            if (lane_end_sys1 == lane_end_sys2)
+                return true;
+
+            const float x1 = m_xs[lane_end_sys1];
+            const float y1 = m_ys[lane_end_sys1];
+            const float x2 = m_xs[lane_end_sys2];
+            const float y2 = m_ys[lane_end_sys2];
+
+            // a lane between coincident positions is too close to any third
+            // system, and has no meaningful bounding box to scan
+            const float dx = x2 - x1;
+            const float dy = y2 - y1;
+            if (dx*dx + dy*dy == 0.0f)
+                return m_xs.size() > 2;
+
+            // any system too close to the lane projects onto the segment
+            // between the endpoints at under the proximity limit, so it lies
+            // within the segment's bounding box expanded by that limit: only
+            // the grid cells covering that box need to be checked
+            const uint32_t cx0 = GridCellX(std::min(x1, x2) - MIN_PERP_DIST);
+            const uint32_t cx1 = GridCellX(std::max(x1, x2) + MIN_PERP_DIST);
+            const uint32_t cy0 = GridCellY(std::min(y1, y2) - MIN_PERP_DIST);
+            const uint32_t cy1 = GridCellY(std::max(y1, y2) + MIN_PERP_DIST);
+
+            for (uint32_t cy = cy0; cy <= cy1; ++cy) {
+                for (uint32_t cx = cx0; cx <= cx1; ++cx) {
+                    for (uint32_t sys_idx : m_grid[cy * m_grid_w + cx]) {
+                        if (sys_idx == lane_end_sys1 || sys_idx == lane_end_sys2)
+                            continue;
+
+                        if (ObjectTooCloseToLane(lane_end_sys1, lane_end_sys2, sys_idx))
+                            return true;
+                    }
                 }
             }
 
-            return true;
+            return false;
         }
 
-        const ObjectMap& m_objects;
-        const std::vector<const System*> m_destination_systems;
+        std::vector<float> m_xs;    // all systems' coordinates, in column order
+        std::vector<float> m_ys;
+        boost::container::flat_map<int, uint32_t> m_sys_idx_by_id;  // system id -> column position
+        std::vector<uint32_t> m_lane_a_idxs;        // existing lanes, each included once, as endpoint columns
+        std::vector<uint32_t> m_lane_b_idxs;
+        std::vector<float> m_lane_axs;              // coordinates of those endpoints
+        std::vector<float> m_lane_ays;
+        std::vector<float> m_lane_bxs;
+        std::vector<float> m_lane_bys;
+        std::vector<std::pair<uint32_t, uint32_t>> m_starlanes;     // directed non-wormhole lanes, sorted for binary search
+        std::vector<uint32_t> m_sys_lane_offsets;   // system column position -> range in m_sys_lane_end_idxs
+        std::vector<uint32_t> m_sys_lane_end_idxs;  // each system's lane end column positions
+        std::vector<const System*> m_destination_systems;
+        std::vector<uint32_t> m_destination_idxs;                   // column positions of m_destination_systems
+        std::vector<uint32_t> m_sorted_destination_idxs;            // the same positions in sorted order
+        std::vector<float> m_dest_xs;   // destination coordinates, contiguous for the batched angle checks
+        std::vector<float> m_dest_ys;
+        std::vector<uint32_t> m_dest_lane_offsets;  // destination -> range in the lane columns below
+        std::vector<uint32_t> m_dest_lane_end_idxs; // column positions of each destination's lane ends
+        std::vector<float> m_dest_lane_dxs;         // lane vectors from each destination to its lane ends
+        std::vector<float> m_dest_lane_dys;
+        std::vector<float> m_dest_lane_mag2s;       // squared lengths of those vectors
+        std::vector<std::vector<uint32_t>> m_grid;  // column positions binned by grid cell, row-major
+        float m_grid_min_x = 0.0f;
+        float m_grid_min_y = 0.0f;
+        uint32_t m_grid_w = 1;
+        uint32_t m_grid_h = 1;
     };
 }
 
@@ -8695,23 +11038,27 @@ bool CanAddStarlaneConnection::Match(const ScriptingContext& local_context) cons
         return false;
     }
 
-    // get subcondition matches
-    ObjectSet subcondition_matches = m_condition->Eval(local_context);
+    // get subcondition matches, into a reused buffer as in Contains::Match
+    static thread_local ObjectSet subcondition_matches_buf;
+    ObjectSet subcondition_matches{std::move(subcondition_matches_buf)};
+    m_condition->Eval(local_context, subcondition_matches);
+
+    bool retval = CanAddStarlaneConnectionSimpleMatch(subcondition_matches,
+                                                      local_context.ContextObjects())(candidate);
 
-    return CanAddStarlaneConnectionSimpleMatch(subcondition_matches,
-                                               local_context.ContextObjects())(candidate);
+    subcondition_matches_buf = std::move(subcondition_matches);     // keep the capacity for the next call
+    return retval;
 }
 
 void CanAddStarlaneConnection::SetTopLevelContent(const std::string& content_name) {
-    if (m_condition)
-        m_condition->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_condition);
 }
 
 unsigned int CanAddStarlaneConnection::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::CanAddStarlaneConnection");
-    CheckSums::CheckSumCombine(retval, m_condition);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::CanAddStarlaneConnection");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_condition);
 
     TraceLogger(conditions) << "GetCheckSum(CanAddStarlaneConnection): retval: " << retval;
     return retval;
@@ -8747,23 +11094,20 @@ bool ExploredByEmpire::operator==(const Condition& rhs) const {
 
 namespace {
     struct ExploredByEmpireSimpleMatch {
-        ExploredByEmpireSimpleMatch(int empire_id, const ScriptingContext& context) :
-            m_empire_id(empire_id),
-            m_context(context)
-        {}
+        ExploredByEmpireSimpleMatch(int empire_id, const ScriptingContext& context) {
+            // resolve the empire's explored-systems map once, rather than
+            // looking the empire up per candidate
+            if (auto empire = context.GetEmpire(empire_id))
+                m_explored_systems = &empire->TurnsSystemsExplored();
+        }
 
         bool operator()(const UniverseObject* candidate) const {
-            if (!candidate)
+            if (!candidate || !m_explored_systems)
                 return false;
-
-            auto empire = m_context.GetEmpire(m_empire_id);
-            if (!empire)
-                return false;
-            return empire->HasExploredSystem(candidate->ID());
+            return m_explored_systems->count(candidate->ID());
         }
 
-        int                     m_empire_id = ALL_EMPIRES;
-        const ScriptingContext& m_context;
+        const std::map<int, int>* m_explored_systems = nullptr; // system id -> turn explored
     };
 }
 
@@ -8819,15 +11163,14 @@ bool ExploredByEmpire::Match(const ScriptingContext& local_context) const {
 }
 
 void ExploredByEmpire::SetTopLevelContent(const std::string& content_name) {
-    if (m_empire_id)
-        m_empire_id->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_empire_id);
 }
 
 unsigned int ExploredByEmpire::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::ExploredByEmpire");
-    CheckSums::CheckSumCombine(retval, m_empire_id);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::ExploredByEmpire");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_empire_id);
 
     TraceLogger(conditions) << "GetCheckSum(ExploredByEmpire): retval: " << retval;
     return retval;
@@ -8867,10 +11210,13 @@ bool Stationary::Match(const ScriptingContext& local_context) const {
     // the only objects that can move are fleets and the ships in them.  so,
     // attempt to cast the candidate object to a fleet or ship, and if it's a ship
     // get the fleet of that ship
-    auto fleet = dynamic_cast<const Fleet*>(candidate);
-    if (!fleet)
-        if (auto ship = dynamic_cast<const Ship*>(candidate))
-            fleet = local_context.ContextObjects().getRaw<Fleet>(ship->FleetID());
+    const Fleet* fleet = nullptr;
+    if (candidate->ObjectType() == UniverseObjectType::OBJ_FLEET) {
+        fleet = static_cast<const Fleet*>(candidate);
+    } else if (candidate->ObjectType() == UniverseObjectType::OBJ_SHIP) {
+        auto* ship = static_cast<const Ship*>(candidate);
+        fleet = local_context.ContextObjects().getRaw<Fleet>(ship->FleetID());
+    }
 
     if (fleet) {
         // if a fleet is available, it is "moving", or not stationary, if it's
@@ -8889,7 +11235,8 @@ bool Stationary::Match(const ScriptingContext& local_context) const {
 unsigned int Stationary::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Stationary");
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Stationary");
+    CheckSums::CheckSumCombine(retval, tag_checksum);
 
     TraceLogger(conditions) << "GetCheckSum(Stationary): retval: " << retval;
     return retval;
@@ -8957,8 +11304,8 @@ bool Aggressive::Match(const ScriptingContext& local_context) const {
 unsigned int Aggressive::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Aggressive");
-    CheckSums::CheckSumCombine(retval, m_aggressive);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Aggressive");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_aggressive);
 
     TraceLogger(conditions) << "GetCheckSum(Aggressive): retval: " << retval;
     return retval;
@@ -8976,6 +11323,12 @@ FleetSupplyableByEmpire::FleetSupplyableByEmpire(std::unique_ptr<ValueRef::Value
     m_root_candidate_invariant = !m_empire_id || m_empire_id->RootCandidateInvariant();
     m_target_invariant = !m_empire_id || m_empire_id->TargetInvariant();
     m_source_invariant = !m_empire_id || m_empire_id->SourceInvariant();
+    if (m_empire_id && m_empire_id->ConstantExpr()) {
+        // constant-fold the empire id once here, so evaluation reads a
+        // stored int instead of making a virtual ValueRef call
+        m_cached_empire_id = m_empire_id->Eval();
+        m_empire_id_constant = true;
+    }
 }
 
 bool FleetSupplyableByEmpire::operator==(const Condition& rhs) const {
@@ -8993,24 +11346,22 @@ bool FleetSupplyableByEmpire::operator==(const Condition& rhs) const {
 
 namespace {
     struct FleetSupplyableSimpleMatch {
-        FleetSupplyableSimpleMatch(int empire_id, const SupplyManager& supply) :
-            m_empire_id(empire_id),
-            m_supply(supply)
-        {}
+        FleetSupplyableSimpleMatch(int empire_id, const SupplyManager& supply) {
+            // resolve the empire's supplyable system set once, rather than
+            // looking it up per candidate
+            const auto& empire_supplyable_systems = supply.FleetSupplyableSystemIDs();
+            auto it = empire_supplyable_systems.find(empire_id);
+            if (it != empire_supplyable_systems.end())
+                m_supplyable_systems = &it->second;
+        }
 
         bool operator()(const UniverseObject* candidate) const {
-            if (!candidate)
+            if (CONDITION_UNLIKELY(!candidate) || !m_supplyable_systems)
                 return false;
-
-            const auto& empire_supplyable_systems = m_supply.FleetSupplyableSystemIDs();
-            auto it = empire_supplyable_systems.find(m_empire_id);
-            if (it == empire_supplyable_systems.end())
-                return false;
-            return it->second.count(candidate->SystemID());
+            return m_supplyable_systems->count(candidate->SystemID());
         }
 
-        int m_empire_id;
-        const SupplyManager& m_supply;
+        const std::set<int>* m_supplyable_systems = nullptr;
     };
 }
 
@@ -9023,7 +11374,7 @@ void FleetSupplyableByEmpire::Eval(const ScriptingContext& parent_context,
                             (parent_context.condition_root_candidate || RootCandidateInvariant()));
     if (simple_eval_safe) {
         // evaluate empire id once, and use to check all candidate objects
-        int empire_id = m_empire_id->Eval(parent_context);
+        int empire_id = m_empire_id_constant ? m_cached_empire_id : m_empire_id->Eval(parent_context);
         EvalImpl(matches, non_matches, search_domain,
                  FleetSupplyableSimpleMatch(empire_id, parent_context.supply));
     } else {
@@ -9034,15 +11385,18 @@ void FleetSupplyableByEmpire::Eval(const ScriptingContext& parent_context,
 
 std::string FleetSupplyableByEmpire::Description(bool negated) const {
     std::string empire_str;
-    if (m_empire_id) {
-        int empire_id = ALL_EMPIRES;
-        if (m_empire_id->ConstantExpr())
-            empire_id = m_empire_id->Eval();
-        ScriptingContext context;
-        if (auto empire = context.GetEmpire(empire_id))
-            empire_str = empire->Name();
-        else
+    if (m_empire_id) {
+        // only a constant expression names a specific empire; otherwise skip
+        // constructing a ScriptingContext just to fail the empire lookup
+        if (m_empire_id_constant && m_cached_empire_id != ALL_EMPIRES) {
+            ScriptingContext context;
+            if (auto empire = context.GetEmpire(m_cached_empire_id))
+                empire_str = empire->Name();
+            else
+                empire_str = m_empire_id->Description();
+        } else {
             empire_str = m_empire_id->Description();
+        }
     }
 
     return str(FlexibleFormat((!negated)
@@ -9051,31 +11405,37 @@ std::string FleetSupplyableByEmpire::Description(bool negated) const {
                % empire_str);
 }
 
-std::string FleetSupplyableByEmpire::Dump(unsigned short ntabs) const
-{ return DumpIndent(ntabs) + "ResupplyableBy empire_id = " + m_empire_id->Dump(ntabs); }
+std::string FleetSupplyableByEmpire::Dump(unsigned short ntabs) const {
+    std::string empire_dump = m_empire_id->Dump(ntabs);
+    std::string retval;
+    retval.reserve(ntabs * 4 + 30 + empire_dump.size());
+    retval += DumpIndent(ntabs);
+    retval += "ResupplyableBy empire_id = ";
+    retval += empire_dump;
+    return retval;
+}
 
 bool FleetSupplyableByEmpire::Match(const ScriptingContext& local_context) const {
     const auto* candidate = local_context.condition_local_candidate;
-    if (!candidate) {
+    if (CONDITION_UNLIKELY(!candidate)) {
         ErrorLogger(conditions) << "FleetSupplyableByEmpire::Match passed no candidate object";
         return false;
     }
 
-    int empire_id = m_empire_id->Eval(local_context);
+    int empire_id = m_empire_id_constant ? m_cached_empire_id : m_empire_id->Eval(local_context);
 
     return FleetSupplyableSimpleMatch(empire_id, local_context.supply)(candidate);
 }
 
 void FleetSupplyableByEmpire::SetTopLevelContent(const std::string& content_name) {
-    if (m_empire_id)
-        m_empire_id->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_empire_id);
 }
 
 unsigned int FleetSupplyableByEmpire::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::FleetSupplyableByEmpire");
-    CheckSums::CheckSumCombine(retval, m_empire_id);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::FleetSupplyableByEmpire");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_empire_id);
 
     TraceLogger(conditions) << "GetCheckSum(FleetSupplyableByEmpire): retval: " << retval;
     return retval;
@@ -9102,6 +11462,12 @@ ResourceSupplyConnectedByEmpire::ResourceSupplyConnectedByEmpire(
     m_source_invariant =
         (!m_empire_id || m_empire_id->SourceInvariant()) &&
         (!m_condition || m_condition->SourceInvariant());
+    if (m_empire_id && m_empire_id->ConstantExpr()) {
+        // constant-fold the empire id once here, so evaluation reads a
+        // stored int instead of making a virtual ValueRef call
+        m_cached_empire_id = m_empire_id->Eval();
+        m_empire_id_constant = true;
+    }
 }
 
 bool ResourceSupplyConnectedByEmpire::operator==(const Condition& rhs) const {
@@ -9121,76 +11487,92 @@ namespace {
     struct ResourceSupplySimpleMatch {
         ResourceSupplySimpleMatch(int empire_id, const ObjectSet& from_objects,
                                   const ObjectMap& objects, const SupplyManager& supply) :
-            m_empire_id(empire_id),
-            m_from_objects(from_objects),
-            m_objects(objects),
-            m_supply(supply)
-        {}
+            m_objects(objects)
+        {
+            // each system belongs to at most one of the empire's resource
+            // supply groups, so flatten the groups into one sorted
+            // system-to-group table probed per object, instead of scanning
+            // every group per object
+            const auto& groups = supply.ResourceSupplyGroups(empire_id);
+            std::size_t total_systems = 0;
+            for (const auto& group : groups)
+                total_systems += group.size();
+            m_group_idx_by_sys.reserve(total_systems);
+            uint32_t group_idx = 0;
+            for (const auto& group : groups) {
+                for (int sys_id : group)
+                    m_group_idx_by_sys.emplace_back(sys_id, group_idx);
+                ++group_idx;
+            }
+            std::sort(m_group_idx_by_sys.begin(), m_group_idx_by_sys.end());
+
+            // precompute the from-objects' planets (for the isolated path)
+            // and supply groups (for the connected path) once, instead of
+            // resolving them again for every candidate
+            m_from_planet_ids.reserve(from_objects.size());
+            m_from_group_idxs.reserve(from_objects.size());
+            for (const auto* from_object : from_objects) {
+                if (!from_object)
+                    continue;
+                if (const auto* planet = PlanetOf(from_object))
+                    m_from_planet_ids.push_back(planet->ID());
+                const uint32_t group_idx = GroupIdxOf(from_object->SystemID());
+                if (group_idx != NO_GROUP)
+                    m_from_group_idxs.push_back(group_idx);
+            }
+            std::sort(m_from_planet_ids.begin(), m_from_planet_ids.end());
+            std::sort(m_from_group_idxs.begin(), m_from_group_idxs.end());
+        }
 
         bool operator()(const UniverseObject* candidate) const {
-            if (!candidate)
+            if (CONDITION_UNLIKELY(!candidate))
                 return false;
-            if (m_from_objects.empty())
-                return false;
-            const auto& groups = m_supply.ResourceSupplyGroups(m_empire_id);
-            if (groups.empty())
+            if (m_group_idx_by_sys.empty())
                 return false;
 
             // is candidate object connected to a subcondition matching object by resource supply?
             // first check if candidate object is (or is a building on) a blockaded planet
             // "isolated" objects are anything not in a non-blockaded system
-            bool is_isolated = true;
-            for (const auto& group : groups) {
-                if (group.count(candidate->SystemID())) {
-                    is_isolated = false;
-                    break;
-                }
-            }
-            if (is_isolated) {
-                // planets are still supply-connected to themselves even if blockaded
-                auto candidate_planet = dynamic_cast<const Planet*>(candidate);
-                const ::Building* building = nullptr;
-                if (!candidate_planet && (building = dynamic_cast<const ::Building*>(candidate)))
-                    candidate_planet = m_objects.getRaw<Planet>(building->PlanetID());
-                if (candidate_planet) {
-                    int candidate_planet_id = candidate_planet->ID();
-                    // can only match if the from_object is (or is on) the same planet
-                    for (auto& from_object : m_from_objects) {
-                        auto from_obj_planet = dynamic_cast<const Planet*>(from_object);
-                        const ::Building* from_building = nullptr;
-                        if (!from_obj_planet && (from_building = dynamic_cast<const ::Building*>(from_object)))
-                            from_obj_planet = m_objects.getRaw<Planet>(from_building->PlanetID());
-                        if (from_obj_planet && from_obj_planet->ID() == candidate_planet_id)
-                            return true;
-                    }
-                }
-                // candidate is isolated, but did not match planet for any test object
-                return false;
-            }
-            // candidate is not blockaded, so check for system group matches
-            for (auto* from_object : m_from_objects) {
-                for (const auto& group : groups) {
-                    if (group.count(from_object->SystemID())) {
-                        // found resource sharing group containing test object system.  Does it also contain candidate?
-                        if (group.count(candidate->SystemID()))
-                            return true;    // test object and candidate object are in same resourse sharing group
-                        else
-                            // test object is not in resource sharing group with candidate
-                            // as each object can be in only one group, no need to check the remaining groups
-                            break;
-                    }
-                    // current subcondition-matching object is not in this resource sharing group
-                }
-                // current subcondition-matching object is not in any resource sharing group for this empire
+            const uint32_t candidate_group = GroupIdxOf(candidate->SystemID());
+            if (candidate_group == NO_GROUP) {
+                // planets are still supply-connected to themselves even if
+                // blockaded: can only match if a from-object is (or is on)
+                // the candidate planet
+                const auto* candidate_planet = PlanetOf(candidate);
+                return candidate_planet &&
+                       std::binary_search(m_from_planet_ids.begin(), m_from_planet_ids.end(),
+                                          candidate_planet->ID());
             }
+            // candidate is not blockaded, so check if any subcondition-matching
+            // object is in the same resource sharing group
+            return std::binary_search(m_from_group_idxs.begin(), m_from_group_idxs.end(),
+                                      candidate_group);
+        }
+
+        // the planet an object is, or is a building on, if either
+        const Planet* PlanetOf(const UniverseObject* obj) const {
+            if (obj->ObjectType() == UniverseObjectType::OBJ_PLANET)
+                return static_cast<const Planet*>(obj);
+            if (obj->ObjectType() == UniverseObjectType::OBJ_BUILDING)
+                return m_objects.getRaw<Planet>(static_cast<const ::Building*>(obj)->PlanetID());
+            return nullptr;
+        }
 
-            return false;
+        static constexpr uint32_t NO_GROUP = std::numeric_limits<uint32_t>::max();
+
+        // the group table position of a system's supply group, or NO_GROUP
+        uint32_t GroupIdxOf(int sys_id) const {
+            const auto it = std::lower_bound(
+                m_group_idx_by_sys.begin(), m_group_idx_by_sys.end(), sys_id,
+                [](const auto& entry, int id) { return entry.first < id; });
+            return (it != m_group_idx_by_sys.end() && it->first == sys_id) ?
+                it->second : NO_GROUP;
         }
 
-        int m_empire_id;
-        const ObjectSet& m_from_objects;
         const ObjectMap& m_objects;
-        const SupplyManager& m_supply;
+        std::vector<std::pair<int, uint32_t>> m_group_idx_by_sys;   // sorted system id -> supply group
+        std::vector<int> m_from_planet_ids;         // sorted planets the from-objects are or are on
+        std::vector<uint32_t> m_from_group_idxs;    // sorted supply groups the from-objects are in
     };
 }
 
@@ -9204,45 +11586,83 @@ void ResourceSupplyConnectedByEmpire::Eval(const ScriptingContext& parent_contex
     if (simple_eval_safe) {
         // evaluate contained objects once and check for all candidates
 
-        // get objects to be considering for matching against subcondition
-        ObjectSet subcondition_matches = m_condition->Eval(parent_context);
-        int empire_id = m_empire_id->Eval(parent_context);
+        // get objects to be considering for matching against subcondition,
+        // into a reused buffer; the matcher copies what it needs out of them
+        // during construction
+        static thread_local ObjectSet subcondition_matches_buf;
+        ObjectSet subcondition_matches{std::move(subcondition_matches_buf)};
+        m_condition->Eval(parent_context, subcondition_matches);
+        int empire_id = m_empire_id_constant ? m_cached_empire_id : m_empire_id->Eval(parent_context);
 
         EvalImpl(matches, non_matches, search_domain,
                  ResourceSupplySimpleMatch(empire_id, subcondition_matches, parent_context.ContextObjects(),
                                            parent_context.supply));
+        subcondition_matches_buf = std::move(subcondition_matches);     // keep the capacity for the next pass
+    } else if (parent_context.condition_root_candidate || m_condition->RootCandidateInvariant()) {
+        // the empire id varies with the local candidate, but the
+        // subcondition's matches do not (the root candidate is fixed for
+        // this pass), so evaluate them once here rather than once per
+        // candidate in Match; only the empire id is re-evaluated per
+        // candidate, reusing the previous candidate's matcher when the id
+        // repeats
+        static thread_local ObjectSet subcondition_matches_buf;
+        ObjectSet subcondition_matches{std::move(subcondition_matches_buf)};
+        m_condition->Eval(parent_context, subcondition_matches);
+
+        std::optional<std::pair<int, ResourceSupplySimpleMatch>> memo;
+        EvalImpl(matches, non_matches, search_domain,
+                 [&, this](const UniverseObject* candidate) {
+                     const ScriptingContext local_context{parent_context, candidate};
+                     const int empire_id = m_empire_id->Eval(local_context);
+                     if (!memo || memo->first != empire_id)
+                         memo.emplace(std::piecewise_construct,
+                                      std::forward_as_tuple(empire_id),
+                                      std::forward_as_tuple(empire_id, subcondition_matches,
+                                                            parent_context.ContextObjects(),
+                                                            parent_context.supply));
+                     return memo->second(candidate);
+                 });
+        subcondition_matches_buf = std::move(subcondition_matches);     // keep the capacity for the next pass
     } else {
-        // re-evaluate empire id for each candidate object
+        // re-evaluate empire id and subcondition for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
     }
 }
 
 bool ResourceSupplyConnectedByEmpire::Match(const ScriptingContext& local_context) const {
     const auto* candidate = local_context.condition_local_candidate;
-    if (!candidate) {
+    if (CONDITION_UNLIKELY(!candidate)) {
         ErrorLogger(conditions) << "ResourceSupplyConnectedByEmpire::Match passed no candidate object";
         return false;
     }
 
-    // get subcondition matches
-    ObjectSet subcondition_matches = m_condition->Eval(local_context);
-    int empire_id = m_empire_id->Eval(local_context);
+    // get subcondition matches, into a reused buffer as in Contains::Match
+    static thread_local ObjectSet subcondition_matches_buf;
+    ObjectSet subcondition_matches{std::move(subcondition_matches_buf)};
+    m_condition->Eval(local_context, subcondition_matches);
+    int empire_id = m_empire_id_constant ? m_cached_empire_id : m_empire_id->Eval(local_context);
 
-    return ResourceSupplySimpleMatch(empire_id, subcondition_matches, local_context.ContextObjects(),
-                                     local_context.supply)(candidate);
+    bool retval = ResourceSupplySimpleMatch(empire_id, subcondition_matches, local_context.ContextObjects(),
+                                            local_context.supply)(candidate);
+
+    subcondition_matches_buf = std::move(subcondition_matches);     // keep the capacity for the next call
+    return retval;
 }
 
 std::string ResourceSupplyConnectedByEmpire::Description(bool negated) const {
     std::string empire_str;
     if (m_empire_id) {
-        int empire_id = ALL_EMPIRES;
-        if (m_empire_id->ConstantExpr())
-            empire_id = m_empire_id->Eval();
-        ScriptingContext context;
-        if (auto empire = context.GetEmpire(empire_id))
-            empire_str = empire->Name();
-        else
+        // only a constant expression names a specific empire; otherwise skip
+        // constructing a ScriptingContext just to fail the empire lookup
+        if (m_empire_id_constant && m_cached_empire_id != ALL_EMPIRES) {
+            ScriptingContext context;
+            if (auto empire = context.GetEmpire(m_cached_empire_id))
+                empire_str = empire->Name();
+            else
+                empire_str = m_empire_id->Description();
+        } else {
             empire_str = m_empire_id->Description();
+        }
     }
 
     return str(FlexibleFormat((!negated)
@@ -9253,25 +11673,27 @@ std::string ResourceSupplyConnectedByEmpire::Description(bool negated) const {
 }
 
 std::string ResourceSupplyConnectedByEmpire::Dump(unsigned short ntabs) const {
-    std::string retval = DumpIndent(ntabs) + "ResourceSupplyConnectedBy empire_id = "
-        + m_empire_id->Dump(ntabs) + " condition = \n";
-    retval += m_condition->Dump(ntabs+1);
+    std::string empire_dump = m_empire_id->Dump(ntabs);
+    std::string condition_dump = m_condition->Dump(ntabs+1);
+    std::string retval;
+    retval.reserve(ntabs * 4 + 55 + empire_dump.size() + condition_dump.size());
+    retval += DumpIndent(ntabs);
+    retval += "ResourceSupplyConnectedBy empire_id = ";
+    retval += empire_dump;
+    retval += " condition = \n";
+    retval += condition_dump;
     return retval;
 }
 
 void ResourceSupplyConnectedByEmpire::SetTopLevelContent(const std::string& content_name) {
-    if (m_empire_id)
-        m_empire_id->SetTopLevelContent(content_name);
-    if (m_condition)
-        m_condition->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_empire_id, m_condition);
 }
 
 unsigned int ResourceSupplyConnectedByEmpire::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::ResourceSupplyConnectedByEmpire");
-    CheckSums::CheckSumCombine(retval, m_empire_id);
-    CheckSums::CheckSumCombine(retval, m_condition);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::ResourceSupplyConnectedByEmpire");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_empire_id, m_condition);
 
     TraceLogger(conditions) << "GetCheckSum(ResourceSupplyConnectedByEmpire): retval: " << retval;
     return retval;
@@ -9303,50 +11725,86 @@ std::string CanColonize::Description(bool negated) const {
 std::string CanColonize::Dump(unsigned short ntabs) const
 { return DumpIndent(ntabs) + "CanColonize\n"; }
 
-bool CanColonize::Match(const ScriptingContext& local_context) const {
-    auto candidate = local_context.condition_local_candidate;
-    if (!candidate) {
-        ErrorLogger(conditions) << "CanColonize::Match passed no candidate object";
-        return false;
-    }
+namespace {
+    // resolves the species of a ship, a planet, or a building's planet,
+    // without copying the name; returns nullptr when the candidate is of
+    // another type or has no resolvable species
+    const std::string* CandidateSpeciesName(const UniverseObject* candidate,
+                                            const ObjectMap& objects,
+                                            const char* caller)
+    {
+        if (candidate->ObjectType() == UniverseObjectType::OBJ_PLANET) {
+            return &static_cast<const Planet*>(candidate)->SpeciesName();
 
-    // is it a ship, a planet, or a building on a planet?
-    std::string species_name;
-    if (candidate->ObjectType() == UniverseObjectType::OBJ_PLANET) {
-        auto planet = dynamic_cast<const Planet*>(candidate);
-        if (!planet) {
-            ErrorLogger(conditions) << "CanColonize couldn't cast supposedly planet candidate";
-            return false;
-        }
-        species_name = planet->SpeciesName();
+        } else if (candidate->ObjectType() == UniverseObjectType::OBJ_BUILDING) {
+            auto building = static_cast<const ::Building*>(candidate);
+            if (const auto* planet = objects.getRaw<Planet>(building->PlanetID()))
+                return &planet->SpeciesName();
+            ErrorLogger(conditions) << caller << " couldn't get building's planet";
 
-    } else if (candidate->ObjectType() == UniverseObjectType::OBJ_BUILDING) {
-        auto building = dynamic_cast<const ::Building*>(candidate);
-        if (!building) {
-            ErrorLogger(conditions) << "CanColonize couldn't cast supposedly building candidate";
-            return false;
+        } else if (candidate->ObjectType() == UniverseObjectType::OBJ_SHIP) {
+            return &static_cast<const Ship*>(candidate)->SpeciesName();
         }
-        auto planet = local_context.ContextObjects().get<Planet>(building->PlanetID());
-        if (!planet) {
-            ErrorLogger(conditions) << "CanColonize couldn't get building's planet";
-            return false;
+        return nullptr;
+    }
+
+    // shared by CanColonize and CanProduceShips: collects the names of the
+    // species with the wanted flag once per pass, so each candidate costs a
+    // binary search over those names instead of a species-registry lookup
+    struct SpeciesFlagSimpleMatch {
+        SpeciesFlagSimpleMatch(const ObjectMap& objects, const SpeciesManager& species_manager,
+                               bool (::Species::*flag)() const, const char* caller) :
+            m_objects(objects),
+            m_caller(caller)
+        {
+            // the registry map iterates in name order, so the collected
+            // names are already sorted for binary searching
+            for (const auto& [name, species] : species_manager) {
+                if (species && ((*species).*flag)())
+                    m_flagged_species.push_back(name);
+            }
         }
-        species_name = planet->SpeciesName();
 
-    } else if (candidate->ObjectType() == UniverseObjectType::OBJ_SHIP) {
-        auto ship = dynamic_cast<const Ship*>(candidate);
-        if (!ship) {
-            ErrorLogger(conditions) << "CanColonize couldn't cast supposedly ship candidate";
-            return false;
+        bool operator()(const UniverseObject* candidate) const {
+            if (CONDITION_UNLIKELY(!candidate))
+                return false;
+            const std::string* species_name = CandidateSpeciesName(candidate, m_objects, m_caller);
+            if (!species_name || species_name->empty())
+                return false;
+            return std::binary_search(m_flagged_species.begin(), m_flagged_species.end(),
+                                      std::string_view{*species_name});
         }
-        species_name = ship->SpeciesName();
+
+        const ObjectMap& m_objects;
+        const char* m_caller;
+        boost::container::small_vector<std::string_view, 32> m_flagged_species;
+    };
+}
+
+void CanColonize::Eval(const ScriptingContext& parent_context,
+                       ObjectSet& matches, ObjectSet& non_matches,
+                       SearchDomain search_domain) const
+{
+    EvalImpl(matches, non_matches, search_domain,
+             SpeciesFlagSimpleMatch(parent_context.ContextObjects(), parent_context.species,
+                                    &::Species::CanColonize, "CanColonize"));
+}
+
+bool CanColonize::Match(const ScriptingContext& local_context) const {
+    auto candidate = local_context.condition_local_candidate;
+    if (CONDITION_UNLIKELY(!candidate)) {
+        ErrorLogger(conditions) << "CanColonize::Match passed no candidate object";
+        return false;
     }
 
-    if (species_name.empty())
+    // is it a ship, a planet, or a building on a planet?
+    const std::string* species_name =
+        CandidateSpeciesName(candidate, local_context.ContextObjects(), "CanColonize");
+    if (!species_name || species_name->empty())
         return false;
-    auto species = GetSpecies(species_name);
+    auto species = GetSpecies(*species_name);
     if (!species) {
-        ErrorLogger(conditions) << "CanColonize couldn't get species: " << species_name;
+        ErrorLogger(conditions) << "CanColonize couldn't get species: " << *species_name;
         return false;
     }
     return species->CanColonize();
@@ -9355,7 +11813,8 @@ bool CanColonize::Match(const ScriptingContext& local_context) const {
 unsigned int CanColonize::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::CanColonize");
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::CanColonize");
+    CheckSums::CheckSumCombine(retval, tag_checksum);
 
     TraceLogger(conditions) << "GetCheckSum(CanColonize): retval: " << retval;
     return retval;
@@ -9385,50 +11844,30 @@ std::string CanProduceShips::Description(bool negated) const {
 std::string CanProduceShips::Dump(unsigned short ntabs) const
 { return DumpIndent(ntabs) + "CanColonize\n"; }
 
+void CanProduceShips::Eval(const ScriptingContext& parent_context,
+                           ObjectSet& matches, ObjectSet& non_matches,
+                           SearchDomain search_domain) const
+{
+    EvalImpl(matches, non_matches, search_domain,
+             SpeciesFlagSimpleMatch(parent_context.ContextObjects(), parent_context.species,
+                                    &::Species::CanProduceShips, "CanProduceShips"));
+}
+
 bool CanProduceShips::Match(const ScriptingContext& local_context) const {
     const auto* candidate = local_context.condition_local_candidate;
-    if (!candidate) {
+    if (CONDITION_UNLIKELY(!candidate)) {
         ErrorLogger(conditions) << "CanProduceShips::Match passed no candidate object";
         return false;
     }
 
     // is it a ship, a planet, or a building on a planet?
-    std::string species_name;
-    if (candidate->ObjectType() == UniverseObjectType::OBJ_PLANET) {
-        auto planet = static_cast<const Planet*>(candidate);
-        if (!planet) {
-            ErrorLogger(conditions) << "CanProduceShips couldn't cast supposedly planet candidate";
-            return false;
-        }
-        species_name = planet->SpeciesName();
-
-    } else if (candidate->ObjectType() == UniverseObjectType::OBJ_BUILDING) {
-        auto building = static_cast<const ::Building*>(candidate);
-        if (!building) {
-            ErrorLogger(conditions) << "CanProduceShips couldn't cast supposedly building candidate";
-            return false;
-        }
-        auto planet = local_context.ContextObjects().get<Planet>(building->PlanetID());
-        if (!planet) {
-            ErrorLogger(conditions) << "CanProduceShips couldn't get building's planet";
-            return false;
-        }
-        species_name = planet->SpeciesName();
-
-    } else if (candidate->ObjectType() == UniverseObjectType::OBJ_SHIP) {
-        auto ship = static_cast<const Ship*>(candidate);
-        if (!ship) {
-            ErrorLogger(conditions) << "CanProduceShips couldn't cast supposedly ship candidate";
-            return false;
-        }
-        species_name = ship->SpeciesName();
-    }
-
-    if (species_name.empty())
+    const std::string* species_name =
+        CandidateSpeciesName(candidate, local_context.ContextObjects(), "CanProduceShips");
+    if (!species_name || species_name->empty())
         return false;
-    auto species = GetSpecies(species_name);
+    auto species = GetSpecies(*species_name);
     if (!species) {
-        ErrorLogger(conditions) << "CanProduceShips couldn't get species: " << species_name;
+        ErrorLogger(conditions) << "CanProduceShips couldn't get species: " << *species_name;
         return false;
     }
     return species->CanProduceShips();
@@ -9437,7 +11876,8 @@ bool CanProduceShips::Match(const ScriptingContext& local_context) const {
 unsigned int CanProduceShips::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::CanProduceShips");
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::CanProduceShips");
+    CheckSums::CheckSumCombine(retval, tag_checksum);
 
     TraceLogger(conditions) << "GetCheckSum(CanProduceShips): retval: " << retval;
     return retval;
@@ -9472,34 +11912,32 @@ bool OrderedBombarded::operator==(const Condition& rhs) const {
 
 namespace {
     struct OrderedBombardedSimpleMatch {
-        OrderedBombardedSimpleMatch(const ObjectSet& by_objects) :
-            m_by_objects(by_objects)
-        {}
+        OrderedBombardedSimpleMatch(const ObjectSet& by_objects) {
+            // only ships can be ordered to bombard, so resolve the bombarded
+            // planet ids of the subcondition's ships once rather than
+            // dereferencing ship pointers per candidate
+            for (const auto* obj : by_objects)
+                if (obj && obj->ObjectType() == UniverseObjectType::OBJ_SHIP)
+                    m_bombarded_planet_ids.push_back(static_cast<uint32_t>(
+                        static_cast<const Ship*>(obj)->OrderedBombardPlanet()));
+        }
 
         bool operator()(const UniverseObject* candidate) const {
-            if (!candidate)
+            if (CONDITION_UNLIKELY(!candidate) || m_bombarded_planet_ids.empty())
                 return false;
-            if (m_by_objects.empty())
-                return false;
-            auto planet = dynamic_cast<const Planet*>(candidate);
-            if (!planet)
+            if (candidate->ObjectType() != UniverseObjectType::OBJ_PLANET)
                 return false;
-            int planet_id = planet->ID();
+            int planet_id = candidate->ID();
             if (planet_id == INVALID_OBJECT_ID)
                 return false;
 
-            // check if any of the by_objects is ordered to bombard the candidate planet
-            for (auto* obj : m_by_objects) {
-                auto ship = dynamic_cast<const Ship*>(obj);
-                if (!ship)
-                    continue;
-                if (ship->OrderedBombardPlanet() == planet_id)
-                    return true;
-            }
-            return false;
+            // check if any of the by_objects is ordered to bombard the
+            // candidate planet
+            return ContainsU32(m_bombarded_planet_ids.data(), m_bombarded_planet_ids.size(),
+                               static_cast<uint32_t>(planet_id));
         }
 
-        const ObjectSet& m_by_objects;
+        boost::container::small_vector<uint32_t, 16> m_bombarded_planet_ids;
     };
 }
 
@@ -9511,10 +11949,14 @@ void OrderedBombarded::Eval(const ScriptingContext& parent_context,
     if (simple_eval_safe) {
         // evaluate contained objects once and check for all candidates
 
-        // get subcondition matches
-        ObjectSet subcondition_matches = m_by_object_condition->Eval(parent_context);
+        // get subcondition matches, into a reused buffer; the matcher copies
+        // what it needs out of them during construction
+        static thread_local ObjectSet subcondition_matches_buf;
+        ObjectSet subcondition_matches{std::move(subcondition_matches_buf)};
+        m_by_object_condition->Eval(parent_context, subcondition_matches);
 
         EvalImpl(matches, non_matches, search_domain, OrderedBombardedSimpleMatch(subcondition_matches));
+        subcondition_matches_buf = std::move(subcondition_matches);     // keep the capacity for the next pass
     } else {
         // re-evaluate contained objects for each candidate object
         Condition::Eval(parent_context, matches, non_matches, search_domain);
@@ -9532,32 +11974,43 @@ std::string OrderedBombarded::Description(bool negated) const {
                % by_str);
 }
 
-std::string OrderedBombarded::Dump(unsigned short ntabs) const
-{ return DumpIndent(ntabs) + "OrderedBombarded object = " + m_by_object_condition->Dump(ntabs); }
+std::string OrderedBombarded::Dump(unsigned short ntabs) const {
+    std::string by_dump = m_by_object_condition->Dump(ntabs);
+    std::string retval;
+    retval.reserve(ntabs * 4 + 30 + by_dump.size());
+    retval += DumpIndent(ntabs);
+    retval += "OrderedBombarded object = ";
+    retval += by_dump;
+    return retval;
+}
 
 bool OrderedBombarded::Match(const ScriptingContext& local_context) const {
     const auto* candidate = local_context.condition_local_candidate;
-    if (!candidate) {
+    if (CONDITION_UNLIKELY(!candidate)) {
         ErrorLogger(conditions) << "OrderedBombarded::Match passed no candidate object";
         return false;
     }
 
-    // get subcondition matches
-    ObjectSet subcondition_matches = m_by_object_condition->Eval(local_context);
+    // get subcondition matches, into a reused buffer as in Contains::Match
+    static thread_local ObjectSet subcondition_matches_buf;
+    ObjectSet subcondition_matches{std::move(subcondition_matches_buf)};
+    m_by_object_condition->Eval(local_context, subcondition_matches);
+
+    bool retval = OrderedBombardedSimpleMatch(subcondition_matches)(candidate);
 
-    return OrderedBombardedSimpleMatch(subcondition_matches)(candidate);
+    subcondition_matches_buf = std::move(subcondition_matches);     // keep the capacity for the next call
+    return retval;
 }
 
 void OrderedBombarded::SetTopLevelContent(const std::string& content_name) {
-    if (m_by_object_condition)
-        m_by_object_condition->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_by_object_condition);
 }
 
 unsigned int OrderedBombarded::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::OrderedBombarded");
-    CheckSums::CheckSumCombine(retval, m_by_object_condition);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::OrderedBombarded");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_by_object_condition);
 
     TraceLogger(conditions) << "GetCheckSum(OrderedBombarded): retval: " << retval;
     return retval;
@@ -9617,12 +12070,14 @@ ValueTest::ValueTest(std::unique_ptr<ValueRef::ValueRef<double>>&& value_ref1,
     m_value_ref2(std::move(value_ref2)),
     m_value_ref3(std::move(value_ref3)),
     m_compare_type1(comp1),
-    m_compare_type2(comp2)
+    m_compare_type2(comp2),
+    m_ref_kind(ValueKind::DOUBLE)
 {
     auto operands = {m_value_ref1.get(), m_value_ref2.get(), m_value_ref3.get()};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
 }
 
 ValueTest::ValueTest(std::unique_ptr<ValueRef::ValueRef<std::string>>&& value_ref1,
@@ -9634,12 +12089,14 @@ ValueTest::ValueTest(std::unique_ptr<ValueRef::ValueRef<std::string>>&& value_re
     m_string_value_ref2(std::move(value_ref2)),
     m_string_value_ref3(std::move(value_ref3)),
     m_compare_type1(comp1),
-    m_compare_type2(comp2)
+    m_compare_type2(comp2),
+    m_ref_kind(ValueKind::STRING)
 {
     auto operands = {m_string_value_ref1.get(), m_string_value_ref2.get(), m_string_value_ref3.get()};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
 }
 
 ValueTest::ValueTest(std::unique_ptr<ValueRef::ValueRef<int>>&& value_ref1,
@@ -9651,12 +12108,14 @@ ValueTest::ValueTest(std::unique_ptr<ValueRef::ValueRef<int>>&& value_ref1,
     m_int_value_ref2(std::move(value_ref2)),
     m_int_value_ref3(std::move(value_ref3)),
     m_compare_type1(comp1),
-    m_compare_type2(comp2)
+    m_compare_type2(comp2),
+    m_ref_kind(ValueKind::INT)
 {
     auto operands = {m_int_value_ref1.get(), m_int_value_ref2.get(), m_int_value_ref3.get()};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
 }
 
 ValueTest::ValueTest(const ValueTest& rhs) :
@@ -9671,7 +12130,8 @@ ValueTest::ValueTest(const ValueTest& rhs) :
     m_int_value_ref2(ValueRef::CloneUnique(rhs.m_int_value_ref2)),
     m_int_value_ref3(ValueRef::CloneUnique(rhs.m_int_value_ref3)),
     m_compare_type1(rhs.m_compare_type1),
-    m_compare_type2(rhs.m_compare_type2)
+    m_compare_type2(rhs.m_compare_type2),
+    m_ref_kind(rhs.m_ref_kind)
 {}
 
 bool ValueTest::operator==(const Condition& rhs) const {
@@ -9731,45 +12191,82 @@ void ValueTest::Eval(const ScriptingContext& parent_context,
         // transfer objects to or from candidate set, according to whether the value comparisons were true
         if (search_domain == SearchDomain::MATCHES && !match) {
             // move all objects from matches to non_matches
-            non_matches.insert(non_matches.end(), matches.begin(), matches.end());
-            matches.clear();
+            MoveAll(matches, non_matches);
         } else if (search_domain == SearchDomain::NON_MATCHES && match) {
             // move all objects from non_matches to matches
-            matches.insert(matches.end(), non_matches.begin(), non_matches.end());
-            non_matches.clear();
+            MoveAll(non_matches, matches);
         }
 
     } else {
-        // re-evaluate value and ranges for each candidate object
-        Condition::Eval(parent_context, matches, non_matches, search_domain);
+        // re-evaluate values for each candidate object, but hoist as much as
+        // possible out of the per-candidate loop: the ref-family selection and
+        // comparison-type checks run once, and any operand that does not vary
+        // with the local candidate is evaluated once here rather than per
+        // candidate (e.g. a constant threshold against a per-candidate meter)
+        const auto all_false = [&]() {
+            if (search_domain == SearchDomain::MATCHES)
+                MoveAll(matches, non_matches);
+        };
+
+        const auto eval_compare_refs = [&](const auto& ref1, const auto& ref2, const auto& ref3) {
+            if (!ref1 || !ref2 || m_compare_type1 == ComparisonType::INVALID_COMPARISON)
+                return all_false();
+
+            const auto ref_invariant = [&parent_context](const auto& ref) {
+                return ref->LocalCandidateInvariant() &&
+                       (parent_context.condition_root_candidate || ref->RootCandidateInvariant());
+            };
+            const bool have3 = ref3 && m_compare_type2 != ComparisonType::INVALID_COMPARISON;
+            const bool inv1 = ref_invariant(ref1);
+            const bool inv2 = ref_invariant(ref2);
+            const bool inv3 = have3 && ref_invariant(ref3);
+            auto val1 = inv1 ? ref1->Eval(parent_context) : decltype(ref1->Eval(parent_context)){};
+            auto val2 = inv2 ? ref2->Eval(parent_context) : decltype(val1){};
+            auto val3 = inv3 ? ref3->Eval(parent_context) : decltype(val1){};
+            const auto c12 = m_compare_type1;
+            const auto c23 = m_compare_type2;
+
+            EvalImpl(matches, non_matches, search_domain,
+                     [&](const UniverseObject* candidate) {
+                         const ScriptingContext local_context{parent_context, candidate};
+                         const auto v1 = inv1 ? val1 : ref1->Eval(local_context);
+                         const auto v2 = inv2 ? val2 : ref2->Eval(local_context);
+                         if (!Comparison(v1, c12, v2))
+                             return false;
+                         if (!have3)
+                             return true;
+                         const auto v3 = inv3 ? val3 : ref3->Eval(local_context);
+                         return Comparison(v2, c23, v3);
+                     });
+        };
+
+        switch (m_ref_kind) {
+        case ValueKind::INT:    eval_compare_refs(m_int_value_ref1, m_int_value_ref2, m_int_value_ref3);          break;
+        case ValueKind::DOUBLE: eval_compare_refs(m_value_ref1, m_value_ref2, m_value_ref3);                      break;
+        case ValueKind::STRING: eval_compare_refs(m_string_value_ref1, m_string_value_ref2, m_string_value_ref3); break;
+        }
     }
 }
 
 std::string ValueTest::Description(bool negated) const {
     std::string value_str1, value_str2, value_str3;
-    if (m_value_ref1)
-        value_str1 = m_value_ref1->Description();
-    else if (m_string_value_ref1)
-        value_str1 = m_string_value_ref1->Description();
-    else if (m_int_value_ref1)
-        value_str1 = m_int_value_ref1->Description();
-
-    if (m_value_ref2)
-        value_str2 = m_value_ref2->Description();
-    else if (m_string_value_ref2)
-        value_str2 = m_string_value_ref2->Description();
-    else if (m_int_value_ref2)
-        value_str2 = m_int_value_ref2->Description();
-
-    if (m_value_ref3)
-        value_str3 = m_value_ref3->Description();
-    else if (m_string_value_ref3)
-        value_str3 = m_string_value_ref3->Description();
-    else if (m_int_value_ref3)
-        value_str3 = m_int_value_ref3->Description();
-
-    std::string composed_comparison = value_str1.append(" ").append(CompareTypeString(m_compare_type1))
-                                                .append(" ").append(value_str2);
+    const auto describe_refs = [&](const auto& ref1, const auto& ref2, const auto& ref3) {
+        if (ref1) value_str1 = ref1->Description();
+        if (ref2) value_str2 = ref2->Description();
+        if (ref3) value_str3 = ref3->Description();
+    };
+    switch (m_ref_kind) {
+    case ValueKind::DOUBLE: describe_refs(m_value_ref1, m_value_ref2, m_value_ref3);                      break;
+    case ValueKind::STRING: describe_refs(m_string_value_ref1, m_string_value_ref2, m_string_value_ref3); break;
+    case ValueKind::INT:    describe_refs(m_int_value_ref1, m_int_value_ref2, m_int_value_ref3);          break;
+    }
+
+    std::string composed_comparison;
+    composed_comparison.reserve(value_str1.size() + value_str2.size() + value_str3.size() + 8 +
+                                CompareTypeString(m_compare_type1).size() +
+                                CompareTypeString(m_compare_type2).size());
+    composed_comparison.append(value_str1).append(" ").append(CompareTypeString(m_compare_type1))
+                       .append(" ").append(value_str2);
     if (!value_str3.empty())
         composed_comparison.append(" ").append(CompareTypeString(m_compare_type2))
                            .append(" ").append(value_str3);
@@ -9782,32 +12279,23 @@ std::string ValueTest::Description(bool negated) const {
 
 std::string ValueTest::Dump(unsigned short ntabs) const {
     std::string retval = DumpIndent(ntabs) + "(";
-    if (m_value_ref1)
-        retval += m_value_ref1->Dump(ntabs);
-    else if (m_string_value_ref1)
-        retval += m_string_value_ref1->Dump(ntabs);
-    else if (m_int_value_ref1)
-        retval += m_int_value_ref1->Dump(ntabs);
-
-    if (m_compare_type1 != ComparisonType::INVALID_COMPARISON)
-        retval.append(" ").append(CompareTypeString(m_compare_type1));
-
-    if (m_value_ref2)
-        retval += " " + m_value_ref2->Dump(ntabs);
-    else if (m_string_value_ref2)
-        retval += " " + m_string_value_ref2->Dump(ntabs);
-    else if (m_int_value_ref2)
-        retval += " " + m_int_value_ref2->Dump(ntabs);
-
-    if (m_compare_type2 != ComparisonType::INVALID_COMPARISON)
-        retval.append(" ").append(CompareTypeString(m_compare_type2));
-
-    if (m_value_ref3)
-        retval += " " + m_value_ref3->Dump(ntabs);
-    else if (m_string_value_ref3)
-        retval += " " + m_string_value_ref3->Dump(ntabs);
-    else if (m_int_value_ref3)
-        retval += " " + m_int_value_ref3->Dump(ntabs);
+    const auto dump_refs = [&](const auto& ref1, const auto& ref2, const auto& ref3) {
+        if (ref1)
+            retval += ref1->Dump(ntabs);
+        if (m_compare_type1 != ComparisonType::INVALID_COMPARISON)
+            retval.append(" ").append(CompareTypeString(m_compare_type1));
+        if (ref2)
+            retval.append(" ").append(ref2->Dump(ntabs));
+        if (m_compare_type2 != ComparisonType::INVALID_COMPARISON)
+            retval.append(" ").append(CompareTypeString(m_compare_type2));
+        if (ref3)
+            retval.append(" ").append(ref3->Dump(ntabs));
+    };
+    switch (m_ref_kind) {
+    case ValueKind::DOUBLE: dump_refs(m_value_ref1, m_value_ref2, m_value_ref3);                      break;
+    case ValueKind::STRING: dump_refs(m_string_value_ref1, m_string_value_ref2, m_string_value_ref3); break;
+    case ValueKind::INT:    dump_refs(m_int_value_ref1, m_int_value_ref2, m_int_value_ref3);          break;
+    }
 
     retval += ")\n";
     return retval;
@@ -9835,52 +12323,35 @@ bool ValueTest::Match(const ScriptingContext& local_context) const {
         return Comparison(val2, c23, val3);
     };
 
-    if (m_int_value_ref1)
-        return test_compare_refs(m_int_value_ref1, m_int_value_ref2, m_int_value_ref3);
-    else if (m_value_ref1)
-        return test_compare_refs(m_value_ref1, m_value_ref2, m_value_ref3);
-    else if (m_string_value_ref1)
-        return test_compare_refs(m_string_value_ref1, m_string_value_ref2, m_string_value_ref3);
-    else
-        return false;
+    switch (m_ref_kind) {
+    case ValueKind::INT:    return test_compare_refs(m_int_value_ref1, m_int_value_ref2, m_int_value_ref3);
+    case ValueKind::DOUBLE: return test_compare_refs(m_value_ref1, m_value_ref2, m_value_ref3);
+    case ValueKind::STRING: return test_compare_refs(m_string_value_ref1, m_string_value_ref2, m_string_value_ref3);
+    }
+    return false;
 }
 
 void ValueTest::SetTopLevelContent(const std::string& content_name) {
-    if (m_value_ref1)
-        m_value_ref1->SetTopLevelContent(content_name);
-    if (m_value_ref2)
-        m_value_ref2->SetTopLevelContent(content_name);
-    if (m_value_ref3)
-        m_value_ref3->SetTopLevelContent(content_name);
-    if (m_string_value_ref1)
-        m_string_value_ref1->SetTopLevelContent(content_name);
-    if (m_string_value_ref2)
-        m_string_value_ref2->SetTopLevelContent(content_name);
-    if (m_string_value_ref3)
-        m_string_value_ref3->SetTopLevelContent(content_name);
-    if (m_int_value_ref1)
-        m_int_value_ref1->SetTopLevelContent(content_name);
-    if (m_int_value_ref2)
-        m_int_value_ref2->SetTopLevelContent(content_name);
-    if (m_int_value_ref3)
-        m_int_value_ref3->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_value_ref1, m_value_ref2, m_value_ref3, m_string_value_ref1, m_string_value_ref2, m_string_value_ref3, m_int_value_ref1, m_int_value_ref2, m_int_value_ref3);
+    m_checksum_cached.store(false); // content substitution can change the operands' checksums
 }
 
 unsigned int ValueTest::GetCheckSum() const {
+    // operands only change via SetTopLevelContent, which invalidates the
+    // cache, so the checksum can be memoized
+    if (m_checksum_cached.load())
+        return m_cached_checksum.load();
+
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::ValueTest");
-    CheckSums::CheckSumCombine(retval, m_value_ref1);
-    CheckSums::CheckSumCombine(retval, m_value_ref2);
-    CheckSums::CheckSumCombine(retval, m_value_ref3);
-    CheckSums::CheckSumCombine(retval, m_string_value_ref1);
-    CheckSums::CheckSumCombine(retval, m_string_value_ref2);
-    CheckSums::CheckSumCombine(retval, m_string_value_ref3);
-    CheckSums::CheckSumCombine(retval, m_int_value_ref1);
-    CheckSums::CheckSumCombine(retval, m_int_value_ref2);
-    CheckSums::CheckSumCombine(retval, m_int_value_ref3);
-    CheckSums::CheckSumCombine(retval, m_compare_type1);
-    CheckSums::CheckSumCombine(retval, m_compare_type2);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::ValueTest");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_value_ref1, m_value_ref2, m_value_ref3,
+                               m_string_value_ref1, m_string_value_ref2, m_string_value_ref3,
+                               m_int_value_ref1, m_int_value_ref2, m_int_value_ref3,
+                               m_compare_type1, m_compare_type2);
+
+    m_cached_checksum.store(retval);
+    m_checksum_cached.store(true);
 
     TraceLogger(conditions) << "GetCheckSum(ValueTest): retval: " << retval;
     return retval;
@@ -9965,9 +12436,20 @@ Location::Location(ContentType content_type,
     m_content_type(content_type)
 {
     std::array<const ValueRef::ValueRefBase*, 2> operands = {{m_name1.get(), m_name2.get()}};
-    m_root_candidate_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
+    RefreshConstantNames();
+}
+
+void Location::RefreshConstantNames() {
+    m_names_constant = (!m_name1 || m_name1->ConstantExpr()) &&
+                       (!m_name2 || m_name2->ConstantExpr());
+    if (m_names_constant) {
+        m_const_name1 = m_name1 ? m_name1->Eval() : "";
+        m_const_name2 = m_name2 ? m_name2->Eval() : "";
+    }
 }
 
 bool Location::operator==(const Condition& rhs) const {
@@ -9998,11 +12480,12 @@ void Location::Eval(const ScriptingContext& parent_context,
     if (simple_eval_safe) {
         // evaluate value and range limits once, use to match all candidates
 
-        std::string name1 = (m_name1 ? m_name1->Eval(parent_context) : "");
-        std::string name2 = (m_name2 ? m_name2->Eval(parent_context) : "");
-
         // get condition from content, apply to matches / non_matches
-        const auto condition = GetLocationCondition(m_content_type, name1, name2);
+        const auto condition = m_names_constant ?
+            GetLocationCondition(m_content_type, m_const_name1, m_const_name2) :
+            GetLocationCondition(m_content_type,
+                                 m_name1 ? m_name1->Eval(parent_context) : "",
+                                 m_name2 ? m_name2->Eval(parent_context) : "");
         if (condition && condition != this) {
             condition->Eval(parent_context, matches, non_matches, search_domain);
         } else {
@@ -10011,8 +12494,7 @@ void Location::Eval(const ScriptingContext& parent_context,
             // condition, match nothing
             if (search_domain == SearchDomain::MATCHES) {
                 // move all objects from matches to non_matches
-                non_matches.insert(non_matches.end(), matches.begin(), matches.end());
-                matches.clear();
+                MoveAll(matches, non_matches);
             }
         }
 
@@ -10055,9 +12537,9 @@ std::string Location::Dump(unsigned short ntabs) const {
     }
 
     if (m_name1)
-        retval += " name1 = " + m_name1->Dump(ntabs);
+        retval.append(" name1 = ").append(m_name1->Dump(ntabs));
     if (m_name2)
-        retval += " name2 = " + m_name2->Dump(ntabs);
+        retval.append(" name2 = ").append(m_name2->Dump(ntabs));
     return retval;
 }
 
@@ -10068,10 +12550,11 @@ bool Location::Match(const ScriptingContext& local_context) const {
         return false;
     }
 
-    std::string name1 = (m_name1 ? m_name1->Eval(local_context) : "");
-    std::string name2 = (m_name2 ? m_name2->Eval(local_context) : "");
-
-    const auto condition = GetLocationCondition(m_content_type, name1, name2);
+    const auto condition = m_names_constant ?
+        GetLocationCondition(m_content_type, m_const_name1, m_const_name2) :
+        GetLocationCondition(m_content_type,
+                             m_name1 ? m_name1->Eval(local_context) : "",
+                             m_name2 ? m_name2->Eval(local_context) : "");
     if (!condition || condition == this)
         return false;
 
@@ -10081,19 +12564,26 @@ bool Location::Match(const ScriptingContext& local_context) const {
 }
 
 void Location::SetTopLevelContent(const std::string& content_name) {
-    if (m_name1)
-        m_name1->SetTopLevelContent(content_name);
-    if (m_name2)
-        m_name2->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_name1, m_name2);
+    // substituting the content name can change what CurrentContent constants
+    // evaluate to, so re-fold the names afterwards
+    RefreshConstantNames();
+    m_checksum_cached.store(false); // content substitution can change the operands' checksums
 }
 
 unsigned int Location::GetCheckSum() const {
+    // operands only change via SetTopLevelContent, which invalidates the
+    // cache, so the checksum can be memoized
+    if (m_checksum_cached.load())
+        return m_cached_checksum.load();
+
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Location");
-    CheckSums::CheckSumCombine(retval, m_name1);
-    CheckSums::CheckSumCombine(retval, m_name2);
-    CheckSums::CheckSumCombine(retval, m_content_type);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Location");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_name1, m_name2, m_content_type);
+
+    m_cached_checksum.store(retval);
+    m_checksum_cached.store(true);
 
     TraceLogger(conditions) << "GetCheckSum(Location): retval: " << retval;
     return retval;
@@ -10140,6 +12630,13 @@ CombatTarget::CombatTarget(ContentType content_type,
     m_root_candidate_invariant = !m_name || m_name->RootCandidateInvariant();
     m_target_invariant = !m_name|| m_name->TargetInvariant();
     m_source_invariant = !m_name || m_name->SourceInvariant();
+    RefreshConstantName();
+}
+
+void CombatTarget::RefreshConstantName() {
+    m_name_constant = !m_name || m_name->ConstantExpr();
+    if (m_name_constant)
+        m_const_name = m_name ? m_name->Eval() : "";
 }
 
 bool CombatTarget::operator==(const Condition& rhs) const {
@@ -10168,10 +12665,11 @@ void CombatTarget::Eval(const ScriptingContext& parent_context,
     if (simple_eval_safe) {
         // evaluate value and range limits once, use to match all candidates
 
-        std::string name = (m_name ? m_name->Eval(parent_context) : "");
-
         // get condition from content, apply to matches / non_matches
-        const auto condition = GetCombatTargetCondition(m_content_type, name);
+        const auto condition = m_name_constant ?
+            GetCombatTargetCondition(m_content_type, m_const_name) :
+            GetCombatTargetCondition(m_content_type,
+                                     m_name ? m_name->Eval(parent_context) : "");
         if (condition && condition != this) {
             condition->Eval(parent_context, matches, non_matches, search_domain);
         } else {
@@ -10180,8 +12678,7 @@ void CombatTarget::Eval(const ScriptingContext& parent_context,
             // targetting condition (eg. in valid content type, or name of
             // a bit of content that doesn't exist), match nothing
             if (search_domain == SearchDomain::MATCHES) {
-                non_matches.insert(non_matches.end(), matches.begin(), matches.end());
-                matches.clear();
+                MoveAll(matches, non_matches);
             }
         }
 
@@ -10219,7 +12716,7 @@ std::string CombatTarget::Dump(unsigned short ntabs) const {
     }
 
     if (m_name)
-        retval += " name = " + m_name->Dump(ntabs);
+        retval.append(" name = ").append(m_name->Dump(ntabs));
     return retval;
 }
 
@@ -10230,9 +12727,10 @@ bool CombatTarget::Match(const ScriptingContext& local_context) const {
         return false;
     }
 
-    std::string name = (m_name ? m_name->Eval(local_context) : "");
-
-    const auto condition = GetCombatTargetCondition(m_content_type, name);
+    const auto condition = m_name_constant ?
+        GetCombatTargetCondition(m_content_type, m_const_name) :
+        GetCombatTargetCondition(m_content_type,
+                                 m_name ? m_name->Eval(local_context) : "");
     if (!condition || condition == this)
         return false;
 
@@ -10242,16 +12740,26 @@ bool CombatTarget::Match(const ScriptingContext& local_context) const {
 }
 
 void CombatTarget::SetTopLevelContent(const std::string& content_name) {
-    if (m_name)
-        m_name->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_name);
+    // substituting the content name can change what CurrentContent constants
+    // evaluate to, so re-fold the name afterwards
+    RefreshConstantName();
+    m_checksum_cached.store(false); // content substitution can change the operands' checksums
 }
 
 unsigned int CombatTarget::GetCheckSum() const {
+    // operands only change via SetTopLevelContent, which invalidates the
+    // cache, so the checksum can be memoized
+    if (m_checksum_cached.load())
+        return m_cached_checksum.load();
+
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::CombatTarget");
-    CheckSums::CheckSumCombine(retval, m_name);
-    CheckSums::CheckSumCombine(retval, m_content_type);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::CombatTarget");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_name, m_content_type);
+
+    m_cached_checksum.store(retval);
+    m_checksum_cached.store(true);
 
     TraceLogger(conditions) << "GetCheckSum(CombatTarget): retval: " << retval;
     return retval;
@@ -10265,25 +12773,144 @@ std::unique_ptr<Condition> CombatTarget::Clone() const {
 ///////////////////////////////////////////////////////////
 // And                                                   //
 ///////////////////////////////////////////////////////////
+namespace {
+    // replaces adjacent operand pairs that have a combined implementation
+    // (e.g. WithinDistance followed by VisibleToEmpire) with the fused
+    // condition, so both per-candidate tests run in one pass over the
+    // candidates instead of one pass each
+    void FuseOperands(std::vector<std::unique_ptr<Condition>>& operands) {
+        for (std::size_t i = 0; i + 1 < operands.size(); ++i) {
+            if (auto fused = operands[i]->TryFuse(*operands[i + 1])) {
+                operands[i] = std::move(fused);
+                operands.erase(operands.begin() + i + 1);
+            }
+        }
+    }
+
+    // drops operands that cannot affect a conjunction: a None operand makes
+    // the whole conjunction match nothing, so it alone suffices, and an All
+    // operand matches every candidate, so it contributes nothing next to the
+    // remaining operands. at least one operand is always kept so And::Eval
+    // still has something to apply
+    void SimplifyAndOperands(std::vector<std::unique_ptr<Condition>>& operands) {
+        const auto none_it = std::find_if(operands.begin(), operands.end(),
+                                          [](const auto& op) { return dynamic_cast<const None*>(op.get()); });
+        if (none_it != operands.end()) {
+            auto none = std::move(*none_it);
+            operands.clear();
+            operands.push_back(std::move(none));
+            return;
+        }
+        if (operands.size() > 1) {
+            auto keep_end = std::remove_if(operands.begin(), operands.end(),
+                                           [](const auto& op) { return dynamic_cast<const All*>(op.get()); });
+            if (keep_end == operands.begin())
+                ++keep_end;
+            operands.erase(keep_end, operands.end());
+        }
+    }
+
+    // drops operands that cannot affect a disjunction: an All operand makes
+    // the whole disjunction match everything, so it alone suffices, and a
+    // None operand matches no candidate, so it contributes nothing next to
+    // the remaining operands. at least one operand is always kept so Or::Eval
+    // still has something to apply
+    void SimplifyOrOperands(std::vector<std::unique_ptr<Condition>>& operands) {
+        const auto all_it = std::find_if(operands.begin(), operands.end(),
+                                         [](const auto& op) { return dynamic_cast<const All*>(op.get()); });
+        if (all_it != operands.end()) {
+            auto all = std::move(*all_it);
+            operands.clear();
+            operands.push_back(std::move(all));
+            return;
+        }
+        if (operands.size() > 1) {
+            auto keep_end = std::remove_if(operands.begin(), operands.end(),
+                                           [](const auto& op) { return dynamic_cast<const None*>(op.get()); });
+            if (keep_end == operands.begin())
+                ++keep_end;
+            operands.erase(keep_end, operands.end());
+        }
+    }
+
+    // replaces adjacent operand pairs that test alternatives over the same
+    // attribute (e.g. Building [A] followed by Building [B]) with a single
+    // condition testing the merged list, so a long scripted alternative
+    // chain costs one membership test per candidate instead of one
+    // candidate pass per operand. fused results stay at their position and
+    // retry against the next operand, collapsing whole runs
+    void FuseOrOperands(std::vector<std::unique_ptr<Condition>>& operands) {
+        for (std::size_t i = 0; i + 1 < operands.size();) {
+            if (auto fused = operands[i]->TryFuseOr(*operands[i + 1])) {
+                operands[i] = std::move(fused);
+                operands.erase(operands.begin() + i + 1);
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    // orders the operands after the first from cheapest to most expensive
+    // per-candidate test, so the cheap tests settle most candidates before
+    // the expensive ones run; neither a conjunction's nor a disjunction's
+    // result depends on the order its operands are applied in. the first
+    // operand stays put: scripts lead with the type-narrowing condition,
+    // which also supplies the initial candidate set via
+    // GetDefaultInitialCandidateObjects, and Or's initial-candidate logic
+    // special-cases a leading Source operand
+    void OrderOperandsByCost(std::vector<std::unique_ptr<Condition>>& operands) {
+        if (operands.size() > 2)
+            std::stable_sort(operands.begin() + 1, operands.end(),
+                             [](const auto& lhs, const auto& rhs) {
+                                 return (lhs ? lhs->EstimatedMatchCost() : 0) <
+                                        (rhs ? rhs->EstimatedMatchCost() : 0);
+                             });
+    }
+}
+
+// splices the operands of any directly-nested And into \a operands:
+// conjunction is associative, so the flat list matches the same objects
+// without recursing through the inner And and re-partitioning the candidate
+// sets there. one level suffices, as nested Ands flattened themselves when
+// they were constructed
+void And::FlattenOperands(std::vector<std::unique_ptr<Condition>>& operands) {
+    if (std::none_of(operands.begin(), operands.end(),
+                     [](const auto& op) { return dynamic_cast<const And*>(op.get()); }))
+        return;
+    std::vector<std::unique_ptr<Condition>> flat;
+    flat.reserve(operands.size() + 4);
+    for (auto& op : operands) {
+        if (And* nested = dynamic_cast<And*>(op.get())) {
+            for (auto& nested_op : nested->m_operands) {
+                if (nested_op)
+                    flat.push_back(std::move(nested_op));
+            }
+        } else if (op) {
+            flat.push_back(std::move(op));
+        }
+    }
+    operands = std::move(flat);
+}
+
 And::And(std::vector<std::unique_ptr<Condition>>&& operands) :
     m_operands(std::move(operands))
 {
-    m_root_candidate_invariant = boost::algorithm::all_of(m_operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(m_operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(m_operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    FlattenOperands(m_operands);
+    SimplifyAndOperands(m_operands);
+    FuseOperands(m_operands);
+    OrderOperandsByCost(m_operands);
+    const auto invariants = RefsInvariants(m_operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
 }
 
 And::And(std::unique_ptr<Condition>&& operand1, std::unique_ptr<Condition>&& operand2,
          std::unique_ptr<Condition>&& operand3, std::unique_ptr<Condition>&& operand4)
 {
     // would prefer to initialize the vector m_operands in the initializer list, but this is difficult with non-copyable unique_ptr parameters
-    if (operand1) {
-        if (And* operand1_and = dynamic_cast<And*>(operand1.get())) {
-            m_operands = std::move(operand1_and->m_operands);
-        } else {
-            m_operands.push_back(std::move(operand1));
-        }
-    }
+    if (operand1)
+        m_operands.push_back(std::move(operand1));
     if (operand2)
         m_operands.push_back(std::move(operand2));
     if (operand3)
@@ -10291,9 +12918,14 @@ And::And(std::unique_ptr<Condition>&& operand1, std::unique_ptr<Condition>&& ope
     if (operand4)
         m_operands.push_back(std::move(operand4));
 
-    m_root_candidate_invariant = boost::algorithm::all_of(m_operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(m_operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(m_operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    FlattenOperands(m_operands);
+    SimplifyAndOperands(m_operands);
+    FuseOperands(m_operands);
+    OrderOperandsByCost(m_operands);
+    const auto invariants = RefsInvariants(m_operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
 }
 
 bool And::operator==(const Condition& rhs) const {
@@ -10336,26 +12968,37 @@ void And::Eval(const ScriptingContext& parent_context, ObjectSet& matches,
     };
 
     TraceLogger(conditions) << [&]() {
-        std::stringstream ss;
-        ss << "And::Eval searching " << (search_domain == SearchDomain::MATCHES ? "matches" : "non_matches")
-           << " with input matches (" << matches.size() << "): " << ObjList(matches)
-           << " and input non_matches(" << non_matches.size() << "): " << ObjList(non_matches);
-        return ss.str();
+        std::string ss;
+        ss.reserve(80 + 20 * (matches.size() + non_matches.size()));
+        ss.append("And::Eval searching ")
+          .append(search_domain == SearchDomain::MATCHES ? "matches" : "non_matches")
+          .append(" with input matches (").append(std::to_string(matches.size()))
+          .append("): ").append(ObjList(matches))
+          .append(" and input non_matches(").append(std::to_string(non_matches.size()))
+          .append("): ").append(ObjList(non_matches));
+        return ss;
     }();
 
     if (search_domain == SearchDomain::NON_MATCHES) {
-        ObjectSet partly_checked_non_matches;
+        // reuse a scratch set's capacity rather than allocating per call; moved
+        // out while in use so a nested And::Eval in an operand can't clobber it
+        static thread_local ObjectSet partly_checked_buffer;
+        ObjectSet partly_checked_non_matches{std::move(partly_checked_buffer)};
+        partly_checked_non_matches.clear();
         partly_checked_non_matches.reserve(non_matches.size());
 
         // move items in non_matches set that pass first operand condition into
         // partly_checked_non_matches set
         m_operands[0]->Eval(parent_context, partly_checked_non_matches, non_matches, SearchDomain::NON_MATCHES);
         TraceLogger(conditions) << [&]() {
-            std::stringstream ss;
-            ss << "Subcondition: " << m_operands[0]->Dump()
-               <<"\npartly_checked_non_matches (" << partly_checked_non_matches.size() << "): "
-               << ObjList(partly_checked_non_matches);
-            return ss.str();
+            std::string op_dump = m_operands[0]->Dump();
+            std::string ss;
+            ss.reserve(50 + op_dump.size() + 20 * partly_checked_non_matches.size());
+            ss.append("Subcondition: ").append(op_dump)
+              .append("\npartly_checked_non_matches (")
+              .append(std::to_string(partly_checked_non_matches.size()))
+              .append("): ").append(ObjList(partly_checked_non_matches));
+            return ss;
         }();
 
         // move items that don't pass one of the other conditions back to non_matches
@@ -10363,17 +13006,21 @@ void And::Eval(const ScriptingContext& parent_context, ObjectSet& matches,
             if (partly_checked_non_matches.empty()) break;
             m_operands[i]->Eval(parent_context, partly_checked_non_matches, non_matches, SearchDomain::MATCHES);
             TraceLogger(conditions) << [&]() {
-                std::stringstream ss;
-                ss << "Subcondition: " << m_operands[i]->Dump()
-                   <<"\npartly_checked_non_matches (" << partly_checked_non_matches.size() << "): "
-                   << ObjList(partly_checked_non_matches);
-                return ss.str();
+                std::string op_dump = m_operands[i]->Dump();
+                std::string ss;
+                ss.reserve(50 + op_dump.size() + 20 * partly_checked_non_matches.size());
+                ss.append("Subcondition: ").append(op_dump)
+                  .append("\npartly_checked_non_matches (")
+                  .append(std::to_string(partly_checked_non_matches.size()))
+                  .append("): ").append(ObjList(partly_checked_non_matches));
+                return ss;
             }();
         }
 
         // merge items that passed all operand conditions into matches
         matches.insert(matches.end(), partly_checked_non_matches.begin(),
                        partly_checked_non_matches.end());
+        partly_checked_buffer = std::move(partly_checked_non_matches);
 
         // items already in matches set are not checked, and remain in matches set even if
         // they don't match one of the operand conditions
@@ -10428,16 +13075,32 @@ std::string And::Description(bool negated) const {
 }
 
 std::string And::Dump(unsigned short ntabs) const {
-    std::string retval = DumpIndent(ntabs) + "And [\n";
-    for (auto& operand : m_operands)
-        retval += operand->Dump(ntabs+1);
-    retval += DumpIndent(ntabs) + "]\n";
+    std::vector<std::string> operand_dumps;
+    operand_dumps.reserve(m_operands.size());
+    std::size_t operands_sz = 0;
+    for (auto& operand : m_operands) {
+        operand_dumps.push_back(operand->Dump(ntabs+1));
+        operands_sz += operand_dumps.back().size();
+    }
+    std::string retval;
+    retval.reserve(2 * (ntabs * 4 + 7) + operands_sz);
+    retval.append(DumpIndent(ntabs)).append("And [\n");
+    for (const auto& operand_dump : operand_dumps)
+        retval += operand_dump;
+    retval.append(DumpIndent(ntabs)).append("]\n");
     return retval;
 }
 
 bool And::InitialCandidatesAllMatch() const
 { return m_operands.size() < 2; }
 
+int And::EstimatedMatchCost() const {
+    int retval = 0;
+    for (const auto& operand : m_operands)
+        retval += operand ? operand->EstimatedMatchCost() : 0;
+    return retval;
+}
+
 void And::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_context,
                                             ObjectSet& condition_non_targets) const {
     if (!m_operands.empty())
@@ -10448,13 +13111,22 @@ void And::SetTopLevelContent(const std::string& content_name) {
     for (auto& operand : m_operands) {
         operand->SetTopLevelContent(content_name);
     }
+    m_checksum_cached.store(false); // content substitution can change the operands' checksums
 }
 
 unsigned int And::GetCheckSum() const {
+    // operands only change via SetTopLevelContent, which invalidates the
+    // cache, so the checksum can be memoized
+    if (m_checksum_cached.load())
+        return m_cached_checksum.load();
+
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::And");
-    CheckSums::CheckSumCombine(retval, m_operands);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::And");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_operands);
+
+    m_cached_checksum.store(retval);
+    m_checksum_cached.store(true);
 
     TraceLogger(conditions) << "GetCheckSum(And): retval: " << retval;
     return retval;
@@ -10474,25 +13146,56 @@ std::unique_ptr<Condition> And::Clone() const
 ///////////////////////////////////////////////////////////
 // Or                                                    //
 ///////////////////////////////////////////////////////////
+// splices the operands of any directly-nested Or into \a operands: same
+// associativity argument as And::FlattenOperands, and nested Ors likewise
+// flattened themselves when they were constructed
+void Or::FlattenOperands(std::vector<std::unique_ptr<Condition>>& operands) {
+    if (std::none_of(operands.begin(), operands.end(),
+                     [](const auto& op) { return dynamic_cast<const Or*>(op.get()); }))
+        return;
+    std::vector<std::unique_ptr<Condition>> flat;
+    flat.reserve(operands.size() + 4);
+    for (auto& op : operands) {
+        if (Or* nested = dynamic_cast<Or*>(op.get())) {
+            for (auto& nested_op : nested->m_operands) {
+                if (nested_op)
+                    flat.push_back(std::move(nested_op));
+            }
+        } else if (op) {
+            flat.push_back(std::move(op));
+        }
+    }
+    operands = std::move(flat);
+}
+
+Or::FrontOpKind Or::DetectFrontOpKind(const Condition& cond) {
+    if (dynamic_cast<const Source*>(&cond))        return FrontOpKind::SOURCE;
+    if (dynamic_cast<const Target*>(&cond))        return FrontOpKind::TARGET;
+    if (dynamic_cast<const RootCandidate*>(&cond)) return FrontOpKind::ROOT_CANDIDATE;
+    return FrontOpKind::OTHER;
+}
+
 Or::Or(std::vector<std::unique_ptr<Condition>>&& operands) :
     m_operands(std::move(operands))
 {
-    m_root_candidate_invariant = boost::algorithm::all_of(m_operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(m_operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(m_operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    FlattenOperands(m_operands);
+    SimplifyOrOperands(m_operands);
+    FuseOrOperands(m_operands);
+    OrderOperandsByCost(m_operands);
+    if (!m_operands.empty() && m_operands.front())
+        m_front_op_kind = DetectFrontOpKind(*m_operands.front());
+    const auto invariants = RefsInvariants(m_operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
 }
 
 Or::Or(std::unique_ptr<Condition>&& operand1, std::unique_ptr<Condition>&& operand2,
        std::unique_ptr<Condition>&& operand3, std::unique_ptr<Condition>&& operand4)
 {
     // would prefer to initialize the vector m_operands in the initializer list, but this is difficult with non-copyable unique_ptr parameters
-    if (operand1) {
-        if (Or* operand1_or = dynamic_cast<Or*>(operand1.get())) {
-            m_operands = std::move(operand1_or->m_operands);
-        } else {
-            m_operands.push_back(std::move(operand1));
-        }
-    }
+    if (operand1)
+        m_operands.push_back(std::move(operand1));
     if (operand2)
         m_operands.push_back(std::move(operand2));
     if (operand3)
@@ -10500,9 +13203,16 @@ Or::Or(std::unique_ptr<Condition>&& operand1, std::unique_ptr<Condition>&& opera
     if (operand4)
         m_operands.push_back(std::move(operand4));
 
-    m_root_candidate_invariant = boost::algorithm::all_of(m_operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(m_operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(m_operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    FlattenOperands(m_operands);
+    SimplifyOrOperands(m_operands);
+    FuseOrOperands(m_operands);
+    OrderOperandsByCost(m_operands);
+    if (!m_operands.empty() && m_operands.front())
+        m_front_op_kind = DetectFrontOpKind(*m_operands.front());
+    const auto invariants = RefsInvariants(m_operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
 }
 
 bool Or::operator==(const Condition& rhs) const {
@@ -10550,21 +13260,28 @@ void Or::Eval(const ScriptingContext& parent_context, ObjectSet& matches,
         // matches set even if they fail all the operand conditions
 
     } else {
-        ObjectSet partly_checked_matches;
+        // reuse a scratch set's capacity rather than allocating per call; moved
+        // out while in use so a nested Or::Eval in an operand can't clobber it
+        static thread_local ObjectSet partly_checked_buffer;
+        ObjectSet partly_checked_matches{std::move(partly_checked_buffer)};
+        partly_checked_matches.clear();
         partly_checked_matches.reserve(matches.size());
 
         // move items in matches set the fail the first operand condition into
         // partly_checked_matches set
         m_operands[0]->Eval(parent_context, matches, partly_checked_matches, SearchDomain::MATCHES);
 
-        // move items that pass any of the other conditions back into matches
-        for (auto& operand : m_operands) {
+        // move items that pass any of the other conditions back into matches.
+        // the first operand is skipped: everything in partly_checked_matches
+        // just failed it, so rechecking it cannot move anything
+        for (auto op_it = std::next(m_operands.begin()); op_it != m_operands.end(); ++op_it) {
             if (partly_checked_matches.empty()) break;
-            operand->Eval(parent_context, matches, partly_checked_matches, SearchDomain::NON_MATCHES);
+            (*op_it)->Eval(parent_context, matches, partly_checked_matches, SearchDomain::NON_MATCHES);
         }
 
         // merge items that failed all operand conditions into non_matches
         non_matches.insert(non_matches.end(), partly_checked_matches.begin(), partly_checked_matches.end());
+        partly_checked_buffer = std::move(partly_checked_matches);
 
         // items already in non_matches set are not checked and remain in
         // non_matches set even if they pass one or more of the operand
@@ -10607,6 +13324,13 @@ std::string Or::Description(bool negated) const {
 bool Or::InitialCandidatesAllMatch() const
 { return m_operands.size() < 2; }
 
+int Or::EstimatedMatchCost() const {
+    int retval = 0;
+    for (const auto& operand : m_operands)
+        retval += operand ? operand->EstimatedMatchCost() : 0;
+    return retval;
+}
+
 void Or::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_context,
                                            ObjectSet& condition_non_targets) const
 {
@@ -10619,38 +13343,82 @@ void Or::GetDefaultInitialCandidateObjects(const ScriptingContext& parent_contex
         return;
     }
 
-    if (parent_context.source && m_operands.size() == 2) {
-        if (dynamic_cast<const Source*>(m_operands[0].get())) {
-            // special case when first of two subconditions is just Source:
-            // get the default candidates of the second and add the source if
-            // it is not already present.
-            // TODO: extend to other single-match conditions: RootCandidate, Target
-            // TODO: predetermine this situation to avoid repeat runtime dynamic-casts
-            // TODO: fancier deep inspection of m_operands to determine optimal
-            //       way to combine the default candidates...
-
+    if (m_operands.size() == 2 && m_front_op_kind != FrontOpKind::OTHER) {
+        // special case when the first of two subconditions can only match a
+        // single known context object (Source, Target or RootCandidate, as
+        // classified once at construction): get the default candidates of
+        // the second and add that object if it is present and not already
+        // among them
+        const UniverseObject* single_obj = nullptr;
+        switch (m_front_op_kind) {
+        case FrontOpKind::SOURCE:         single_obj = parent_context.source;                   break;
+        case FrontOpKind::TARGET:         single_obj = parent_context.effect_target;            break;
+        case FrontOpKind::ROOT_CANDIDATE: single_obj = parent_context.condition_root_candidate; break;
+        default: break;
+        }
+        if (single_obj) {
             m_operands[1]->GetDefaultInitialCandidateObjects(parent_context, condition_non_targets);
-            if (std::find(condition_non_targets.begin(), condition_non_targets.end(), parent_context.source) ==
+            if (std::find(condition_non_targets.begin(), condition_non_targets.end(), single_obj) ==
                 condition_non_targets.end())
-            { condition_non_targets.push_back(parent_context.source); }
+            { condition_non_targets.push_back(single_obj); }
             return;
         }
+        // without the context object, fall through to the general union
     }
 
-    // default / fallback
-    Condition::GetDefaultInitialCandidateObjects(parent_context, condition_non_targets);
+    // union of the operands' initial candidates, deduplicated against a
+    // bitset over object IDs: one bit test-and-set per candidate, unlike the
+    // unordered_set dedup tried before, whose hashing made it substantially
+    // slower than just scanning the whole object map. both scratch buffers
+    // are moved out while in use so nested calls through an operand cannot
+    // clobber them
+    static thread_local ObjectSet scratch_buffer;
+    static thread_local std::vector<uint64_t> seen_buffer;
+    ObjectSet scratch{std::move(scratch_buffer)};
+    std::vector<uint64_t> seen_ids{std::move(seen_buffer)};
+
+    const auto already_seen = [&seen_ids](int id) -> bool {
+        if (id < 0)
+            return false;
+        const auto word = static_cast<std::size_t>(id) >> 6;
+        if (word >= seen_ids.size())
+            seen_ids.resize(word + 1, 0);
+        const uint64_t bit = uint64_t{1} << (id & 63);
+        if (seen_ids[word] & bit)
+            return true;
+        seen_ids[word] |= bit;
+        return false;
+    };
+
+    for (auto& operand : m_operands) {
+        scratch.clear();
+        operand->GetDefaultInitialCandidateObjects(parent_context, scratch);
+        condition_non_targets.reserve(condition_non_targets.size() + scratch.size());
+        for (auto* obj : scratch) {
+            if (obj && !already_seen(obj->ID()))
+                condition_non_targets.push_back(obj);
+        }
+    }
 
-    // Also tried looping over all subconditions in m_operands and putting all
-    // of their initial candidates into an unordered_set (to remove duplicates)
-    // and then copying the result back into condition_non_targets but this was
-    // substantially slower for many Or conditions
+    std::fill(seen_ids.begin(), seen_ids.end(), 0);
+    seen_buffer = std::move(seen_ids);
+    scratch_buffer = std::move(scratch);
 }
 
 std::string Or::Dump(unsigned short ntabs) const {
-    std::string retval = DumpIndent(ntabs) + "Or [\n";
-    for (auto& operand : m_operands)
-        retval += operand->Dump(ntabs+1);
-    retval += "\n" + DumpIndent(ntabs) + "]\n";
+    std::vector<std::string> operand_dumps;
+    operand_dumps.reserve(m_operands.size());
+    std::size_t operands_sz = 0;
+    for (auto& operand : m_operands) {
+        operand_dumps.push_back(operand->Dump(ntabs+1));
+        operands_sz += operand_dumps.back().size();
+    }
+    std::string retval;
+    retval.reserve(2 * (ntabs * 4 + 7) + operands_sz);
+    retval.append(DumpIndent(ntabs)).append("Or [\n");
+    for (const auto& operand_dump : operand_dumps)
+        retval += operand_dump;
+    retval.append("\n").append(DumpIndent(ntabs)).append("]\n");
     return retval;
 }
 
@@ -10658,13 +13426,22 @@ void Or::SetTopLevelContent(const std::string& content_name) {
     for (auto& operand : m_operands) {
         operand->SetTopLevelContent(content_name);
     }
+    m_checksum_cached.store(false); // content substitution can change the operands' checksums
 }
 
 unsigned int Or::GetCheckSum() const {
+    // operands only change via SetTopLevelContent, which invalidates the
+    // cache, so the checksum can be memoized
+    if (m_checksum_cached.load())
+        return m_cached_checksum.load();
+
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Or");
-    CheckSums::CheckSumCombine(retval, m_operands);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Or");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_operands);
+
+    m_cached_checksum.store(retval);
+    m_checksum_cached.store(true);
 
     TraceLogger(conditions) << "GetCheckSum(Or): retval: " << retval;
     return retval;
@@ -10684,6 +13461,9 @@ Not::Not(std::unique_ptr<Condition>&& operand) :
     m_source_invariant = !m_operand || m_operand->SourceInvariant();
 }
 
+int Not::EstimatedMatchCost() const
+{ return m_operand ? m_operand->EstimatedMatchCost() : 0; }
+
 bool Not::operator==(const Condition& rhs) const {
     if (this == &rhs)
         return true;
@@ -10728,13 +13508,22 @@ std::string Not::Dump(unsigned short ntabs) const {
 void Not::SetTopLevelContent(const std::string& content_name) {
     if (m_operand)
         m_operand->SetTopLevelContent(content_name);
+    m_checksum_cached.store(false); // content substitution can change the operands' checksums
 }
 
 unsigned int Not::GetCheckSum() const {
+    // operands only change via SetTopLevelContent, which invalidates the
+    // cache, so the checksum can be memoized
+    if (m_checksum_cached.load())
+        return m_cached_checksum.load();
+
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Not");
-    CheckSums::CheckSumCombine(retval, m_operand);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Not");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_operand);
+
+    m_cached_checksum.store(retval);
+    m_checksum_cached.store(true);
 
     TraceLogger(conditions) << "GetCheckSum(Not): retval: " << retval;
     return retval;
@@ -10746,20 +13535,14 @@ std::unique_ptr<Condition> Not::Clone() const
 ///////////////////////////////////////////////////////////
 // OrderedAlternativesOf
 ///////////////////////////////////////////////////////////
-namespace {
-    void FCMoveContent(ObjectSet& from_set, ObjectSet& to_set) {
-        to_set.insert(to_set.end(), from_set.begin(), from_set.end());
-        from_set.clear();
-    }
-}
-
 OrderedAlternativesOf::OrderedAlternativesOf(
     std::vector<std::unique_ptr<Condition>>&& operands) :
     m_operands(std::move(operands))
 {
-    m_root_candidate_invariant = boost::algorithm::all_of(m_operands, [](auto& e){ return !e || e->RootCandidateInvariant(); });
-    m_target_invariant = boost::algorithm::all_of(m_operands, [](auto& e){ return !e || e->TargetInvariant(); });
-    m_source_invariant = boost::algorithm::all_of(m_operands, [](auto& e){ return !e || e->SourceInvariant(); });
+    const auto invariants = RefsInvariants(m_operands);
+    m_root_candidate_invariant = invariants[0];
+    m_target_invariant = invariants[1];
+    m_source_invariant = invariants[2];
 }
 
 bool OrderedAlternativesOf::operator==(const Condition& rhs) const {
@@ -10818,7 +13601,7 @@ void OrderedAlternativesOf::Eval(const ScriptingContext& parent_context,
                 // Select the current operand condition. Apply it to the NON_MATCHES candidate set.
                 // We alread did the application, so we use the results
                 matches.reserve(temp_objects.size() + matches.size());
-                FCMoveContent(temp_objects, matches);
+                MoveAll(temp_objects, matches);
                 return;
             }
             // Check if the operand condition matches an object in the other input set
@@ -10827,12 +13610,12 @@ void OrderedAlternativesOf::Eval(const ScriptingContext& parent_context,
                 // Select the current operand condition. Apply it to the NON_MATCHES candidate set.
                 // We already did the application before, but there were no matches.
                 // restore state before checking the operand
-                FCMoveContent(temp_objects, matches);
+                MoveAll(temp_objects, matches);
                 return;
             }
 
             // restore state before checking the operand
-            FCMoveContent(temp_objects, matches);
+            MoveAll(temp_objects, matches);
             // try the next operand
         }
 
@@ -10852,8 +13635,8 @@ void OrderedAlternativesOf::Eval(const ScriptingContext& parent_context,
             if (!temp_objects.empty()) {
                 // Select and apply this operand. Objects in matches do not match this condition.
                 non_matches.reserve(matches.size() + non_matches.size());
-                FCMoveContent(matches, non_matches);
-                FCMoveContent(temp_objects, matches);
+                MoveAll(matches, non_matches);
+                MoveAll(temp_objects, matches);
                 return;
             }
             // Select this operand if there are matching objects in the non_matches input set.
@@ -10862,18 +13645,18 @@ void OrderedAlternativesOf::Eval(const ScriptingContext& parent_context,
                 // Select and apply this operand. But no matching objects exist in the matches input set,
                 // so all objects need to be moved into the non_matches set
                 non_matches.reserve(matches.size() + non_matches.size() + temp_objects.size());
-                FCMoveContent(matches, non_matches);
-                FCMoveContent(temp_objects, non_matches);
+                MoveAll(matches, non_matches);
+                MoveAll(temp_objects, non_matches);
                 return;
             }
 
             // Operand was not selected. Restore state before. Try next operand.
-            FCMoveContent(temp_objects, matches);
+            MoveAll(temp_objects, matches);
         }
 
         // No operand condition was selected. Objects in matches input set do not match, so move those to non_matches input set.
         non_matches.reserve(matches.size() + non_matches.size());
-        FCMoveContent(matches, non_matches);
+        MoveAll(matches, non_matches);
     }
 }
 
@@ -10926,8 +13709,8 @@ void OrderedAlternativesOf::SetTopLevelContent(const std::string& content_name)
 unsigned int OrderedAlternativesOf::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::OrderedAlternativesOf");
-    CheckSums::CheckSumCombine(retval, m_operands);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::OrderedAlternativesOf");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_operands);
 
     TraceLogger(conditions) << "GetCheckSum(OrderedAlternativesOf): retval: " << retval;
     return retval;
@@ -10990,16 +13773,14 @@ std::string Described::Description(bool negated) const {
 }
 
 void Described::SetTopLevelContent(const std::string& content_name) {
-    if (m_condition)
-        m_condition->SetTopLevelContent(content_name);
+    SetTopLevelContentAll(content_name, m_condition);
 }
 
 unsigned int Described::GetCheckSum() const {
     unsigned int retval{0};
 
-    CheckSums::CheckSumCombine(retval, "Condition::Described");
-    CheckSums::CheckSumCombine(retval, m_condition);
-    CheckSums::CheckSumCombine(retval, m_desc_stringtable_key);
+    static constexpr auto tag_checksum = CheckSums::StringCheckSum("Condition::Described");
+    CheckSums::CheckSumCombine(retval, tag_checksum, m_condition, m_desc_stringtable_key);
 
     TraceLogger(conditions) << "GetCheckSum(Described): retval: " << retval;
     return retval;
@@ -2,12 +2,18 @@
 #define _Conditions_h_
 
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
+#include <boost/container/flat_set.hpp>
 #include "ConditionAll.h"
 #include "ConditionSource.h"
 #include "Condition.h"
+#include "ConstantsFwd.h"
 #include "EnumsFwd.h"
 #include "../Empire/ProductionQueue.h"
 #include "../util/CheckSums.h"
@@ -280,6 +286,7 @@ private:
     [[nodiscard]] bool Match(const ScriptingContext& local_context) const override;
 
     std::vector<std::unique_ptr<ValueRef::ValueRef<std::string>>> m_names;
+    bool m_refs_local_invariant = false;
 };
 
 /** Matches planets that are an empire's capital. */
@@ -354,6 +361,7 @@ struct FO_COMMON_API Type final : public Condition {
     [[nodiscard]] unsigned int GetCheckSum() const override;
 
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+    [[nodiscard]] int EstimatedMatchCost() const override { return 1; }   // single enum compare
 
 private:
     bool Match(const ScriptingContext& local_context) const override;
@@ -377,11 +385,17 @@ struct FO_COMMON_API Building final : public Condition {
     [[nodiscard]] unsigned int GetCheckSum() const override;
 
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+    [[nodiscard]] std::unique_ptr<Condition> TryFuseOr(const Condition& next) const override;
 
 private:
     bool Match(const ScriptingContext& local_context) const override;
 
     std::vector<std::unique_ptr<ValueRef::ValueRef<std::string>>> m_names;
+    std::vector<uint32_t> m_const_name_ids;     // interned IDs of m_names, pre-evaluated when all names are constant expressions
+    mutable std::atomic<unsigned int> m_cached_checksum{0};     // memoized GetCheckSum result, valid when m_checksum_cached
+    mutable std::atomic<bool> m_checksum_cached{false};
+    bool m_refs_local_invariant = false;
+    bool m_names_constant = false;
 };
 
 /** Matches all Field objects that are one of the field types specified
@@ -405,6 +419,11 @@ private:
     bool Match(const ScriptingContext& local_context) const override;
 
     std::vector<std::unique_ptr<ValueRef::ValueRef<std::string>>> m_names;
+    std::vector<uint32_t> m_const_name_ids;     // interned IDs of m_names, pre-evaluated when all names are constant expressions
+    mutable std::atomic<unsigned int> m_cached_checksum{0};     // memoized GetCheckSum result, valid when m_checksum_cached
+    mutable std::atomic<bool> m_checksum_cached{false};
+    bool m_refs_local_invariant = false;
+    bool m_names_constant = false;
 };
 
 
@@ -439,6 +458,11 @@ private:
     std::unique_ptr<ValueRef::ValueRef<double>>         m_capacity_high;
     std::unique_ptr<ValueRef::ValueRef<int>>            m_since_turn_low;
     std::unique_ptr<ValueRef::ValueRef<int>>            m_since_turn_high;
+    std::string                                         m_const_name;   // pre-evaluation of m_name when it is a constant expression
+    mutable std::atomic<unsigned int>                   m_cached_checksum{0};   // memoized GetCheckSum result, valid when m_checksum_cached
+    mutable std::atomic<bool>                           m_checksum_cached{false};
+    bool                                                m_refs_local_invariant = false;
+    bool                                                m_name_constant = false;
 };
 
 /** Matches all objects that have the tag \a tag. */
@@ -461,6 +485,11 @@ private:
     bool Match(const ScriptingContext& local_context) const override;
 
     std::unique_ptr<ValueRef::ValueRef<std::string>> m_name;
+    std::string m_const_name;   // upper-cased pre-evaluation of m_name when it is a constant expression
+    mutable std::atomic<unsigned int> m_cached_checksum{0};     // memoized GetCheckSum result, valid when m_checksum_cached
+    mutable std::atomic<bool> m_checksum_cached{false};
+    bool m_refs_local_invariant = false;
+    bool m_name_constant = false;
 };
 
 /** Matches all objects that were created on turns within the specified range. */
@@ -483,6 +512,9 @@ private:
 
     std::unique_ptr<ValueRef::ValueRef<int>> m_low;
     std::unique_ptr<ValueRef::ValueRef<int>> m_high;
+    mutable std::atomic<unsigned int> m_cached_checksum{0};     // memoized GetCheckSum result, valid when m_checksum_cached
+    mutable std::atomic<bool> m_checksum_cached{false};
+    bool m_refs_local_invariant = false;
 };
 
 /** Matches all objects that contain an object that matches Condition
@@ -501,11 +533,25 @@ struct FO_COMMON_API Contains final : public Condition {
     [[nodiscard]] unsigned int GetCheckSum() const override;
 
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+    [[nodiscard]] int EstimatedMatchCost() const override { return 40; }   // evaluates the subcondition against contents
 
 private:
     bool Match(const ScriptingContext& local_context) const override;
 
     std::unique_ptr<Condition> m_condition;
+    // universe-wide subcondition matches, reused across sibling Eval calls
+    // while the context reports the universe frozen (effects target scoping)
+    // and the object map, its state version and the turn are all unchanged;
+    // only filled for invariant subconditions. The state version check drops
+    // the cached raw pointers when objects are created or destroyed between
+    // scoping passes; the frozen requirement keeps evaluations during effects
+    // execution, which can change object attributes without touching the map,
+    // off the cache entirely.
+    mutable std::mutex m_subcond_cache_mutex;
+    mutable ObjectSet m_subcond_cache;
+    mutable const void* m_subcond_cache_objects = nullptr;
+    mutable unsigned int m_subcond_cache_state = 0;
+    mutable int m_subcond_cache_turn = 0;
 };
 
 /** Matches all objects that are contained by an object that matches Condition
@@ -524,11 +570,25 @@ struct FO_COMMON_API ContainedBy final : public Condition {
     [[nodiscard]] unsigned int GetCheckSum() const override;
 
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+    [[nodiscard]] int EstimatedMatchCost() const override { return 40; }   // evaluates the subcondition against containers
 
 private:
     bool Match(const ScriptingContext& local_context) const override;
 
     std::unique_ptr<Condition> m_condition;
+    // universe-wide subcondition matches, reused across sibling Eval calls
+    // while the context reports the universe frozen (effects target scoping)
+    // and the object map, its state version and the turn are all unchanged;
+    // only filled for invariant subconditions. The state version check drops
+    // the cached raw pointers when objects are created or destroyed between
+    // scoping passes; the frozen requirement keeps evaluations during effects
+    // execution, which can change object attributes without touching the map,
+    // off the cache entirely.
+    mutable std::mutex m_subcond_cache_mutex;
+    mutable ObjectSet m_subcond_cache;
+    mutable const void* m_subcond_cache_objects = nullptr;
+    mutable unsigned int m_subcond_cache_state = 0;
+    mutable int m_subcond_cache_turn = 0;
 };
 
 /** Matches all objects that are in the system with the indicated \a system_id
@@ -629,6 +689,7 @@ private:
     bool Match(const ScriptingContext& local_context) const override;
 
     std::vector<std::unique_ptr<ValueRef::ValueRef<::PlanetType>>> m_types;
+    std::optional<uint64_t> m_constant_types_mask;  // membership mask, set iff all of m_types are constant expressions
 };
 
 /** Matches all Planet objects that have one of the PlanetSizes in \a sizes.
@@ -653,6 +714,7 @@ private:
     bool Match(const ScriptingContext& local_context) const override;
 
     std::vector<std::unique_ptr<ValueRef::ValueRef<::PlanetSize>>> m_sizes;
+    std::optional<uint64_t> m_constant_sizes_mask;  // membership mask, set iff all of m_sizes are constant expressions
 };
 
 /** Matches all Planet objects that have one of the PlanetEnvironments in
@@ -679,6 +741,7 @@ private:
 
     std::vector<std::unique_ptr<ValueRef::ValueRef<::PlanetEnvironment>>> m_environments;
     std::unique_ptr<ValueRef::ValueRef<std::string>> m_species_name;
+    std::optional<uint64_t> m_constant_environments_mask;   // membership mask, set iff all of m_environments are constant expressions
 };
 
 /** Matches all planets or ships that have one of the species in \a species.
@@ -699,11 +762,14 @@ struct FO_COMMON_API Species final : public Condition {
     [[nodiscard]] unsigned int GetCheckSum() const override;
 
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+    [[nodiscard]] std::unique_ptr<Condition> TryFuseOr(const Condition& next) const override;
 
 private:
     bool Match(const ScriptingContext& local_context) const override;
 
     std::vector<std::unique_ptr<ValueRef::ValueRef<std::string>>> m_names;
+    std::optional<std::vector<std::string>> m_constant_names;   // sorted evaluated names, set iff all of m_names are constant expressions
+    bool m_refs_local_invariant = false;
 };
 
 /** Matches planets where the indicated number of the indicated building type
@@ -742,6 +808,7 @@ private:
     std::unique_ptr<ValueRef::ValueRef<int>>            m_empire_id;
     std::unique_ptr<ValueRef::ValueRef<int>>            m_low;
     std::unique_ptr<ValueRef::ValueRef<int>>            m_high;
+    bool                                                m_refs_local_invariant = false;
 };
 
 /** Matches all ProdCenter objects that have one of the FocusTypes in \a foci. */
@@ -764,6 +831,8 @@ private:
     bool Match(const ScriptingContext& local_context) const override;
 
     std::vector<std::unique_ptr<ValueRef::ValueRef<std::string>>> m_names;
+    std::optional<std::vector<std::string>> m_constant_names;   // sorted evaluated names, set iff all of m_names are constant expressions
+    bool m_refs_local_invariant = false;
 };
 
 /** Matches all System objects that have one of the StarTypes in \a types.  Note that all objects
@@ -785,6 +854,10 @@ private:
     bool Match(const ScriptingContext& local_context) const override;
 
     std::vector<std::unique_ptr<ValueRef::ValueRef<::StarType>>> m_types;
+    std::optional<uint64_t> m_constant_types_mask;  // membership mask, set iff all of m_types are constant expressions
+    bool m_refs_local_invariant = false;
+    mutable std::atomic<unsigned int> m_cached_checksum{0};     // memoized GetCheckSum result, valid when m_checksum_cached
+    mutable std::atomic<bool> m_checksum_cached{false};
 };
 
 /** Matches all ships whose ShipDesign has the hull specified by \a name. */
@@ -807,6 +880,9 @@ private:
     bool Match(const ScriptingContext& local_context) const override;
 
     std::unique_ptr<ValueRef::ValueRef<std::string>> m_name;
+    std::optional<std::string> m_constant_name;     // evaluated once, set iff m_name is a constant expression
+    mutable std::atomic<unsigned int> m_cached_checksum{0};     // memoized GetCheckSum result, valid when m_checksum_cached
+    mutable std::atomic<bool> m_checksum_cached{false};
 };
 
 /** Matches all ships whose ShipDesign has >= \a low and < \a high of the ship
@@ -834,6 +910,17 @@ private:
     std::unique_ptr<ValueRef::ValueRef<int>> m_low;
     std::unique_ptr<ValueRef::ValueRef<int>> m_high;
     std::unique_ptr<ValueRef::ValueRef<std::string>> m_name;
+    std::optional<std::string> m_constant_name;     // evaluated once, set iff m_name is a constant expression
+    std::optional<int> m_constant_low;              // ditto for m_low / m_high
+    std::optional<int> m_constant_high;
+    // ids of designs matching the constant operands, shared across Eval
+    // calls; valid while the cached universe/version pair below matches
+    mutable std::mutex m_design_cache_mutex;
+    mutable boost::container::flat_set<int> m_matching_design_ids;
+    mutable const void* m_design_cache_universe = nullptr;
+    mutable std::uint32_t m_design_cache_version = 0;
+    mutable std::atomic<unsigned int> m_cached_checksum{0};     // memoized GetCheckSum result, valid when m_checksum_cached
+    mutable std::atomic<bool> m_checksum_cached{false};
 };
 
 /** Matches ships whose ShipDesign has >= \a low and < \a high of ship parts of
@@ -861,6 +948,16 @@ private:
     std::unique_ptr<ValueRef::ValueRef<int>> m_low;
     std::unique_ptr<ValueRef::ValueRef<int>> m_high;
     ShipPartClass m_class;
+    std::optional<int> m_constant_low;              // evaluated once, set iff m_low / m_high are constant expressions
+    std::optional<int> m_constant_high;
+    // ids of designs matching the constant operands, shared across Eval
+    // calls; valid while the cached universe/version pair below matches
+    mutable std::mutex m_design_cache_mutex;
+    mutable boost::container::flat_set<int> m_matching_design_ids;
+    mutable const void* m_design_cache_universe = nullptr;
+    mutable std::uint32_t m_design_cache_version = 0;
+    mutable std::atomic<unsigned int> m_cached_checksum{0};     // memoized GetCheckSum result, valid when m_checksum_cached
+    mutable std::atomic<bool> m_checksum_cached{false};
 };
 
 /** Matches ships who ShipDesign is a predefined shipdesign with the name
@@ -882,6 +979,9 @@ private:
     bool Match(const ScriptingContext& local_context) const override;
 
     std::unique_ptr<ValueRef::ValueRef<std::string>> m_name;
+    std::optional<std::string> m_constant_name;     // evaluated once, set iff m_name is a constant expression
+    mutable std::atomic<unsigned int> m_cached_checksum{0};     // memoized GetCheckSum result, valid when m_checksum_cached
+    mutable std::atomic<bool> m_checksum_cached{false};
 };
 
 /** Matches ships whose design id \a id. */
@@ -902,6 +1002,8 @@ private:
     bool Match(const ScriptingContext& local_context) const override;
 
     std::unique_ptr<ValueRef::ValueRef<int>> m_design_id;
+    mutable std::atomic<unsigned int> m_cached_checksum{0};     // memoized GetCheckSum result, valid when m_checksum_cached
+    mutable std::atomic<bool> m_checksum_cached{false};
 };
 
 /** Matches ships or buildings produced by the empire with id \a empire_id.*/
@@ -922,6 +1024,7 @@ private:
     bool Match(const ScriptingContext& local_context) const override;
 
     std::unique_ptr<ValueRef::ValueRef<int>> m_empire_id;
+    std::optional<int> m_constant_empire_id;        // evaluated once, set iff m_empire_id is a constant expression
 };
 
 /** Matches a given object with a linearly distributed probability of \a chance. */
@@ -942,6 +1045,7 @@ private:
     bool Match(const ScriptingContext& local_context) const override;
 
     std::unique_ptr<ValueRef::ValueRef<double>> m_chance;
+    std::optional<double> m_constant_chance;        // evaluated once, set iff m_chance is a constant expression
 };
 
 /** Matches all objects that have a meter of type \a meter, and whose current
@@ -967,6 +1071,8 @@ private:
     MeterType m_meter;
     std::unique_ptr<ValueRef::ValueRef<double>> m_low;
     std::unique_ptr<ValueRef::ValueRef<double>> m_high;
+    std::optional<double> m_constant_low;           // evaluated once, set iff m_low is a constant expression
+    std::optional<double> m_constant_high;          // ditto for m_high
 };
 
 /** Matches ships that have a ship part meter of type \a meter for part \a part
@@ -994,6 +1100,9 @@ private:
     MeterType m_meter;
     std::unique_ptr<ValueRef::ValueRef<double>> m_low;
     std::unique_ptr<ValueRef::ValueRef<double>> m_high;
+    std::optional<std::string> m_constant_part_name;    // evaluated once, set iff m_part_name is a constant expression
+    std::optional<double> m_constant_low;               // ditto for m_low / m_high
+    std::optional<double> m_constant_high;
 };
 
 /** Matches all objects if the empire with id \a empire_id has an empire meter
@@ -1024,6 +1133,9 @@ private:
     const std::string m_meter;
     std::unique_ptr<ValueRef::ValueRef<double>> m_low;
     std::unique_ptr<ValueRef::ValueRef<double>> m_high;
+    std::optional<int> m_constant_empire_id;        // evaluated once, set iff m_empire_id is a constant expression
+    std::optional<double> m_constant_low;           // ditto for m_low / m_high
+    std::optional<double> m_constant_high;
 };
 
 /** Matches all objects whose owner's stockpile of \a stockpile is between
@@ -1054,6 +1166,8 @@ private:
     ResourceType                                m_stockpile;
     std::unique_ptr<ValueRef::ValueRef<double>> m_low;
     std::unique_ptr<ValueRef::ValueRef<double>> m_high;
+    std::optional<double>                       m_constant_low;     // evaluated once, set iff m_low is a constant expression
+    std::optional<double>                       m_constant_high;    // ditto for m_high
 };
 
 /** Matches all objects if the empire with id \a empire_id has adopted the
@@ -1082,6 +1196,7 @@ private:
 
     std::unique_ptr<ValueRef::ValueRef<std::string>>    m_name;
     std::unique_ptr<ValueRef::ValueRef<int>>            m_empire_id;
+    std::optional<std::string> m_constant_name;     // evaluated once, set iff m_name is a constant expression
 };
 
 /** Matches all objects whose owner who has tech \a name. */
@@ -1105,6 +1220,7 @@ private:
 
     std::unique_ptr<ValueRef::ValueRef<std::string>> m_name;
     std::unique_ptr<ValueRef::ValueRef<int>>         m_empire_id;
+    std::optional<std::string> m_constant_name;     // evaluated once, set iff m_name is a constant expression
 };
 
 /** Matches all objects whose owner who has the building type \a name available. */
@@ -1129,6 +1245,7 @@ private:
 
     std::unique_ptr<ValueRef::ValueRef<std::string>> m_name;
     std::unique_ptr<ValueRef::ValueRef<int>>         m_empire_id;
+    std::optional<std::string> m_constant_name;     // evaluated once, set iff m_name is a constant expression
 };
 
 /** Matches all objects whose owner who has the ship design \a id available. */
@@ -1153,6 +1270,8 @@ private:
 
     std::unique_ptr<ValueRef::ValueRef<int>> m_id;
     std::unique_ptr<ValueRef::ValueRef<int>> m_empire_id;
+    std::optional<int> m_constant_id;               // evaluated once, set iff m_id is a constant expression
+    std::optional<int> m_constant_empire_id;        // evaluated once, set iff m_empire_id is a constant expression
 };
 
 /** Matches all objects whose owner who has the ship part @a name available. */
@@ -1177,6 +1296,8 @@ private:
 
     std::unique_ptr<ValueRef::ValueRef<std::string>> m_name;
     std::unique_ptr<ValueRef::ValueRef<int>>         m_empire_id;
+    std::optional<std::string> m_constant_name;     // evaluated once, set iff m_name is a constant expression
+    std::optional<int> m_constant_empire_id;        // evaluated once, set iff m_empire_id is a constant expression
 };
 
 /** Matches all objects that are visible to the Empire with id \a empire_id */
@@ -1197,11 +1318,16 @@ struct FO_COMMON_API VisibleToEmpire final : public Condition {
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
 
 private:
+    friend struct WithinDistanceAndVisibleToEmpire;     // reads the value refs to run the fused pass
+
     bool Match(const ScriptingContext& local_context) const override;
 
     std::unique_ptr<ValueRef::ValueRef<int>> m_empire_id;
     std::unique_ptr<ValueRef::ValueRef<int>> m_since_turn;
     std::unique_ptr<ValueRef::ValueRef<Visibility>> m_vis;
+    std::optional<int> m_constant_empire_id;        // evaluated once, set iff m_empire_id is a constant expression
+    std::optional<int> m_constant_since_turn;       // evaluated once, set iff m_since_turn is a constant expression
+    std::optional<Visibility> m_constant_vis;       // evaluated once, set iff m_vis is a constant expression
 };
 
 /** Matches all objects that are within \a distance units of at least one
@@ -1221,14 +1347,44 @@ struct FO_COMMON_API WithinDistance final : public Condition {
     [[nodiscard]] unsigned int GetCheckSum() const override;
 
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+    [[nodiscard]] int EstimatedMatchCost() const override { return 25; }   // distance checks against subcondition matches
+    [[nodiscard]] std::unique_ptr<Condition> TryFuse(const Condition& next) const override;
 
 private:
+    friend struct WithinDistanceAndVisibleToEmpire;     // reads the value refs to run the fused pass
+
     bool Match(const ScriptingContext& local_context) const override;
 
     std::unique_ptr<ValueRef::ValueRef<double>> m_distance;
     std::unique_ptr<Condition> m_condition;
 };
 
+/** Matches all objects that match both a WithinDistance and a VisibleToEmpire
+  * condition.  Never produced by the parsers: And fuses an adjacent operand
+  * pair of those types into this form when it is constructed, so that both
+  * per-candidate tests run in a single pass over the candidates instead of
+  * one pass each with the intermediate partition written out between them. */
+struct FO_COMMON_API WithinDistanceAndVisibleToEmpire final : public Condition {
+    WithinDistanceAndVisibleToEmpire(const WithinDistance& within_distance,
+                                     const VisibleToEmpire& visible_to_empire);
+
+    bool operator==(const Condition& rhs) const override;
+    void Eval(const ScriptingContext& parent_context, ObjectSet& matches,
+              ObjectSet& non_matches, SearchDomain search_domain = SearchDomain::NON_MATCHES) const override;
+    [[nodiscard]] std::string Description(bool negated = false) const override;
+    [[nodiscard]] std::string Dump(unsigned short ntabs = 0) const override;
+    void SetTopLevelContent(const std::string& content_name) override;
+    [[nodiscard]] unsigned int GetCheckSum() const override;
+
+    [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+
+private:
+    bool Match(const ScriptingContext& local_context) const override;
+
+    std::unique_ptr<WithinDistance> m_within_distance;
+    std::unique_ptr<VisibleToEmpire> m_visible_to_empire;
+};
+
 /** Matches all objects that are within \a jumps starlane jumps of at least one
   * object that meets \a condition.  Warning: this Condition can slow things
   * down considerably if overused.  It is best to use Conditions that yield
@@ -1246,6 +1402,7 @@ struct FO_COMMON_API WithinStarlaneJumps final : public Condition {
     [[nodiscard]] unsigned int GetCheckSum() const override;
 
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+    [[nodiscard]] int EstimatedMatchCost() const override { return 50; }   // pathfinder jump-distance queries
 
 private:
     bool Match(const ScriptingContext& local_context) const override;
@@ -1272,6 +1429,7 @@ struct FO_COMMON_API CanAddStarlaneConnection : Condition {
     [[nodiscard]] unsigned int GetCheckSum() const override;
 
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+    [[nodiscard]] int EstimatedMatchCost() const override { return 50; }   // lane geometry tests against the whole map
 
 private:
     bool Match(const ScriptingContext& local_context) const override;
@@ -1313,6 +1471,7 @@ struct FO_COMMON_API Stationary final : public Condition {
     [[nodiscard]] unsigned int GetCheckSum() const override;
 
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+    [[nodiscard]] int EstimatedMatchCost() const override { return 2; }   // fleet lookup and move-order check
 
 private:
     bool Match(const ScriptingContext& local_context) const override;
@@ -1331,6 +1490,7 @@ struct FO_COMMON_API Aggressive final : public Condition {
     [[nodiscard]] unsigned int GetCheckSum() const override;
 
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+    [[nodiscard]] int EstimatedMatchCost() const override { return 2; }   // fleet lookup and flag check
 
 private:
     bool Match(const ScriptingContext& local_context) const override;
@@ -1357,6 +1517,8 @@ private:
     bool Match(const ScriptingContext& local_context) const override;
 
     std::unique_ptr<ValueRef::ValueRef<int>> m_empire_id;
+    int m_cached_empire_id = ALL_EMPIRES;   // valid iff m_empire_id_constant
+    bool m_empire_id_constant = false;
 };
 
 /** Matches objects that are in systems that are connected by resource-sharing
@@ -1375,12 +1537,15 @@ struct FO_COMMON_API ResourceSupplyConnectedByEmpire final : public Condition {
     [[nodiscard]] unsigned int GetCheckSum() const override;
 
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+    [[nodiscard]] int EstimatedMatchCost() const override { return 30; }   // evaluates the supply-source subcondition
 
 private:
     bool Match(const ScriptingContext& local_context) const override;
 
     std::unique_ptr<ValueRef::ValueRef<int>> m_empire_id;
     std::unique_ptr<Condition> m_condition;
+    int m_cached_empire_id = ALL_EMPIRES;   // valid iff m_empire_id_constant
+    bool m_empire_id_constant = false;
 };
 
 /** Matches objects whose species has the ability to found new colonies. */
@@ -1388,6 +1553,8 @@ struct FO_COMMON_API CanColonize final : public Condition {
     CanColonize();
 
     bool operator==(const Condition& rhs) const override;
+    void Eval(const ScriptingContext& parent_context, ObjectSet& matches,
+              ObjectSet& non_matches, SearchDomain search_domain = SearchDomain::NON_MATCHES) const override;
     [[nodiscard]] std::string Description(bool negated = false) const override;
     [[nodiscard]] std::string Dump(unsigned short ntabs = 0) const override;
     void SetTopLevelContent(const std::string& content_name) override
@@ -1405,6 +1572,8 @@ struct FO_COMMON_API CanProduceShips final : public Condition {
     CanProduceShips();
 
     bool operator==(const Condition& rhs) const override;
+    void Eval(const ScriptingContext& parent_context, ObjectSet& matches,
+              ObjectSet& non_matches, SearchDomain search_domain = SearchDomain::NON_MATCHES) const override;
     [[nodiscard]] std::string Description(bool negated = false) const override;
     [[nodiscard]] std::string Dump(unsigned short ntabs = 0) const override;
     void SetTopLevelContent(const std::string& content_name) override
@@ -1431,6 +1600,7 @@ struct FO_COMMON_API OrderedBombarded final : public Condition {
     [[nodiscard]] unsigned int GetCheckSum() const override;
 
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+    [[nodiscard]] int EstimatedMatchCost() const override { return 25; }   // evaluates the bombarding-object subcondition
 
 private:
     bool Match(const ScriptingContext& local_context) const override;
@@ -1469,6 +1639,7 @@ struct FO_COMMON_API ValueTest final : public Condition {
     [[nodiscard]] unsigned int GetCheckSum() const override;
 
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+    [[nodiscard]] int EstimatedMatchCost() const override { return 15; }   // up to three ValueRef evaluations
 
     [[nodiscard]] std::array<const ValueRef::ValueRef<double>*, 3> ValuesDouble() const
     { return {m_value_ref1.get(), m_value_ref2.get(), m_value_ref3.get()}; }
@@ -1497,6 +1668,15 @@ private:
 
     ComparisonType m_compare_type1 = ComparisonType::INVALID_COMPARISON;
     ComparisonType m_compare_type2 = ComparisonType::INVALID_COMPARISON;
+
+    // which of the three parallel ref triples the constructor filled, so the
+    // evaluation and output paths dispatch with one switch instead of probing
+    // each family's refs for null in turn
+    enum class ValueKind : char { DOUBLE, STRING, INT };
+    ValueKind m_ref_kind;
+
+    mutable std::atomic<unsigned int> m_cached_checksum{0};     // memoized GetCheckSum result, valid when m_checksum_cached
+    mutable std::atomic<bool> m_checksum_cached{false};
 };
 
 /** Matches objects that match the location condition of the specified
@@ -1516,13 +1696,22 @@ public:
     [[nodiscard]] unsigned int GetCheckSum() const override;
 
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+    [[nodiscard]] int EstimatedMatchCost() const override { return 40; }   // evaluates a scripted location condition
 
 private:
     bool Match(const ScriptingContext& local_context) const override;
 
+    void RefreshConstantNames();
+
     std::unique_ptr<ValueRef::ValueRef<std::string>> m_name1;
     std::unique_ptr<ValueRef::ValueRef<std::string>> m_name2;
+    std::string                                      m_const_name1;   // valid iff m_names_constant
+    std::string                                      m_const_name2;   // valid iff m_names_constant
     ContentType                                      m_content_type;
+    bool                                             m_names_constant = false;
+
+    mutable std::atomic<unsigned int> m_cached_checksum{0};     // memoized GetCheckSum result, valid when m_checksum_cached
+    mutable std::atomic<bool> m_checksum_cached{false};
 };
 
 /** Matches objects that match the combat targeting condition of the specified
@@ -1541,12 +1730,20 @@ public:
     [[nodiscard]] unsigned int GetCheckSum() const override;
 
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+    [[nodiscard]] int EstimatedMatchCost() const override { return 40; }   // evaluates a scripted targeting condition
 
 private:
     bool Match(const ScriptingContext& local_context) const override;
 
+    void RefreshConstantName();
+
     std::unique_ptr<ValueRef::ValueRef<std::string>> m_name;
+    std::string m_const_name;   // valid iff m_name_constant
     ContentType m_content_type;
+    bool m_name_constant = false;
+
+    mutable std::atomic<unsigned int> m_cached_checksum{0};     // memoized GetCheckSum result, valid when m_checksum_cached
+    mutable std::atomic<bool> m_checksum_cached{false};
 };
 
 /** Matches all objects that match every Condition in \a operands. */
@@ -1571,9 +1768,14 @@ struct FO_COMMON_API And final : public Condition {
     [[nodiscard]] unsigned int GetCheckSum() const override;
 
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+    [[nodiscard]] int EstimatedMatchCost() const override;
 
 private:
+    static void FlattenOperands(std::vector<std::unique_ptr<Condition>>& operands);
+
     std::vector<std::unique_ptr<Condition>> m_operands;
+    mutable std::atomic<unsigned int> m_cached_checksum{0};     // memoized GetCheckSum result, valid when m_checksum_cached
+    mutable std::atomic<bool> m_checksum_cached{false};
 };
 
 /** Matches all objects that match at least one Condition in \a operands. */
@@ -1597,9 +1799,22 @@ struct FO_COMMON_API Or final : public Condition {
     [[nodiscard]] unsigned int GetCheckSum() const override;
 
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+    [[nodiscard]] int EstimatedMatchCost() const override;
 
 private:
+    static void FlattenOperands(std::vector<std::unique_ptr<Condition>>& operands);
+
+    // what the first operand is, when it is a condition that can only match
+    // one known context object; lets GetDefaultInitialCandidateObjects add
+    // that object to the second operand's candidates instead of repeating a
+    // dynamic_cast on every call
+    enum class FrontOpKind : char { OTHER, SOURCE, TARGET, ROOT_CANDIDATE };
+    static FrontOpKind DetectFrontOpKind(const Condition& cond);
+
     std::vector<std::unique_ptr<Condition>> m_operands;
+    mutable std::atomic<unsigned int> m_cached_checksum{0};     // memoized GetCheckSum result, valid when m_checksum_cached
+    mutable std::atomic<bool> m_checksum_cached{false};
+    FrontOpKind m_front_op_kind = FrontOpKind::OTHER;
 };
 
 /** Matches all objects that do not match the Condition \a operand. */
@@ -1615,9 +1830,12 @@ struct FO_COMMON_API Not final : public Condition {
     [[nodiscard]] unsigned int GetCheckSum() const override;
 
     [[nodiscard]] std::unique_ptr<Condition> Clone() const override;
+    [[nodiscard]] int EstimatedMatchCost() const override;
 
 private:
     std::unique_ptr<Condition> m_operand;
+    mutable std::atomic<unsigned int> m_cached_checksum{0};     // memoized GetCheckSum result, valid when m_checksum_cached
+    mutable std::atomic<bool> m_checksum_cached{false};
 };
 
 /** Tests conditions in \a operands in order, to find the first condition that
@@ -6,6 +6,7 @@
 #include "UniverseObjectVisitor.h"
 #include "Universe.h"
 #include "../util/AppInterface.h"
+#include "../util/StringInterner.h"
 #include "../util/i18n.h"
 
 
@@ -21,6 +22,9 @@ Field::Field(std::string field_type, double x, double y, double radius, int crea
     else
         Rename(UserString("ENC_FIELD"));
 
+    if (!m_type_name.empty())
+        m_type_name_id = StringInterning::InternedID(m_type_name);
+
     UniverseObject::Init();
 
     AddMeter(MeterType::METER_SPEED);
@@ -58,8 +62,10 @@ void Field::Copy(std::shared_ptr<const UniverseObject> copied_object,
     UniverseObject::Copy(std::move(copied_object), vis, visible_specials, universe);
 
     if (vis >= Visibility::VIS_BASIC_VISIBILITY) {
-        this->m_name =      copied_field->m_name;
-        this->m_type_name = copied_field->m_type_name;
+        this->m_name =         copied_field->m_name;
+        this->m_type_name =    copied_field->m_type_name;
+        this->m_type_name_id = this->m_type_name.empty() ?
+            StringInterning::INVALID_INTERNED_ID : StringInterning::InternedID(this->m_type_name);
     }
 }
 
@@ -2,6 +2,7 @@
 #define _Field_h_
 
 
+#include <cstdint>
 #include "UniverseObject.h"
 #include "../util/Export.h"
 #include "../util/Pending.h"
@@ -25,6 +26,10 @@ public:
     [[nodiscard]] const std::string&    PublicName(int empire_id, const Universe&) const override;
     [[nodiscard]] const std::string&    FieldTypeName() const { return m_type_name; }
 
+    /** Returns the process-local interned ID of the field type name, for
+      * fast integer comparisons. Not stable across processes or saves. */
+    [[nodiscard]] uint32_t              FieldTypeID() const { return m_type_name_id; }
+
     /* Field is (presently) the only distributed UniverseObject that isn't just
      * location at a single point in space. These functions check if locations
      * or objecs are within this field's area. */
@@ -49,6 +54,9 @@ private:
     [[nodiscard]] Field* Clone(const Universe& universe, int empire_id = ALL_EMPIRES) const override;
 
     std::string m_type_name;
+    // interned copy of m_type_name, re-interned whenever the type name is
+    // set so the const getter is safe for concurrent readers; not serialized
+    uint32_t m_type_name_id = 0;
 
     template <typename Archive>
     friend void serialize(Archive&, Field&, unsigned int const);
@@ -192,6 +192,7 @@ void ObjectMap::CopyForSerialize(const ObjectMap& copied_map) {
 
     // note: the following relies upon only m_objects actually getting serialized by ObjectMap::serialize
     m_objects.insert(copied_map.m_objects.begin(), copied_map.m_objects.end());
+    ++m_state_version;
 }
 
 void ObjectMap::CopyObject(std::shared_ptr<const UniverseObject> source,
@@ -241,6 +242,7 @@ void ObjectMap::insertCore(std::shared_ptr<UniverseObject> item, int empire_id)
         m_existing_objects[ID] = item;
     }
     m_objects[ID] = std::move(item);
+    ++m_state_version;
 }
 
 void ObjectMap::insertCore(std::shared_ptr<Planet> item, int empire_id) {
@@ -258,6 +260,7 @@ void ObjectMap::insertCore(std::shared_ptr<Planet> item, int empire_id) {
         m_existing_objects.insert_or_assign(ID, item);
     }
     m_objects[ID] = std::move(item);
+    ++m_state_version;
 }
 
 std::shared_ptr<UniverseObject> ObjectMap::erase(int id) {
@@ -271,12 +274,14 @@ std::shared_ptr<UniverseObject> ObjectMap::erase(int id) {
     // and erase from pointer maps
     FOR_EACH_MAP(EraseFromMap, id);
     FOR_EACH_EXISTING_MAP(EraseFromMap, id);
+    ++m_state_version;
     return result;
 }
 
 void ObjectMap::clear() {
     FOR_EACH_MAP(ClearMap);
     FOR_EACH_EXISTING_MAP(ClearMap);
+    ++m_state_version;
 }
 
 std::vector<int> ObjectMap::FindExistingObjectIDs() const {
@@ -372,6 +377,7 @@ void ObjectMap::CopyObjectsToSpecializedMaps() {
     FOR_EACH_SPECIALIZED_MAP(ClearMap);
     for (const auto& entry : Map<UniverseObject>())
     { FOR_EACH_SPECIALIZED_MAP(TryInsertIntoMap, entry.second); }
+    ++m_state_version;  // called after deserializing a replacement m_objects
 }
 
 std::string ObjectMap::Dump(unsigned short ntabs) const {
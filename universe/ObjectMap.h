@@ -159,6 +159,12 @@ public:
     /** Returns highest used object ID in this ObjectMap */
     int HighestObjectID() const;
 
+    /** Returns a counter that is incremented whenever the set of objects in
+      * this ObjectMap changes (insertion, removal, clearing, deserialization).
+      * Comparing against a previously stored value detects that results
+      * derived from the map's contents may be stale. */
+    [[nodiscard]] unsigned int StateVersion() const noexcept { return m_state_version; }
+
     [[nodiscard]] std::string Dump(unsigned short ntabs = 0) const;
 
     /**  */
@@ -334,6 +340,8 @@ private:
     container_type<const UniverseObject>  m_existing_buildings;
     container_type<const UniverseObject>  m_existing_fields;
 
+    unsigned int m_state_version = 0;   // incremented on any change to the set of contained objects
+
     template <typename Archive>
     friend void serialize(Archive&, ObjectMap&, unsigned int const);
 };
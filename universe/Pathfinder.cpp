@@ -683,6 +683,19 @@ public:
         const Condition::ObjectSet& candidates,
         const Condition::ObjectSet& stationary) const;
 
+    /** Return true if the single \p candidate is within \p jumps of any of
+        \p stationary, without building the partition sets of the set overload. */
+    bool WithinJumpsOfOthers(
+        int jumps, const ObjectMap& objects,
+        const UniverseObject* candidate,
+        const Condition::ObjectSet& stationary) const;
+
+    /** Return the sorted ids of all systems within \p jumps of any of the
+        \p others objects' locations. */
+    std::vector<int> SystemsWithinJumpsOfAny(
+        int jumps, const ObjectMap& objects,
+        const Condition::ObjectSet& others) const;
+
     /** Return true if \p system_id is within \p jumps of any of \p others */
     bool WithinJumpsOfOthers(
         int jumps, int system_id, const ObjectMap& objects,
@@ -1359,15 +1372,40 @@ Pathfinder::WithinJumpsOfOthers(
     return pimpl->WithinJumpsOfOthers(jumps, objects, candidates, stationary);
 }
 
+std::vector<int> Pathfinder::PathfinderImpl::SystemsWithinJumpsOfAny(
+    int jumps, const ObjectMap& objects,
+    const Condition::ObjectSet& others) const
+{
+    if (jumps < 0)
+        return {};
+
+    std::vector<int> source_ids;
+    source_ids.reserve(others.size() * 2);
+    for (const auto* other : others) {
+        GeneralizedLocationType loc = GeneralizedLocation(other, objects);
+        if (const int* sys_id = boost::get<int>(&loc)) {
+            source_ids.push_back(*sys_id);
+        } else if (const auto* prev_next = boost::get<std::pair<int, int>>(&loc)) {
+            source_ids.push_back(prev_next->first);
+            source_ids.push_back(prev_next->second);
+        }
+    }
+
+    return WithinJumps(static_cast<size_t>(jumps), std::move(source_ids));
+}
+
 std::pair<Condition::ObjectSet, Condition::ObjectSet>
 Pathfinder::PathfinderImpl::WithinJumpsOfOthers(
     int jumps, const ObjectMap& objects,
     const Condition::ObjectSet& candidates,
     const Condition::ObjectSet& stationary) const
 {
-    // Examine each candidate and copy those within jumps of the
-    // others into near and the rest into far.
-    WithinJumpsOfOthersObjectVisitor visitor(*this, jumps, objects, stationary);
+    // Collect the systems within jumps of any of the others once, then test
+    // each candidate against that sorted id list, instead of re-walking the
+    // others' distance rows for every candidate.
+    const auto near_ids = SystemsWithinJumpsOfAny(jumps, objects, stationary);
+    const auto is_near_system = [&near_ids](int sys_id)
+    { return std::binary_search(near_ids.begin(), near_ids.end(), sys_id); };
 
     std::pair<Condition::ObjectSet, Condition::ObjectSet> retval;
     auto& [near, far] = retval;
@@ -1376,7 +1414,11 @@ Pathfinder::PathfinderImpl::WithinJumpsOfOthers(
 
     for (const auto* candidate : candidates) {
         GeneralizedLocationType candidate_systems = GeneralizedLocation(candidate, objects);
-        bool is_near = boost::apply_visitor(visitor, candidate_systems);
+        bool is_near = false;
+        if (const int* sys_id = boost::get<int>(&candidate_systems))
+            is_near = is_near_system(*sys_id);
+        else if (const auto* prev_next = boost::get<std::pair<int, int>>(&candidate_systems))
+            is_near = is_near_system(prev_next->first) || is_near_system(prev_next->second);
 
         if (is_near)
             near.push_back(candidate);
@@ -1387,6 +1429,22 @@ Pathfinder::PathfinderImpl::WithinJumpsOfOthers(
     return retval; // was: {near, far}; //, wherever you are...
 }
 
+bool Pathfinder::WithinJumpsOfOthers(
+    int jumps, const ObjectMap& objects,
+    const UniverseObject* candidate,
+    const Condition::ObjectSet& stationary) const
+{ return pimpl->WithinJumpsOfOthers(jumps, objects, candidate, stationary); }
+
+bool Pathfinder::PathfinderImpl::WithinJumpsOfOthers(
+    int jumps, const ObjectMap& objects,
+    const UniverseObject* candidate,
+    const Condition::ObjectSet& stationary) const
+{
+    WithinJumpsOfOthersObjectVisitor visitor(*this, jumps, objects, stationary);
+    GeneralizedLocationType candidate_systems = GeneralizedLocation(candidate, objects);
+    return boost::apply_visitor(visitor, candidate_systems);
+}
+
 bool Pathfinder::PathfinderImpl::WithinJumpsOfOthers(
     int jumps, int system_id,
     const ObjectMap& objects,
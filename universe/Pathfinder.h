@@ -131,6 +131,14 @@ public:
             const Condition::ObjectSet& candidates,
             const Condition::ObjectSet& stationary) const;
 
+    /** Returns true iff the single \p candidate object is within \p jumps of
+        any of the \p stationary objects, without building the partition sets
+        of the overload above. */
+    bool WithinJumpsOfOthers(
+        int jumps, const ObjectMap& objects,
+        const UniverseObject* candidate,
+        const Condition::ObjectSet& stationary) const;
+
     /** Returns the id of the System object that is closest to the specified
       * (\a x, \a y) location on the map, by direct-line distance. */
     int NearestSystemTo(double x, double y, const ObjectMap& objects) const;
@@ -236,6 +236,14 @@ PlanetEnvironment Planet::EnvironmentForSpecies(const std::string& species_name)
     return species->GetPlanetEnvironment(m_type);
 }
 
+PlanetEnvironment Planet::EnvironmentForSpecies(const Species* species) const {
+    // callers that test many planets against one species can look it up
+    // once and skip the per-planet name lookup of the string overload
+    if (!species)
+        return PlanetEnvironment::PE_UNINHABITABLE;
+    return species->GetPlanetEnvironment(m_type);
+}
+
 PlanetType Planet::NextBestPlanetTypeForSpecies(const std::string& species_name) const {
     const Species* species = nullptr;
     if (species_name.empty()) {
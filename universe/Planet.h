@@ -10,6 +10,8 @@
 #include "../Empire/EmpireManager.h"
 #include "../util/Export.h"
 
+class Species;
+
 //! Types of Planet%s
 FO_ENUM(
     (PlanetType),
@@ -78,6 +80,7 @@ public:
     [[nodiscard]] bool                HostileToEmpire(int empire_id, const EmpireManager& empires) const override;
 
     [[nodiscard]] PlanetEnvironment   EnvironmentForSpecies(const std::string& species_name = "") const;
+    [[nodiscard]] PlanetEnvironment   EnvironmentForSpecies(const Species* species) const;  ///< as above, for an already-looked-up species
     [[nodiscard]] PlanetType          NextBestPlanetTypeForSpecies(const std::string& species_name = "") const;
     [[nodiscard]] PlanetType          NextBetterPlanetTypeForSpecies(const std::string& species_name = "") const;
     [[nodiscard]] PlanetType          NextCloserToOriginalPlanetType() const;
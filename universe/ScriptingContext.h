@@ -34,6 +34,7 @@ struct ScriptingContext {
         current_turn(             parent_context.current_turn),
         in_design_id(             parent_context.in_design_id),
         production_block_size(    parent_context.production_block_size),
+        universe_frozen(          parent_context.universe_frozen),
         galaxy_setup_data(        parent_context.galaxy_setup_data),
         species(                  parent_context.species),
         supply(                   parent_context.supply),
@@ -71,6 +72,7 @@ struct ScriptingContext {
         current_turn(             parent_context.current_turn),
         in_design_id(             parent_context.in_design_id),
         production_block_size(    parent_context.production_block_size),
+        universe_frozen(          parent_context.universe_frozen),
         galaxy_setup_data(        parent_context.galaxy_setup_data),
         species(                  parent_context.species),
         supply(                   parent_context.supply),
@@ -99,6 +101,7 @@ struct ScriptingContext {
         current_turn(             parent_context.current_turn),
         in_design_id(             parent_context.in_design_id),
         production_block_size(    parent_context.production_block_size),
+        universe_frozen(          parent_context.universe_frozen),
         galaxy_setup_data(        parent_context.galaxy_setup_data),
         species(                  parent_context.species),
         supply(                   parent_context.supply),
@@ -124,6 +127,7 @@ struct ScriptingContext {
         current_turn(             parent_context.current_turn),
         in_design_id(             parent_context.in_design_id),
         production_block_size(    parent_context.production_block_size),
+        universe_frozen(          parent_context.universe_frozen),
         galaxy_setup_data(        parent_context.galaxy_setup_data),
         species(                  parent_context.species),
         supply(                   parent_context.supply),
@@ -149,6 +153,7 @@ struct ScriptingContext {
         current_turn(             parent_context.current_turn),
         in_design_id(             parent_context.in_design_id),
         production_block_size(    parent_context.production_block_size),
+        universe_frozen(          parent_context.universe_frozen),
         galaxy_setup_data(        parent_context.galaxy_setup_data),
         species(                  parent_context.species),
         supply(                   parent_context.supply),
@@ -199,6 +204,7 @@ struct ScriptingContext {
         current_turn(             parent_context.current_turn),
         in_design_id(             in_design_id_),
         production_block_size(    production_block_size_),
+        universe_frozen(          parent_context.universe_frozen),
         galaxy_setup_data(        parent_context.galaxy_setup_data),
         species(                  parent_context.species),
         supply(                   parent_context.supply),
@@ -225,6 +231,7 @@ struct ScriptingContext {
         current_turn(             parent_context.current_turn),
         in_design_id(             parent_context.in_design_id),
         production_block_size(    parent_context.production_block_size),
+        universe_frozen(          parent_context.universe_frozen),
         galaxy_setup_data(        parent_context.galaxy_setup_data),
         species(                  parent_context.species),
         supply(                   parent_context.supply),
@@ -251,6 +258,7 @@ struct ScriptingContext {
         current_turn(             parent_context.current_turn),
         in_design_id(             parent_context.in_design_id),
         production_block_size(    parent_context.production_block_size),
+        universe_frozen(          parent_context.universe_frozen),
         galaxy_setup_data(        parent_context.galaxy_setup_data),
         species(                  parent_context.species),
         supply(                   parent_context.supply),
@@ -425,6 +433,11 @@ struct ScriptingContext {
     int                                            current_turn = CurrentTurn();
     int                                            in_design_id = INVALID_DESIGN_ID;
     int                                            production_block_size = 1;
+    // true while the caller guarantees that nothing mutates objects for the
+    // duration of the evaluation, e.g. during effects group target scoping;
+    // lets conditions reuse cached results that effects execution could
+    // otherwise invalidate without bumping the object map's state version
+    bool                                           universe_frozen = false;
     const GalaxySetupData&                         galaxy_setup_data{GetGalaxySetupData()};
     SpeciesManager&                                species{GetSpeciesManager()};
     const SupplyManager&                           supply{GetSupplyManager()};
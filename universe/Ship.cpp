@@ -376,9 +376,15 @@ std::shared_ptr<UniverseObject> Ship::Accept(const UniverseObjectVisitor& visito
 const Meter* Ship::GetPartMeter(MeterType type, const std::string& part_name) const
 { return const_cast<Ship*>(this)->GetPartMeter(type, part_name); }
 
-Meter* Ship::GetPartMeter(MeterType type, const std::string& part_name) {
+const Meter* Ship::GetPartMeter(const PartMeterMap::key_type& key) const
+{ return const_cast<Ship*>(this)->GetPartMeter(key); }
+
+Meter* Ship::GetPartMeter(MeterType type, const std::string& part_name)
+{ return GetPartMeter(PartMeterMap::key_type{type, part_name}); }
+
+Meter* Ship::GetPartMeter(const PartMeterMap::key_type& key) {
     Meter* retval = nullptr;
-    auto it = m_part_meters.find({type, part_name});
+    auto it = m_part_meters.find(key);
     if (it != m_part_meters.end())
         retval = &it->second;
     return retval;
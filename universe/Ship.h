@@ -70,6 +70,7 @@ public:
 
     [[nodiscard]] const PartMeterMap& PartMeters() const { return m_part_meters; }                                ///< returns this Ship's part meters
     [[nodiscard]] const Meter*        GetPartMeter(MeterType type, const std::string& part_name) const;           ///< returns the requested part Meter, or 0 if no such part Meter of that type is found in this ship for that part name
+    [[nodiscard]] const Meter*        GetPartMeter(const PartMeterMap::key_type& key) const;                      ///< as above, taking a prebuilt lookup key, so repeated lookups don't copy the part name into a temporary key
     [[nodiscard]] float               CurrentPartMeterValue(MeterType type, const std::string& part_name) const;  ///< returns current value of the specified part meter \a type for the specified part name
     [[nodiscard]] float               InitialPartMeterValue(MeterType type, const std::string& part_name) const;  ///< returns this turn's initial value for the specified part meter \a type for the specified part name
 
@@ -106,6 +107,7 @@ public:
     void SetLastTurnActiveInCombat(int turn) { m_last_turn_active_in_combat = turn; } ///< sets the last turn this ship was actively involved in combat
 
     [[nodiscard]] Meter* GetPartMeter(MeterType type, const std::string& part_name); ///< returns the requested Meter, or 0 if no such Meter of that type is found in this object
+    [[nodiscard]] Meter* GetPartMeter(const PartMeterMap::key_type& key);
 
     virtual void SetShipMetersToMax();
 
@@ -14,6 +14,7 @@
 #include "../util/AppInterface.h"
 #include "../util/CheckSums.h"
 #include "../util/GameRules.h"
+#include "../util/StringInterner.h"
 #include "../util/i18n.h"
 
 
@@ -142,8 +143,10 @@ const std::string& ShipDesign::Name(bool stringtable_lookup) const {
 }
 
 void ShipDesign::SetName(const std::string& name) {
-    if (!name.empty() && !m_name.empty())
+    if (!name.empty() && !m_name.empty()) {
         m_name = name;
+        m_name_interned_id = StringInterning::InternedID(m_name);
+    }
 }
 
 void ShipDesign::SetUUID(const boost::uuids::uuid& uuid)
@@ -568,6 +571,11 @@ void ShipDesign::ForceValidDesignOrThrow(const boost::optional<std::invalid_argu
 }
 
 void ShipDesign::BuildStatCaches() {
+    // set even if the hull lookup below fails, so matchers comparing interned
+    // IDs agree with string comparison for any hull name
+    m_hull_interned_id = StringInterning::InternedID(m_hull);
+    m_name_interned_id = StringInterning::InternedID(m_name);
+
     const ShipHull* hull = GetShipHull(m_hull);
     if (!hull) {
         ErrorLogger() << "ShipDesign::BuildStatCaches couldn't get hull with name " << m_hull;
@@ -2,6 +2,8 @@
 #define _ShipDesign_h_
 
 
+#include <cstdint>
+
 #include <boost/functional/hash.hpp>
 #include <boost/optional/optional.hpp>
 #include <boost/uuid/nil_generator.hpp>
@@ -81,6 +83,7 @@ public:
       * the name string is looked up in the stringtable before being returned.
       * otherwise, the raw name string is returned. */
     const std::string& Name(bool stringtable_lookup = true) const;
+    std::uint32_t      NameInternedID() const noexcept { return m_name_interned_id; } ///< interned ID of Name(false), for single-compare matching in hot loops
     void               SetName(const std::string& name);
 
     /** Return the UUID. */
@@ -130,6 +133,7 @@ public:
     float Defense() const;
 
     const std::string&              Hull() const            { return m_hull; }      ///< returns name of hull on which design is based
+    std::uint32_t                   HullInternedID() const noexcept { return m_hull_interned_id; }  ///< interned ID of Hull(), for single-compare matching in hot loops
     const std::vector<std::string>& Parts() const           { return m_parts; }     ///< returns vector of names of all parts in this design, with position in vector corresponding to slot positions
     std::vector<std::string>        Parts(ShipSlotType slot_type) const;            ///< returns vector of names of parts in slots of indicated type in this design, unrelated to slot positions
     std::vector<std::string>        Weapons() const;                                ///< returns vector of names of weapon parts in, unrelated to slot positions
@@ -209,6 +213,8 @@ private:
     // initialized by BuildStatCaches based on parts and hull tags. tags data does not need to be serialized.
     std::string                   m_tags_concatenated;
     std::vector<std::string_view> m_tags;
+    std::uint32_t                 m_hull_interned_id = 0; // also set by BuildStatCaches; interned IDs are process-local, so not serialized
+    std::uint32_t                 m_name_interned_id = 0; // set by BuildStatCaches and SetName; not serialized for the same reason
 
     float   m_detection = 0.0f;
     float   m_colony_capacity = 0.0f;
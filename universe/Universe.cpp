@@ -148,6 +148,7 @@ Universe& Universe::operator=(Universe&& other) noexcept {
     m_empire_known_destroyed_object_ids = std::move(other.m_empire_known_destroyed_object_ids);
     m_empire_stale_knowledge_object_ids = std::move(other.m_empire_stale_knowledge_object_ids);
     m_ship_designs = std::move(other.m_ship_designs);
+    ++m_ship_designs_version;   // the replaced design set invalidates caches keyed on (this, version)
     m_empire_known_ship_design_ids = std::move(other.m_empire_known_ship_design_ids);
     m_effect_accounting_map = std::move(other.m_effect_accounting_map);
     m_effect_discrepancy_map = std::move(other.m_effect_discrepancy_map);
@@ -186,6 +187,7 @@ void Universe::Clear() {
     for (auto& entry : m_ship_designs)
         delete entry.second;
     m_ship_designs.clear();
+    ++m_ship_designs_version;
 
     m_empire_object_visibility.clear();
     m_empire_object_visibility_turns.clear();
@@ -367,6 +369,7 @@ void Universe::RenameShipDesign(int design_id, const std::string& name,
 
     design->SetName(name);
     design->SetDescription(description);
+    ++m_ship_designs_version;
 }
 
 const ShipDesign* Universe::GetGenericShipDesign(std::string_view name) const {
@@ -509,6 +512,7 @@ bool Universe::InsertShipDesignID(ShipDesign* ship_design, boost::optional<int>
     }
     ship_design->SetID(id);
     m_ship_designs[id] = ship_design;
+    ++m_ship_designs_version;
     return true;
 }
 
@@ -516,6 +520,7 @@ bool Universe::DeleteShipDesign(int design_id) {
     auto it = m_ship_designs.find(design_id);
     if (it != m_ship_designs.end()) {
         m_ship_designs.erase(it);
+        ++m_ship_designs_version;
         return true;
     } else { return false; }
 }
@@ -1334,12 +1339,17 @@ void Universe::GetEffectsAndTargets(std::map<int, Effect::SourcesEffectsTargetsA
 
 void Universe::GetEffectsAndTargets(std::map<int, Effect::SourcesEffectsTargetsAndCausesVec>& source_effects_targets_causes,
                                     const std::vector<int>& target_object_ids,
-                                    const ScriptingContext& context,
+                                    const ScriptingContext& parent_context,
                                     bool only_meter_effects) const
 {
-    CheckContextVsThisUniverse(*this, context);
+    CheckContextVsThisUniverse(*this, parent_context);
     SectionedScopedTimer type_timer("Effect TargetSets Evaluation", std::chrono::microseconds(0));
 
+    // nothing mutates gamestate while scoping effects groups, so conditions
+    // may reuse cached evaluation results for the duration of this call
+    ScriptingContext context{parent_context};
+    context.universe_frozen = true;
+
     // assemble target objects from input vector of IDs
     auto potential_targets{context.ContextObjects().findRaw<const UniverseObject>(target_object_ids)};
     const boost::container::flat_set<int> potential_ids_set{target_object_ids.begin(), target_object_ids.end()};
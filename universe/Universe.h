@@ -2,6 +2,7 @@
 #define _Universe_h_
 
 
+#include <cstdint>
 #include <list>
 #include <map>
 #include <memory>
@@ -143,6 +144,11 @@ public:
     [[nodiscard]] ship_design_iterator endShipDesigns() const   { return m_ship_designs.end(); }
     [[nodiscard]] size_t               NumShipDesigns() const   { return m_ship_designs.size(); }
 
+    /** Counter bumped whenever the ship design registry changes (insertion,
+      * deletion, rename, load); caches derived from the designs compare it to
+      * detect staleness. */
+    [[nodiscard]] std::uint32_t        ShipDesignsStateVersion() const noexcept { return m_ship_designs_version; }
+
     [[nodiscard]] const ShipDesign* GetGenericShipDesign(std::string_view name) const;
 
     /** Returns IDs of ship designs that the Empire with id \a empire_id has
@@ -532,6 +538,7 @@ private:
     ObjectKnowledgeMap              m_empire_stale_knowledge_object_ids;///< map from empire id to (set of object ids that the empire has previously observed but has subsequently been unable to detect at its last known location despite expecting to be able to detect it based on stealth of the object and having detectors in range)
 
     ShipDesignMap                   m_ship_designs;                     ///< ship designs in the universe
+    std::uint32_t                   m_ship_designs_version = 1;         ///< see ShipDesignsStateVersion(); not serialized, loading bumps it instead
     std::map<int, std::set<int>>    m_empire_known_ship_design_ids;     ///< ship designs known to each empire
 
     Effect::AccountingMap           m_effect_accounting_map;            ///< map from target object id, to map from target meter, to orderered list of structs with details of an effect and what it does to the meter
@@ -13,6 +13,7 @@
 #include "../Empire/Empire.h"
 #include "../util/AppInterface.h"
 #include "../util/Logger.h"
+#include "../util/StringInterner.h"
 #include "../util/i18n.h"
 
 namespace ValueRef {
@@ -100,6 +101,7 @@ void UniverseObject::Copy(std::shared_ptr<const UniverseObject> copied_object,
             if (visible_specials.count(entry_special_name))
                 this->m_specials[entry_special_name] = entry_special;
         }
+        this->RebuildSpecialsCaches();
 
         if (vis >= Visibility::VIS_PARTIAL_VISIBILITY) {
             this->m_owner_empire_id =   copied_object->m_owner_empire_id;
@@ -337,8 +339,28 @@ void UniverseObject::SetSystem(int sys) {
     }
 }
 
-void UniverseObject::AddSpecial(const std::string& name, float capacity) // TODO: pass turn
-{ m_specials[name] = std::pair{CurrentTurn(), capacity}; }
+uint64_t UniverseObject::SpecialNameBloomMask(std::string_view name) {
+    const std::size_t h = std::hash<std::string_view>{}(name);
+    // two hash bits per name: false-positive rate stays low for the handful
+    // of specials an object typically has
+    return (1ULL << (h & 63)) | (1ULL << ((h >> 6) & 63));
+}
+
+void UniverseObject::RebuildSpecialsCaches() {
+    uint64_t bloom = 0;
+    m_specials_ids.clear();
+    m_specials_ids.reserve(m_specials.size());
+    for (const auto& [special_name, turn_amount] : m_specials) {
+        bloom |= SpecialNameBloomMask(special_name);
+        m_specials_ids.emplace_back(StringInterning::InternedID(special_name), turn_amount);
+    }
+    m_specials_bloom = bloom;
+}
+
+void UniverseObject::AddSpecial(const std::string& name, float capacity) { // TODO: pass turn
+    m_specials[name] = std::pair{CurrentTurn(), capacity};
+    RebuildSpecialsCaches();
+}
 
 void UniverseObject::SetSpecialCapacity(const std::string& name, float capacity) {
     auto it = m_specials.find(name);
@@ -346,10 +368,13 @@ void UniverseObject::SetSpecialCapacity(const std::string& name, float capacity)
         it->second.second = capacity;
     else
         m_specials[name] = std::pair{CurrentTurn(), capacity};
+    RebuildSpecialsCaches();
 }
 
-void UniverseObject::RemoveSpecial(const std::string& name)
-{ m_specials.erase(name); }
+void UniverseObject::RemoveSpecial(const std::string& name) {
+    m_specials.erase(name);
+    RebuildSpecialsCaches();
+}
 
 UniverseObject::MeterMap UniverseObject::CensoredMeters(Visibility vis) const {
     MeterMap retval;
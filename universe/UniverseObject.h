@@ -2,10 +2,13 @@
 #define _UniverseObject_h_
 
 
+#include <cstdint>
 #include <set>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <boost/container/flat_map.hpp>
+#include <boost/container/small_vector.hpp>
 #include <boost/python/detail/destroy.hpp>
 #include <boost/signals2/optional_last_value.hpp>
 #include <boost/signals2/signal.hpp>
@@ -99,6 +102,21 @@ public:
     [[nodiscard]] virtual int                   SystemID() const { return m_system_id; };       ///< returns the ID number of the system in which this object can be found, or INVALID_OBJECT_ID if the object is not within any system
 
     [[nodiscard]] const auto&                   Specials() const { return m_specials; };        ///< returns the Specials attached to this object
+
+    /** Returns a 64-bit bloom filter over the names of this object's
+      * specials. If (SpecialsBloom() & SpecialNameBloomMask(name)) doesn't
+      * equal SpecialNameBloomMask(name) the object definitely has no special
+      * with that name; on a hit the Specials() map must still be checked. */
+    [[nodiscard]] uint64_t                      SpecialsBloom() const { return m_specials_bloom; }
+    [[nodiscard]] static uint64_t               SpecialNameBloomMask(std::string_view name);
+
+    using SpecialIDsVec = boost::container::small_vector<std::pair<uint32_t, std::pair<int, float>>, 4>;
+
+    /** Returns this object's specials as (interned name ID, (turn added,
+      * capacity)) entries (see StringInterning::InternedID), kept in sync
+      * with Specials(). Scanning these few IDs avoids the string-keyed map
+      * lookup in hot loops. */
+    [[nodiscard]] const SpecialIDsVec&          SpecialsByInternedID() const { return m_specials_ids; }
     [[nodiscard]] bool                          HasSpecial(std::string_view name) const;        ///< returns true iff this object has a special with the indicated \a name
     [[nodiscard]] int                           SpecialAddedOnTurn(std::string_view name) const;///< returns the turn on which the special with name \a name was added to this object, or INVALID_GAME_TURN if that special is not present
     [[nodiscard]] float                         SpecialCapacity(std::string_view name) const;   ///> returns the capacity of the special with name \a name or 0 if that special is not present
@@ -256,6 +274,7 @@ protected:
 
 private:
     [[nodiscard]] MeterMap CensoredMeters(Visibility vis) const; ///< returns set of meters of this object that are censored based on the specified Visibility \a vis
+    void RebuildSpecialsCaches(); ///< refreshes m_specials_ids and m_specials_bloom from m_specials
 
     int        m_id = INVALID_OBJECT_ID;
     int        m_owner_empire_id = ALL_EMPIRES;
@@ -265,6 +284,11 @@ private:
     double     m_y = INVALID_POSITION;
     MeterMap   m_meters;
     SpecialMap m_specials; // map from special name to pair of (turn added, capacity)
+    // caches derived from m_specials; not serialized. Rebuilt eagerly
+    // whenever m_specials changes, so the const getters stay read-only and
+    // safe to call concurrently from the effects evaluation thread pool.
+    SpecialIDsVec m_specials_ids;
+    uint64_t      m_specials_bloom = 0;
 
     UniverseObjectType m_type = UniverseObjectType::INVALID_UNIVERSE_OBJECT_TYPE;
 
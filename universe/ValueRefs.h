@@ -510,6 +510,14 @@ Constant<T>::Constant(TT&& value) :
     this->m_local_candidate_invariant = true;
     this->m_target_invariant = true;
     this->m_source_invariant = true;
+    if constexpr (std::is_same_v<T, std::string>) {
+        // "CurrentContent" is a placeholder whose evaluated value is only
+        // fixed once SetTopLevelContent substitutes the enclosing content's
+        // name; it reports constant from then on
+        this->m_constant_expr = (m_value != "CurrentContent");
+    } else {
+        this->m_constant_expr = true;
+    }
 }
 
 template <typename T>
@@ -5,6 +5,7 @@
 #include "Logger.h"
 
 #include <iostream>
+#include <string_view>
 #include <typeinfo>
 #include <set>
 #include <map>
@@ -13,6 +14,18 @@
 namespace CheckSums {
     constexpr unsigned int CHECKSUM_MODULUS = 10000000U;    // reasonably big number that should be well below UINT_MAX, which is ~4.29x10^9 for 32 bit unsigned int
 
+    // compile-time checksum of a fixed string: contributes exactly what the
+    // runtime string overload does (the absolute value of each char plus the
+    // length, mod CHECKSUM_MODULUS), so combining the returned constant with
+    // the unsigned overload yields identical sums without re-walking the
+    // string on every call
+    constexpr unsigned int StringCheckSum(std::string_view s) {
+        unsigned int sum = 0U;
+        for (char c : s)
+            sum = (sum + static_cast<unsigned int>(c < 0 ? -static_cast<int>(c) : c)) % CHECKSUM_MODULUS;
+        return (sum + static_cast<unsigned int>(s.size())) % CHECKSUM_MODULUS;
+    }
+
     FO_COMMON_API void CheckSumCombine(unsigned int& sum, double t);
     FO_COMMON_API void CheckSumCombine(unsigned int& sum, float t);
     FO_COMMON_API void CheckSumCombine(unsigned int& sum, const char* s);
@@ -97,6 +110,20 @@ namespace CheckSums {
         sum += c.size();
         sum %= CHECKSUM_MODULUS;
     }
+
+    // tag (a string, or its precomputed StringCheckSum value) plus any
+    // number of fields, mixed in argument order, so a GetCheckSum body can
+    // be a single statement instead of one line per field; produces the
+    // same sum as the equivalent sequence of calls. declared last so the
+    // recursive calls see all of the above overloads
+    template <typename Tag, typename T0, typename... Ts>
+    void CheckSumCombine(unsigned int& sum, const Tag& tag, const T0& t0,
+                         const Ts&... ts)
+    {
+        CheckSumCombine(sum, tag);
+        CheckSumCombine(sum, t0);
+        (CheckSumCombine(sum, ts), ...);
+    }
 }
 
 
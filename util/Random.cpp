@@ -43,6 +43,13 @@ double RandZeroToOne() {
     return dis(gen);
 }
 
+void RandZeroToOneBatch(double* out, std::size_t count) {
+    std::scoped_lock lock(s_prng_mutex);
+    static boost::random::uniform_01<> dis;
+    for (std::size_t i = 0; i < count; ++i)
+        out[i] = dis(gen);
+}
+
 double RandDouble(double min, double max) {
     if (min >= max)
         return min;
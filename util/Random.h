@@ -30,6 +30,11 @@ FO_COMMON_API int RandInt(int min, int max);
 /** returns a double from a uniform distribution of doubles in the range [0.0, 1.0) */
 FO_COMMON_API double RandZeroToOne();
 
+/** fills [\a out, \a out + \a count) with doubles from the same [0.0, 1.0)
+    distribution as RandZeroToOne, taking the generator lock once for the whole
+    batch; the values match \a count successive RandZeroToOne calls */
+FO_COMMON_API void RandZeroToOneBatch(double* out, std::size_t count);
+
 /** returns a double from a uniform distribution of doubles in the range [\a min, \a max) */
 FO_COMMON_API double RandDouble(double min, double max);
 
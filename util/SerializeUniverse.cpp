@@ -17,6 +17,7 @@
 #include "ScopedTimer.h"
 #include "AppInterface.h"
 #include "OptionsDB.h"
+#include "StringInterner.h"
 
 #include <boost/lexical_cast.hpp>
 #include <boost/uuid/nil_generator.hpp>
@@ -122,8 +123,10 @@ void serialize(Archive& ar, Universe& u, unsigned int const version)
 
     timer.EnterSection("designs");
     ar  & make_nvp("ship_designs", ship_designs);
-    if constexpr (Archive::is_loading::value)
+    if constexpr (Archive::is_loading::value) {
         u.m_ship_designs.swap(ship_designs);
+        ++u.m_ship_designs_version;  // the version itself is not serialized
+    }
     DebugLogger() << "Universe::serialize : " << serializing_label << " " << ship_designs.size() << " ship designs";
 
     ar  & make_nvp("m_empire_known_ship_design_ids", u.m_empire_known_ship_design_ids);
@@ -425,6 +428,10 @@ void serialize(Archive& ar, UniverseObject& o, unsigned int const version)
         Serialize(ar, o.m_meters, version);
     }
     ar  & make_nvp("m_created_on_turn", o.m_created_on_turn);
+
+    // the interned-ID and bloom caches over m_specials are not serialized
+    if constexpr (Archive::is_loading::value)
+        o.RebuildSpecialsCaches();
 }
 
 
@@ -469,6 +476,11 @@ void serialize(Archive& ar, Field& obj, unsigned int const version)
 
     ar  & make_nvp("UniverseObject", base_object<UniverseObject>(obj))
         & make_nvp("m_type_name", obj.m_type_name);
+
+    // the interned type ID is not serialized
+    if constexpr (Archive::is_loading::value)
+        obj.m_type_name_id = obj.m_type_name.empty() ?
+            StringInterning::INVALID_INTERNED_ID : StringInterning::InternedID(obj.m_type_name);
 }
 
 
@@ -531,6 +543,11 @@ void serialize(Archive& ar, Building& obj, unsigned int const version)
         & make_nvp("m_planet_id", obj.m_planet_id)
         & make_nvp("m_ordered_scrapped", obj.m_ordered_scrapped)
         & make_nvp("m_produced_by_empire_id", obj.m_produced_by_empire_id);
+
+    // the interned type ID is not serialized
+    if constexpr (Archive::is_loading::value)
+        obj.m_building_type_id = obj.m_building_type.empty() ?
+            StringInterning::INVALID_INTERNED_ID : StringInterning::InternedID(obj.m_building_type);
 }
 
 BOOST_CLASS_EXPORT(Building)
@@ -0,0 +1,37 @@
+#include "StringInterner.h"
+
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+namespace {
+    std::shared_mutex interned_ids_mutex;
+    std::unordered_map<std::string, std::uint32_t> interned_ids;
+    std::uint32_t next_interned_id = StringInterning::INVALID_INTERNED_ID + 1;
+}
+
+namespace StringInterning {
+    std::uint32_t InternedID(std::string_view str) {
+        if (str.empty())
+            return INVALID_INTERNED_ID;
+
+        // transparent lookup of string_view keys in an unordered_map<string, ...>
+        // isn't available in C++17, so materialize the key once here; interning
+        // is off the hot path, the point is that comparisons of IDs are cheap
+        std::string key{str};
+
+        {
+            std::shared_lock lock(interned_ids_mutex);
+            auto it = interned_ids.find(key);
+            if (it != interned_ids.end())
+                return it->second;
+        }
+
+        std::unique_lock lock(interned_ids_mutex);
+        auto [it, inserted] = interned_ids.emplace(std::move(key), next_interned_id);
+        if (inserted)
+            ++next_interned_id;
+        return it->second;
+    }
+}
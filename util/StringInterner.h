@@ -0,0 +1,25 @@
+#ifndef _StringInterner_h_
+#define _StringInterner_h_
+
+#include <cstdint>
+#include <string_view>
+
+#include "Export.h"
+
+/** Maps strings to stable small integer IDs so that hot loops can compare a
+  * single uint32_t instead of whole strings. IDs are process-local: they are
+  * assigned in order of first interning, so they must never be serialized or
+  * sent over the network, but within a process the same string always maps to
+  * the same ID. */
+namespace StringInterning {
+    /** ID returned for the empty string, and initial value for caches of
+      * not-yet-interned IDs. */
+    inline constexpr std::uint32_t INVALID_INTERNED_ID = 0;
+
+    /** Returns the process-local ID for \a str, assigning a new one if this
+      * string has not been interned before. Thread safe. */
+    FO_COMMON_API std::uint32_t InternedID(std::string_view str);
+}
+
+
+#endif
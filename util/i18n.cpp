@@ -8,6 +8,8 @@
 #include <boost/locale.hpp>
 #include <boost/algorithm/string/case_conv.hpp>
 #include <atomic>
+#include <shared_mutex>
+#include <unordered_map>
 
 // define needed on Windows due to conflict with windows.h and std::min and std::max
 #ifndef NOMINMAX
@@ -425,10 +427,30 @@ bool UserStringExists(const char* str) {
            GetDevDefaultStringTable(stringtable_lock).StringExists(str);
 }
 
+namespace {
+    // parsed format objects keyed on their pattern text. parsing the pattern
+    // is the expensive part of constructing a boost::format and the patterns
+    // come from the stringtable, so the same few recur constantly; copying a
+    // parsed object is much cheaper than re-parsing. keying on content means
+    // a stringtable (language) switch simply fills new entries
+    std::unordered_map<std::string, boost::format> parsed_format_cache;
+    std::shared_mutex                              parsed_format_cache_mutex;
+}
+
 boost::format FlexibleFormat(const std::string &string_to_format) {
     try {
+        {
+            std::shared_lock cache_lock(parsed_format_cache_mutex);
+            auto it = parsed_format_cache.find(string_to_format);
+            if (it != parsed_format_cache.end())
+                return it->second;
+        }
         boost::format retval(string_to_format);
         retval.exceptions(boost::io::no_error_bits);
+        {
+            std::unique_lock cache_lock(parsed_format_cache_mutex);
+            parsed_format_cache.emplace(string_to_format, retval);
+        }
         return retval;
     } catch (const std::exception& e) {
         ErrorLogger() << "FlexibleFormat caught exception when formatting: " << e.what();